@@ -0,0 +1,196 @@
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "storm-parsers/parser/MappedFile.h"
+
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace parser {
+
+namespace {
+/*!
+ * Reads sizes, arrays, strings, bit vectors and matrices in the layout of the binary format.
+ */
+class BinaryReader {
+   public:
+    BinaryReader(char const* position, char const* end) : position(position), end(end) {
+        // Intentionally left empty.
+    }
+
+    void readBytes(void* destination, uint64_t numberOfBytes) {
+        STORM_LOG_THROW(numberOfBytes <= static_cast<uint64_t>(end - position), storm::exceptions::WrongFormatException,
+                        "Unexpected end of binary model file.");
+        if (numberOfBytes > 0) {
+            std::memcpy(destination, position, numberOfBytes);
+        }
+        position += numberOfBytes;
+    }
+
+    uint64_t readUint() {
+        uint64_t value;
+        readBytes(&value, sizeof(value));
+        return value;
+    }
+
+    template<typename T>
+    std::vector<T> readVector() {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be read in binary format.");
+        uint64_t const size = readUint();
+        STORM_LOG_THROW(size <= static_cast<uint64_t>(end - position) / sizeof(T), storm::exceptions::WrongFormatException,
+                        "Unexpected end of binary model file.");
+        std::vector<T> result(size);
+        uint64_t const numberOfBytes = size * sizeof(T);
+        readBytes(result.data(), numberOfBytes);
+        // Skip the padding
+        if (numberOfBytes % 8 != 0) {
+            char padding[8];
+            readBytes(padding, 8 - numberOfBytes % 8);
+        }
+        return result;
+    }
+
+    std::string readString() {
+        std::vector<char> characters = readVector<char>();
+        return std::string(characters.begin(), characters.end());
+    }
+
+    storm::storage::BitVector readBitVector() {
+        uint64_t const size = readUint();
+        std::vector<uint64_t> buckets = readVector<uint64_t>();
+        STORM_LOG_THROW(buckets.size() == (size + 63) / 64, storm::exceptions::WrongFormatException, "Unexpected size of bit vector in binary model file.");
+        storm::storage::BitVector result(size);
+        for (uint64_t bucket = 0; bucket < buckets.size(); ++bucket) {
+            uint64_t const bitIndex = bucket * 64;
+            result.setFromInt(bitIndex, std::min<uint64_t>(64, size - bitIndex), buckets[bucket]);
+        }
+        return result;
+    }
+
+    storm::storage::SparseMatrix<double> readMatrix() {
+        using IndexType = storm::storage::SparseMatrixIndexType;
+        uint64_t const columnCount = readUint();
+        std::vector<IndexType> rowIndications = readVector<IndexType>();
+        std::vector<storm::storage::MatrixEntry<IndexType, double>> columnsAndValues = readVector<storm::storage::MatrixEntry<IndexType, double>>();
+        boost::optional<std::vector<IndexType>> rowGroupIndices;
+        if (readUint() != 0) {
+            rowGroupIndices = readVector<IndexType>();
+        }
+        // The content is used without further checks by the matrix, so we validate it here.
+        STORM_LOG_THROW(!rowIndications.empty() && rowIndications.front() == 0 && rowIndications.back() == columnsAndValues.size() &&
+                            std::is_sorted(rowIndications.begin(), rowIndications.end()),
+                        storm::exceptions::WrongFormatException, "Inconsistent row indications in binary model file.");
+        STORM_LOG_THROW(std::all_of(columnsAndValues.begin(), columnsAndValues.end(),
+                                    [columnCount](storm::storage::MatrixEntry<IndexType, double> const& entry) { return entry.getColumn() < columnCount; }),
+                        storm::exceptions::WrongFormatException, "Column index out of range in binary model file.");
+        STORM_LOG_THROW(!rowGroupIndices || (!rowGroupIndices->empty() && rowGroupIndices->front() == 0 &&
+                                             rowGroupIndices->back() == rowIndications.size() - 1 &&
+                                             std::is_sorted(rowGroupIndices->begin(), rowGroupIndices->end())),
+                        storm::exceptions::WrongFormatException, "Inconsistent row groups in binary model file.");
+        return storm::storage::SparseMatrix<double>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    }
+
+    template<typename Labeling>
+    Labeling readLabeling(uint64_t itemCount) {
+        Labeling labeling(itemCount);
+        uint64_t const numberOfLabels = readUint();
+        for (uint64_t labelIndex = 0; labelIndex < numberOfLabels; ++labelIndex) {
+            std::string label = readString();
+            storm::storage::BitVector items = readBitVector();
+            STORM_LOG_THROW(items.size() == itemCount, storm::exceptions::WrongFormatException, "Unexpected size of labeling '" << label << "'.");
+            labeling.addLabel(label, std::move(items));
+        }
+        return labeling;
+    }
+
+   private:
+    char const* position;
+    char const* end;
+};
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(
+    std::string const& filename) {
+    STORM_LOG_INFO("Reading from file " << filename);
+    MappedFile file(filename.c_str());
+    return parseModel(file.getData(), file.getDataSize());
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> BinaryEncodingParser<ValueType, RewardModelType>::parseModel(char const* data,
+                                                                                                                                      std::size_t size) {
+    static_assert(std::is_same<ValueType, double>::value, "The binary format only supports models over doubles.");
+    BinaryReader reader(data, data + size);
+
+    // Parse header
+    char magic[sizeof(storm::exporter::binaryEncodingMagic)];
+    reader.readBytes(magic, sizeof(magic));
+    STORM_LOG_THROW(std::memcmp(magic, storm::exporter::binaryEncodingMagic, sizeof(magic)) == 0, storm::exceptions::WrongFormatException,
+                    "The file is not a model in binary format.");
+    uint64_t version = reader.readUint();
+    STORM_LOG_THROW(version == storm::exporter::binaryEncodingVersion, storm::exceptions::WrongFormatException,
+                    "The binary model file has version " << version << " but only version " << storm::exporter::binaryEncodingVersion << " is supported.");
+    STORM_LOG_THROW(reader.readUint() == storm::exporter::binaryEncodingByteOrderMark, storm::exceptions::WrongFormatException,
+                    "The binary model file was written with a different byte order.");
+    storm::models::ModelType type = storm::models::getModelType(reader.readString());
+    STORM_LOG_TRACE("Model type: " << type);
+
+    storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(reader.readMatrix());
+    uint64_t const stateCount = components.transitionMatrix.getRowGroupCount();
+    uint64_t const choiceCount = components.transitionMatrix.getRowCount();
+    components.stateLabeling = reader.readLabeling<storm::models::sparse::StateLabeling>(stateCount);
+
+    uint64_t const numberOfRewardModels = reader.readUint();
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < numberOfRewardModels; ++rewardModelIndex) {
+        std::string rewardModelName = reader.readString();
+        std::optional<std::vector<ValueType>> stateRewards, stateActionRewards;
+        std::optional<storm::storage::SparseMatrix<ValueType>> transitionRewards;
+        if (reader.readUint() != 0) {
+            stateRewards = reader.readVector<ValueType>();
+            STORM_LOG_THROW(stateRewards->size() == stateCount, storm::exceptions::WrongFormatException, "Unexpected size of state rewards.");
+        }
+        if (reader.readUint() != 0) {
+            stateActionRewards = reader.readVector<ValueType>();
+            STORM_LOG_THROW(stateActionRewards->size() == choiceCount, storm::exceptions::WrongFormatException, "Unexpected size of state-action rewards.");
+        }
+        if (reader.readUint() != 0) {
+            transitionRewards = reader.readMatrix();
+        }
+        components.rewardModels.emplace(std::move(rewardModelName),
+                                        RewardModelType(std::move(stateRewards), std::move(stateActionRewards), std::move(transitionRewards)));
+    }
+
+    if (reader.readUint() != 0) {
+        components.choiceLabeling = reader.readLabeling<storm::models::sparse::ChoiceLabeling>(choiceCount);
+    }
+
+    // Parse the components that are specific to the model type
+    if (type == storm::models::ModelType::Ctmc) {
+        // The transition matrix of CTMCs contains rates.
+        components.rateTransitions = true;
+        components.exitRates = reader.readVector<ValueType>();
+    } else if (type == storm::models::ModelType::MarkovAutomaton) {
+        components.exitRates = reader.readVector<ValueType>();
+        components.markovianStates = reader.readBitVector();
+    } else if (type == storm::models::ModelType::Pomdp) {
+        components.observabilityClasses = reader.readVector<uint32_t>();
+    }
+    STORM_LOG_THROW(!components.exitRates || components.exitRates->size() == stateCount, storm::exceptions::WrongFormatException,
+                    "Unexpected size of exit rates.");
+
+    return storm::utility::builder::buildModelFromComponents(type, std::move(components));
+}
+
+// Template instantiations.
+template class BinaryEncodingParser<double>;
+
+}  // namespace parser
+}  // namespace storm
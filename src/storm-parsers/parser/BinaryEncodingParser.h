@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Parser for models in the binary format written by storm::exporter::explicitExportSparseModelBinary.
+ * The file is mapped to memory and each array of the model is obtained by a single copy, i.e., without parsing individual entries.
+ */
+template<typename ValueType, typename RewardModelType = models::sparse::StandardRewardModel<ValueType>>
+class BinaryEncodingParser {
+   public:
+    /*!
+     * Load a model in binary format from a file and create the model.
+     *
+     * @param filename The file to be parsed.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(std::string const& filename);
+
+    /*!
+     * Create a model from the given data in binary format.
+     *
+     * @param data The first byte of the data.
+     * @param size The number of bytes of the data.
+     *
+     * @return A sparse model
+     */
+    static std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> parseModel(char const* data, std::size_t size);
+};
+
+}  // namespace parser
+}  // namespace storm
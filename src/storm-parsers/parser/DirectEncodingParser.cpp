@@ -1,24 +1,29 @@
 #include "storm-parsers/parser/DirectEncodingParser.h"
 
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
-#include <iostream>
-#include <regex>
+#include <charconv>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <tuple>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/task_arena.h"
+#endif
+
+#include "storm-parsers/parser/MappedFile.h"
+
 #include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
-#include "storm/settings/SettingsManager.h"
-
-#include "storm/models/sparse/Ctmc.h"
-#include "storm/models/sparse/MarkovAutomaton.h"
 
-#include "storm/io/file.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/settings/SettingsManager.h"
@@ -30,13 +35,155 @@
 namespace storm {
 namespace parser {
 
+namespace {
+// Blocks of states are parsed concurrently. We use more blocks than threads to balance the load, but avoid tiny blocks.
+uint64_t const blocksPerThread = 8;
+uint64_t const minimalBlockSize = 4096;
+
+// Marks entries of the transition matrix whose transition was merged into another transition of the same row.
+storm::storage::SparseMatrixIndexType const mergedEntryColumn = std::numeric_limits<storm::storage::SparseMatrixIndexType>::max();
+
+/*!
+ * Returns the next line (without line break) and moves the position to the beginning of the following line.
+ */
+std::string_view nextLine(char const*& position, char const* end) {
+    char const* lineEnd = static_cast<char const*>(std::memchr(position, '\n', end - position));
+    if (lineEnd == nullptr) {
+        lineEnd = end;
+    }
+    std::string_view line(position, lineEnd - position);
+    position = lineEnd == end ? end : lineEnd + 1;
+    while (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+    }
+    return line;
+}
+
+/*!
+ * Reads the next line into the given string. Analogously to storm::utility::getline, line breaks are removed.
+ * @return False iff the end was already reached.
+ */
+bool readLine(char const*& position, char const* end, std::string& line) {
+    if (position >= end) {
+        line.clear();
+        return false;
+    }
+    line = nextLine(position, end);
+    return true;
+}
+
+bool isBlank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+std::string_view trimLeft(std::string_view str) {
+    while (!str.empty() && isBlank(str.front())) {
+        str.remove_prefix(1);
+    }
+    return str;
+}
+
+std::string_view trim(std::string_view str) {
+    str = trimLeft(str);
+    while (!str.empty() && isBlank(str.back())) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+bool startsWith(std::string_view str, std::string_view prefix) {
+    return str.substr(0, prefix.size()) == prefix;
+}
+
+/*!
+ * Splits off the next whitespace-separated token from the given line.
+ */
+std::string_view nextToken(std::string_view& line) {
+    line = trimLeft(line);
+    size_t tokenEnd = 0;
+    while (tokenEnd < line.size() && !isBlank(line[tokenEnd])) {
+        ++tokenEnd;
+    }
+    std::string_view token = line.substr(0, tokenEnd);
+    line = trimLeft(line.substr(tokenEnd));
+    return token;
+}
+
+uint64_t parseIndex(std::string_view token) {
+    STORM_LOG_THROW(!token.empty(), storm::exceptions::WrongFormatException, "Expected a non-negative integer but got an empty string.");
+    uint64_t result = 0;
+    for (char c : token) {
+        STORM_LOG_THROW(c >= '0' && c <= '9', storm::exceptions::WrongFormatException, "Could not parse value '" << token << "' into a non-negative integer.");
+        result = result * 10 + static_cast<uint64_t>(c - '0');
+    }
+    return result;
+}
+
+/*!
+ * Returns the number of the line containing the given position. This is only used for error messages.
+ */
+uint64_t getLineNumber(char const* fileBegin, char const* position) {
+    return 1 + std::count(fileBegin, position, '\n');
+}
+
+/*!
+ * Returns the beginning of the first line at or after the given position that declares a state (or the end if there is no such line).
+ */
+char const* findNextStateDeclaration(char const* begin, char const* position, char const* end) {
+    if (position != begin && position[-1] != '\n') {
+        // Move to the beginning of the next line.
+        nextLine(position, end);
+    }
+    while (position < end) {
+        char const* lineBegin = position;
+        if (startsWith(trimLeft(nextLine(position, end)), "state ")) {
+            return lineBegin;
+        }
+    }
+    return end;
+}
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+struct DirectEncodingParser<ValueType, RewardModelType>::StateBlock {
+    StateBlock(char const* begin, char const* end) : begin(begin), end(end) {}
+
+    // The part of the file containing the states of this block.
+    char const* begin;
+    char const* end;
+
+    // The number of states, choices (rows) and transitions of the block. They are counted before the block is parsed.
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfRows = 0;
+    uint64_t numberOfEntries = 0;
+    // The id of the first state, the first row and the position of the first transition of the block. The transitions of the block
+    // are parsed directly into the corresponding range of the transition matrix.
+    uint64_t firstState = 0;
+    uint64_t firstRow = 0;
+    uint64_t firstEntry = 0;
+    // The number of transitions that were merged into another transition of the same row with the same target state.
+    uint64_t numberOfMergedEntries = 0;
+    // The exit rates (for continuous time models) and observations (for POMDPs) of each state of the block.
+    std::vector<ValueType> exitRates;
+    std::vector<uint32_t> observations;
+    // The non-zero rewards as (reward model index, local state or row, value).
+    std::vector<std::tuple<uint64_t, uint64_t, ValueType>> stateRewards;
+    std::vector<std::tuple<uint64_t, uint64_t, ValueType>> actionRewards;
+    uint64_t numberOfStateRewardModels = 0;
+    uint64_t numberOfActionRewardModels = 0;
+    // The labels of the states and choices together with the local state or row. The labels point into the file content.
+    std::vector<std::pair<std::string_view, uint64_t>> stateLabels;
+    std::vector<std::pair<std::string_view, uint64_t>> choiceLabels;
+};
+
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseModel(
     std::string const& filename, DirectEncodingParserOptions const& options) {
     // Load file
     STORM_LOG_INFO("Reading from file " << filename);
-    std::ifstream file;
-    storm::utility::openFile(filename, file);
+    MappedFile file(filename.c_str());
+    char const* position = file.getData();
+    char const* const fileEnd = file.getDataEnd();
     std::string line;
 
     // Initialize
@@ -51,7 +198,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> modelComponents;
 
     // Parse header
-    while (storm::utility::getline(file, line)) {
+    while (readLine(position, fileEnd, line)) {
         if (line.empty() || boost::starts_with(line, "//")) {
             continue;
         }
@@ -68,7 +215,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
         } else if (line == "@parameters") {
             // Parse parameters
             STORM_LOG_THROW(!sawParameters, storm::exceptions::WrongFormatException, "Parameters declared twice");
-            storm::utility::getline(file, line);
+            readLine(position, fileEnd, line);
             if (line != "") {
                 std::vector<std::string> parameters;
                 boost::split(parameters, line, boost::is_any_of(" "));
@@ -81,7 +228,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
         } else if (line == "@placeholders") {
             // Parse placeholders
-            while (storm::utility::getline(file, line)) {
+            while (readLine(position, fileEnd, line)) {
                 size_t posColon = line.find(':');
                 STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException, "':' not found.");
                 std::string placeName = line.substr(0, posColon - 1);
@@ -91,7 +238,7 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                 STORM_LOG_TRACE("Placeholder " << placeName << " for value " << value);
                 auto ret = placeholders.insert(std::make_pair(placeName.substr(1), value));
                 STORM_LOG_THROW(ret.second, storm::exceptions::WrongFormatException, "Placeholder '$" << placeName << "' was already defined before.");
-                if (file.peek() == '@') {
+                if (position < fileEnd && *position == '@') {
                     // Next character is @ -> placeholder definitions ended
                     break;
                 }
@@ -99,16 +246,16 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
         } else if (line == "@reward_models") {
             // Parse reward models
             STORM_LOG_THROW(rewardModelNames.empty(), storm::exceptions::WrongFormatException, "Reward model names declared twice");
-            storm::utility::getline(file, line);
+            readLine(position, fileEnd, line);
             boost::split(rewardModelNames, line, boost::is_any_of("\t "));
         } else if (line == "@nr_states") {
             // Parse no. of states
             STORM_LOG_THROW(nrStates == 0, storm::exceptions::WrongFormatException, "Number states declared twice");
-            storm::utility::getline(file, line);
+            readLine(position, fileEnd, line);
             nrStates = parseNumber<size_t>(line);
         } else if (line == "@nr_choices") {
             STORM_LOG_THROW(nrChoices == 0, storm::exceptions::WrongFormatException, "Number of actions declared twice");
-            storm::utility::getline(file, line);
+            readLine(position, fileEnd, line);
             nrChoices = parseNumber<size_t>(line);
         } else if (line == "@model") {
             // Parse rest of the model
@@ -118,14 +265,14 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
             // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            modelComponents = parseStates(file.getData(), position, fileEnd, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
         }
     }
     // Done parsing
-    storm::utility::closeFile(file);
+    STORM_LOG_THROW(modelComponents, storm::exceptions::WrongFormatException, "No model (@model) declared in file " << filename << ".");
 
     // Build model
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
@@ -133,22 +280,20 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
-    std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-    ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    char const* fileBegin, char const* modelBegin, char const* modelEnd, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+    std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
     // Initialize
     auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
     bool nonDeterministic =
         (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
     bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-    storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
     modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
     modelComponents->observabilityClasses = std::vector<uint32_t>();
     modelComponents->observabilityClasses->resize(stateSize);
     if (options.buildChoiceLabeling) {
         modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
     }
-    std::vector<std::vector<ValueType>> stateRewards;
-    std::vector<std::vector<ValueType>> actionRewards;
     if (continuousTime) {
         modelComponents->exitRates = std::vector<ValueType>(stateSize);
         if (type == storm::models::ModelType::MarkovAutomaton) {
@@ -160,233 +305,167 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         modelComponents->rateTransitions = true;
     }
 
-    // Iterate over all lines
-    std::string line;
-    size_t row = 0;
-    size_t state = 0;
-    uint64_t lineNumber = 0;
-    bool firstState = true;
-    bool firstActionForState = true;
-    while (storm::utility::getline(file, line)) {
-        lineNumber++;
-        if (boost::starts_with(line, "//")) {
-            continue;
+    // Split the states into blocks such that each block starts with a state declaration.
+    uint64_t numberOfThreads = options.numberOfThreads;
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // Parametric values are parsed by an expression parser which can not be used concurrently.
+        STORM_LOG_WARN_COND(numberOfThreads <= 1, "Parametric models are parsed sequentially.");
+        numberOfThreads = 1;
+    }
+    uint64_t const modelSize = modelEnd - modelBegin;
+    uint64_t numberOfBlocks = 1;
+    if (numberOfThreads > 1) {
+        numberOfBlocks = std::max<uint64_t>(1, std::min<uint64_t>(numberOfThreads * blocksPerThread, modelSize / minimalBlockSize));
+    }
+    std::vector<StateBlock> blocks;
+    char const* blockBegin = modelBegin;
+    for (uint64_t blockIndex = 1; blockIndex < numberOfBlocks; ++blockIndex) {
+        char const* blockEnd = findNextStateDeclaration(modelBegin, std::max(blockBegin, modelBegin + modelSize * blockIndex / numberOfBlocks), modelEnd);
+        if (blockEnd > blockBegin) {
+            blocks.emplace_back(blockBegin, blockEnd);
+            blockBegin = blockEnd;
         }
-        if (line.empty()) {
-            continue;
+    }
+    blocks.emplace_back(blockBegin, modelEnd);
+    STORM_LOG_TRACE("Parsing states in " << blocks.size() << " blocks.");
+
+    // Invokes the given function for all blocks, concurrently if possible.
+    auto forEachBlock = [&](auto const& function) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::task_arena arena(static_cast<int>(numberOfThreads));
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, blocks.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t blockIndex = range.begin(); blockIndex < range.end(); ++blockIndex) {
+                    function(blocks[blockIndex]);
+                }
+            });
+        });
+#else
+        for (auto& block : blocks) {
+            function(block);
         }
-        STORM_LOG_TRACE("Parsing line no " << lineNumber << " : " << line);
-        boost::trim_left(line);
-        if (boost::starts_with(line, "state ")) {
-            // New state
-            if (firstState) {
-                firstState = false;
-            } else {
-                ++state;
-                ++row;
-            }
-            firstActionForState = true;
-            STORM_LOG_TRACE("New state " << state);
-            STORM_LOG_THROW(state <= stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
-
-            // Parse state id
-            line = line.substr(6);  // Remove "state "
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
-            }
-            size_t parsedId = parseNumber<size_t>(curString);
-            STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
-            if (nonDeterministic) {
-                STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                builder.newRowGroup(row);
-                STORM_LOG_THROW(nrChoices == 0 || builder.getCurrentRowGroupCount() <= nrChoices, storm::exceptions::WrongFormatException,
-                                "More actions detected than declared (in @nr_choices).");
-            }
+#endif
+    };
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(numberOfThreads <= 1, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+#endif
+
+    // Count the states, rows and transitions of the blocks to determine the size of the transition matrix and the part of it that
+    // belongs to each block.
+    forEachBlock([](StateBlock& block) { countStateBlock(block); });
+    uint64_t numberOfStates = 0;
+    uint64_t numberOfRows = 0;
+    uint64_t numberOfEntries = 0;
+    for (auto& block : blocks) {
+        block.firstState = numberOfStates;
+        block.firstRow = numberOfRows;
+        block.firstEntry = numberOfEntries;
+        numberOfStates += block.numberOfStates;
+        numberOfRows += block.numberOfRows;
+        numberOfEntries += block.numberOfEntries;
+    }
+    STORM_LOG_THROW(numberOfStates <= stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || numberOfRows == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << numberOfRows << ") does not match number of actions declared (" << nrChoices << ", in @nr_choices).");
+    }
 
-            if (continuousTime) {
-                // Parse exit rate for CTMC or MA
-                STORM_LOG_THROW(boost::starts_with(line, "!"), storm::exceptions::WrongFormatException, "Exit rate missing in " << lineNumber);
-                line = line.substr(1);  // Remove "!"
-                curString = line;
-                posEnd = line.find(" ");
-                if (posEnd != std::string::npos) {
-                    curString = line.substr(0, posEnd);
-                    line = line.substr(posEnd + 1);
-                } else {
-                    line = "";
-                }
-                ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                    modelComponents->markovianStates.get().set(state);
+    // Allocate the transition matrix and let the blocks parse their states into it. As for the matrix builder, the matrix has at
+    // least one row and states that are not declared get an empty row group.
+    uint64_t const rowCount = std::max<uint64_t>(numberOfRows, 1);
+    std::vector<storm::storage::SparseMatrixIndexType> rowIndications(rowCount + 1, numberOfEntries);
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> entries(numberOfEntries);
+    boost::optional<std::vector<storm::storage::SparseMatrixIndexType>> rowGroupIndices;
+    if (nonDeterministic) {
+        rowGroupIndices = std::vector<storm::storage::SparseMatrixIndexType>(stateSize + 1, rowCount);
+    }
+    forEachBlock([&](StateBlock& block) {
+        parseStateBlock(block, fileBegin, type, stateSize, placeholders, valueParser, options, rowIndications, entries, rowGroupIndices);
+    });
+    STORM_LOG_TRACE("Finished parsing");
+
+    // Remove the entries of transitions that were merged into another transition.
+    uint64_t numberOfMergedEntries = 0;
+    for (auto const& block : blocks) {
+        numberOfMergedEntries += block.numberOfMergedEntries;
+    }
+    if (numberOfMergedEntries > 0) {
+        STORM_LOG_WARN("Merged " << numberOfMergedEntries << " transitions into a transition of the same choice with the same target state.");
+        uint64_t newEntry = 0;
+        uint64_t rowBegin = 0;
+        for (uint64_t row = 0; row < rowCount; ++row) {
+            uint64_t const rowEnd = rowIndications[row + 1];
+            for (uint64_t entry = rowBegin; entry < rowEnd; ++entry) {
+                if (entries[entry].getColumn() != mergedEntryColumn) {
+                    entries[newEntry++] = std::move(entries[entry]);
                 }
-                STORM_LOG_TRACE("Exit rate " << exitRate);
-                modelComponents->exitRates.get()[state] = exitRate;
             }
+            rowIndications[row + 1] = newEntry;
+            rowBegin = rowEnd;
+        }
+        entries.resize(newEntry);
+    }
+    modelComponents->transitionMatrix =
+        storm::storage::SparseMatrix<ValueType>(stateSize, std::move(rowIndications), std::move(entries), std::move(rowGroupIndices));
+    STORM_LOG_TRACE("Built matrix");
 
-            if (boost::starts_with(line, "[")) {
-                // Parse rewards
-                size_t posEndReward = line.find(']');
-                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing in line " << lineNumber << " .");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("State rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (stateRewards.size() < rewards.size()) {
-                    stateRewards.resize(rewards.size());
-                }
-                auto stateRewardsIt = stateRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (stateRewardsIt->empty()) {
-                            stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
-                        }
-                        (*stateRewardsIt)[state] = std::move(rewardValue);
-                    }
-                    ++stateRewardsIt;
+    // Assemble the remaining model components.
+    uint64_t numberOfStateRewardModels = 0;
+    uint64_t numberOfActionRewardModels = 0;
+    for (auto const& block : blocks) {
+        numberOfStateRewardModels = std::max(numberOfStateRewardModels, block.numberOfStateRewardModels);
+        numberOfActionRewardModels = std::max(numberOfActionRewardModels, block.numberOfActionRewardModels);
+    }
+    std::vector<std::vector<ValueType>> stateRewards(numberOfStateRewardModels);
+    std::vector<std::vector<ValueType>> actionRewards(numberOfActionRewardModels);
+    for (auto& block : blocks) {
+        uint64_t const state = block.firstState;
+        uint64_t const row = block.firstRow;
+        for (uint64_t localState = 0; localState < block.numberOfStates; ++localState) {
+            if (continuousTime) {
+                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(block.exitRates[localState])) {
+                    modelComponents->markovianStates.get().set(state + localState);
                 }
-                line = line.substr(posEndReward + 1);
+                modelComponents->exitRates.get()[state + localState] = std::move(block.exitRates[localState]);
             }
-
             if (type == storm::models::ModelType::Pomdp) {
-                if (boost::starts_with(line, "{")) {
-                    size_t posEndObservation = line.find("}");
-                    std::string observation = line.substr(1, posEndObservation - 1);
-                    STORM_LOG_TRACE("State observation " << observation);
-                    modelComponents->observabilityClasses.value()[state] = std::stoi(observation);
-                    line = line.substr(posEndObservation + 1);
-                } else {
-                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << " in line " << lineNumber);
-                }
+                modelComponents->observabilityClasses.value()[state + localState] = block.observations[localState];
             }
+        }
 
-            // Parse labels
-            if (!line.empty()) {
-                std::vector<std::string> labels;
-                // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                // Regex for labels with two cases:
-                // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
-                //   (?=(\s|$|\"))
-                // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
-                // Iterate over matches
-                auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
-                auto match_end = std::sregex_iterator();
-                for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
-                    std::smatch match = *i;
-                    // Find matched group and add as label
-                    if (match.length(1) > 0) {
-                        labels.push_back(match.str(1));
-                    } else {
-                        labels.push_back(match.str(3));
-                    }
-                }
-
-                for (std::string const& label : labels) {
-                    if (!modelComponents->stateLabeling.containsLabel(label)) {
-                        modelComponents->stateLabeling.addLabel(label);
-                    }
-                    modelComponents->stateLabeling.addLabelToState(label, state);
-                    STORM_LOG_TRACE("New label: '" << label << "'");
-                }
+        for (auto& [rewardModelIndex, localState, value] : block.stateRewards) {
+            auto& rewards = stateRewards[rewardModelIndex];
+            if (rewards.empty()) {
+                rewards.resize(stateSize, storm::utility::zero<ValueType>());
             }
-        } else if (boost::starts_with(line, "action ")) {
-            // New action
-            if (firstActionForState) {
-                firstActionForState = false;
-            } else {
-                ++row;
-            }
-            STORM_LOG_TRACE("New action: " << row);
-            line = line.substr(7);
-            std::string curString = line;
-            size_t posEnd = line.find(" ");
-            if (posEnd != std::string::npos) {
-                curString = line.substr(0, posEnd);
-                line = line.substr(posEnd + 1);
-            } else {
-                line = "";
-            }
-
-            // curString contains action name.
-            if (options.buildChoiceLabeling) {
-                if (curString != "__NOLABEL__") {
-                    if (!modelComponents->choiceLabeling.value().containsLabel(curString)) {
-                        modelComponents->choiceLabeling.value().addLabel(curString);
-                    }
-                    modelComponents->choiceLabeling.value().addLabelToChoice(curString, row);
-                }
+            rewards[state + localState] = std::move(value);
+        }
+        for (auto& [rewardModelIndex, localChoice, value] : block.actionRewards) {
+            auto& rewards = actionRewards[rewardModelIndex];
+            if (rewards.empty()) {
+                rewards.resize(numberOfRows, storm::utility::zero<ValueType>());
             }
-            // Check for rewards
-            if (boost::starts_with(line, "[")) {
-                // Rewards found
-                size_t posEndReward = line.find(']');
-                STORM_LOG_THROW(posEndReward != std::string::npos, storm::exceptions::WrongFormatException, "] missing.");
-                std::string rewardsStr = line.substr(1, posEndReward - 1);
-                STORM_LOG_TRACE("Action rewards: " << rewardsStr);
-                std::vector<std::string> rewards;
-                boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (actionRewards.size() < rewards.size()) {
-                    actionRewards.resize(rewards.size());
-                }
-                auto actionRewardsIt = actionRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
-                    if (!storm::utility::isZero(rewardValue)) {
-                        if (actionRewardsIt->size() <= row) {
-                            actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
-                        }
-                        (*actionRewardsIt)[row] = std::move(rewardValue);
-                    }
-                    ++actionRewardsIt;
-                }
-                line = line.substr(posEndReward + 1);
+            rewards[row + localChoice] = std::move(value);
+        }
+        for (auto const& [labelString, localState] : block.stateLabels) {
+            std::string label(labelString);
+            if (!modelComponents->stateLabeling.containsLabel(label)) {
+                modelComponents->stateLabeling.addLabel(label);
             }
-
-        } else {
-            // New transition
-            size_t posColon = line.find(':');
-            STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException,
-                            "':' not found in '" << line << "' on line " << lineNumber << ".");
-            size_t target = parseNumber<size_t>(line.substr(0, posColon - 1));
-            std::string valueStr = line.substr(posColon + 2);
-            ValueType value = parseValue(valueStr, placeholders, valueParser);
-            STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
-            STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
-            builder.addNextValue(row, target, value);
+            modelComponents->stateLabeling.addLabelToState(label, state + localState);
         }
-
-        if (storm::utility::resources::isTerminate()) {
-            std::cout << "Parsed " << state << "/" << stateSize << " states before abort.\n";
-            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-            break;
+        for (auto const& [labelString, localChoice] : block.choiceLabels) {
+            std::string label(labelString);
+            if (!modelComponents->choiceLabeling.value().containsLabel(label)) {
+                modelComponents->choiceLabeling.value().addLabel(label);
+            }
+            modelComponents->choiceLabeling.value().addLabelToChoice(label, row + localChoice);
         }
 
-    }  // end state iteration
-    STORM_LOG_TRACE("Finished parsing");
-
-    if (nonDeterministic) {
-        STORM_LOG_THROW(nrChoices == 0 || builder.getLastRow() + 1 == nrChoices, storm::exceptions::WrongFormatException,
-                        "Number of actions detected (at least " << builder.getLastRow() + 1 << ") does not match number of actions declared (" << nrChoices
-                                                                << ", in @nr_choices).");
+        // Release the memory of the block as early as possible.
+        block = StateBlock(block.begin, block.end);
     }
 
-    // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
-    STORM_LOG_TRACE("Built matrix");
-
     // Build reward models
     uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
     for (uint64_t i = 0; i < numRewardModels; ++i) {
@@ -401,7 +480,6 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             stateRewardVector = std::move(stateRewards[i]);
         }
         if (i < actionRewards.size() && !actionRewards[i].empty()) {
-            actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
             actionRewardVector = std::move(actionRewards[i]);
         }
         modelComponents->rewardModels.emplace(
@@ -412,17 +490,226 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
 }
 
 template<typename ValueType, typename RewardModelType>
-ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string const& valueStr,
+void DirectEncodingParser<ValueType, RewardModelType>::countStateBlock(StateBlock& block) {
+    // The lines are classified in the same way as in parseStateBlock.
+    bool firstActionForState = true;
+    char const* position = block.begin;
+    while (position < block.end) {
+        std::string_view line = trimLeft(nextLine(position, block.end));
+        if (line.empty() || startsWith(line, "//")) {
+            continue;
+        }
+        if (startsWith(line, "state ")) {
+            ++block.numberOfStates;
+            ++block.numberOfRows;
+            firstActionForState = true;
+        } else if (startsWith(line, "action ")) {
+            if (firstActionForState) {
+                firstActionForState = false;
+            } else {
+                ++block.numberOfRows;
+            }
+        } else {
+            ++block.numberOfEntries;
+        }
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+void DirectEncodingParser<ValueType, RewardModelType>::parseStateBlock(
+    StateBlock& block, char const* fileBegin, storm::models::ModelType type, size_t stateSize, std::unordered_map<std::string, ValueType> const& placeholders,
+    ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options, std::vector<storm::storage::SparseMatrixIndexType>& rowIndications,
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& entries,
+    boost::optional<std::vector<storm::storage::SparseMatrixIndexType>>& rowGroupIndices) {
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    char const* lineBegin = block.begin;
+
+    // The number of states parsed so far, the (global) row that is currently parsed and the position of the next transition.
+    uint64_t numberOfParsedStates = 0;
+    uint64_t row = block.firstRow;
+    uint64_t entry = block.firstEntry;
+
+    // Sorts the transitions of the current row by their target state and merges transitions with the same target state.
+    auto finishRow = [&]() {
+        auto rowBegin = entries.begin() + rowIndications[row];
+        auto rowEnd = entries.begin() + entry;
+        auto compareColumns = [](auto const& a, auto const& b) { return a.getColumn() < b.getColumn(); };
+        if (!std::is_sorted(rowBegin, rowEnd, compareColumns)) {
+            std::sort(rowBegin, rowEnd, compareColumns);
+        }
+        auto adjacentIt = std::adjacent_find(rowBegin, rowEnd, [](auto const& a, auto const& b) { return a.getColumn() == b.getColumn(); });
+        if (adjacentIt != rowEnd) {
+            auto insertIt = adjacentIt;
+            for (auto it = adjacentIt + 1; it != rowEnd; ++it) {
+                if (it->getColumn() == insertIt->getColumn()) {
+                    insertIt->setValue(insertIt->getValue() + it->getValue());
+                } else if (++insertIt != it) {
+                    *insertIt = std::move(*it);
+                }
+            }
+            for (auto it = insertIt + 1; it != rowEnd; ++it) {
+                it->setColumn(mergedEntryColumn);
+                ++block.numberOfMergedEntries;
+            }
+        }
+    };
+
+    // Parses the rewards enclosed in brackets at the beginning of the line and returns the number of rewards.
+    auto parseRewards = [&](std::string_view& line, std::vector<std::tuple<uint64_t, uint64_t, ValueType>>& rewards, uint64_t index) {
+        size_t posEndReward = line.find(']');
+        STORM_LOG_THROW(posEndReward != std::string_view::npos, storm::exceptions::WrongFormatException,
+                        "] missing in line " << getLineNumber(fileBegin, lineBegin) << " .");
+        std::string_view rewardsStr = line.substr(1, posEndReward - 1);
+        line = trimLeft(line.substr(posEndReward + 1));
+        uint64_t rewardModelIndex = 0;
+        while (true) {
+            size_t posComma = rewardsStr.find(',');
+            auto rewardValue = parseValue(trim(rewardsStr.substr(0, posComma)), placeholders, valueParser);
+            if (!storm::utility::isZero(rewardValue)) {
+                rewards.emplace_back(rewardModelIndex, index, std::move(rewardValue));
+            }
+            ++rewardModelIndex;
+            if (posComma == std::string_view::npos) {
+                return rewardModelIndex;
+            }
+            rewardsStr.remove_prefix(posComma + 1);
+        }
+    };
+
+    bool firstActionForState = true;
+    char const* position = block.begin;
+    while (position < block.end) {
+        lineBegin = position;
+        std::string_view line = trimLeft(nextLine(position, block.end));
+        if (line.empty() || startsWith(line, "//")) {
+            continue;
+        }
+        if (startsWith(line, "state ")) {
+            // New state
+            line.remove_prefix(6);
+            uint64_t const state = parseIndex(nextToken(line));
+            uint64_t const localState = numberOfParsedStates;
+            STORM_LOG_THROW(state == block.firstState + localState, storm::exceptions::WrongFormatException,
+                            "In line " << getLineNumber(fileBegin, lineBegin) << " state ids are not ordered and without gaps. Expected "
+                                       << block.firstState + localState << " but got " << state << ".");
+            STORM_LOG_THROW(state < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+            if (numberOfParsedStates > 0) {
+                finishRow();
+                ++row;
+            }
+            ++numberOfParsedStates;
+            rowIndications[row] = entry;
+            if (rowGroupIndices) {
+                rowGroupIndices.get()[state] = row;
+            }
+            firstActionForState = true;
+
+            if (continuousTime) {
+                // Parse exit rate for CTMC or MA
+                STORM_LOG_THROW(startsWith(line, "!"), storm::exceptions::WrongFormatException,
+                                "Exit rate missing in line " << getLineNumber(fileBegin, lineBegin));
+                line.remove_prefix(1);
+                block.exitRates.push_back(parseValue(nextToken(line), placeholders, valueParser));
+            }
+
+            if (startsWith(line, "[")) {
+                // Parse rewards
+                block.numberOfStateRewardModels = std::max(block.numberOfStateRewardModels, parseRewards(line, block.stateRewards, localState));
+            }
+
+            if (type == storm::models::ModelType::Pomdp) {
+                STORM_LOG_THROW(startsWith(line, "{"), storm::exceptions::WrongFormatException,
+                                "Expected an observation for state " << state << " in line " << getLineNumber(fileBegin, lineBegin));
+                size_t posEndObservation = line.find('}');
+                STORM_LOG_THROW(posEndObservation != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                "} missing in line " << getLineNumber(fileBegin, lineBegin) << " .");
+                block.observations.push_back(static_cast<uint32_t>(parseIndex(trim(line.substr(1, posEndObservation - 1)))));
+                line = trimLeft(line.substr(posEndObservation + 1));
+            }
+
+            // Parse labels. Labels are separated by whitespace and can optionally be enclosed in quotation marks.
+            while (!line.empty()) {
+                std::string_view label;
+                if (line.front() == '"') {
+                    size_t posEndLabel = line.find('"', 1);
+                    STORM_LOG_THROW(posEndLabel != std::string_view::npos, storm::exceptions::WrongFormatException,
+                                    "Closing quotation mark missing in line " << getLineNumber(fileBegin, lineBegin) << " .");
+                    label = line.substr(1, posEndLabel - 1);
+                    line = trimLeft(line.substr(posEndLabel + 1));
+                } else {
+                    label = nextToken(line);
+                }
+                if (!label.empty()) {
+                    block.stateLabels.emplace_back(label, localState);
+                }
+            }
+
+            if (storm::utility::resources::isTerminate()) {
+                STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted while parsing state " << state << ".");
+            }
+        } else if (startsWith(line, "action ")) {
+            // New action
+            STORM_LOG_THROW(numberOfParsedStates > 0, storm::exceptions::WrongFormatException,
+                            "Action declared before the first state in line " << getLineNumber(fileBegin, lineBegin) << ".");
+            if (firstActionForState) {
+                firstActionForState = false;
+            } else {
+                finishRow();
+                ++row;
+                rowIndications[row] = entry;
+            }
+            uint64_t const localRow = row - block.firstRow;
+            line.remove_prefix(7);
+            std::string_view actionName = nextToken(line);
+            if (options.buildChoiceLabeling && actionName != "__NOLABEL__") {
+                block.choiceLabels.emplace_back(actionName, localRow);
+            }
+            // Check for rewards
+            if (startsWith(line, "[")) {
+                block.numberOfActionRewardModels = std::max(block.numberOfActionRewardModels, parseRewards(line, block.actionRewards, localRow));
+            }
+        } else {
+            // New transition
+            STORM_LOG_THROW(numberOfParsedStates > 0, storm::exceptions::WrongFormatException,
+                            "Transition declared before the first state in line " << getLineNumber(fileBegin, lineBegin) << ".");
+            size_t posColon = line.find(':');
+            STORM_LOG_THROW(posColon != std::string_view::npos, storm::exceptions::WrongFormatException,
+                            "':' not found in '" << line << "' on line " << getLineNumber(fileBegin, lineBegin) << ".");
+            uint64_t target = parseIndex(trim(line.substr(0, posColon)));
+            STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
+                            "In line " << getLineNumber(fileBegin, lineBegin) << " target state " << target << " is greater than state size " << stateSize);
+            entries[entry++] = storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(
+                target, parseValue(trim(line.substr(posColon + 1)), placeholders, valueParser));
+        }
+    }
+    if (numberOfParsedStates > 0) {
+        finishRow();
+    }
+    STORM_LOG_ASSERT(numberOfParsedStates == block.numberOfStates && entry == block.firstEntry + block.numberOfEntries,
+                     "The parsed block does not match the counted block.");
+}
+
+template<typename ValueType, typename RewardModelType>
+ValueType DirectEncodingParser<ValueType, RewardModelType>::parseValue(std::string_view const& valueStr,
                                                                        std::unordered_map<std::string, ValueType> const& placeholders,
                                                                        ValueParser<ValueType> const& valueParser) {
-    if (boost::starts_with(valueStr, "$")) {
-        auto it = placeholders.find(valueStr.substr(1));
+    if (startsWith(valueStr, "$")) {
+        auto it = placeholders.find(std::string(valueStr.substr(1)));
         STORM_LOG_THROW(it != placeholders.end(), storm::exceptions::WrongFormatException, "Placeholder " << valueStr << " unknown.");
         return it->second;
-    } else {
-        // Use default value parser
-        return valueParser.parseValue(valueStr);
     }
+#ifdef __cpp_lib_to_chars
+    if constexpr (std::is_same<ValueType, double>::value) {
+        // Fast path for plain floating point numbers. Other values (e.g. fractions) are handled by the value parser below.
+        double value;
+        auto [valueEnd, error] = std::from_chars(valueStr.data(), valueStr.data() + valueStr.size(), value);
+        if (error == std::errc() && valueEnd == valueStr.data() + valueStr.size()) {
+            return value;
+        }
+    }
+#endif
+    // Use default value parser
+    return valueParser.parseValue(std::string(valueStr));
 }
 
 // Template instantiations.
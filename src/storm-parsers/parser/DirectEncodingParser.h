@@ -1,9 +1,12 @@
 #ifndef STORM_PARSER_DIRECTENCODINGPARSER_H_
 #define STORM_PARSER_DIRECTENCODINGPARSER_H_
 
+#include <string_view>
+
 #include "storm-parsers/parser/ValueParser.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ModelComponents.h"
 
 namespace storm {
@@ -11,6 +14,8 @@ namespace parser {
 
 struct DirectEncodingParserOptions {
     bool buildChoiceLabeling = false;
+    /// The number of threads used to parse the states. Parametric models are always parsed sequentially.
+    uint64_t numberOfThreads = 1;
 };
 /*!
  *	Parser for models in the DRN format with explicit encoding.
@@ -29,10 +34,17 @@ class DirectEncodingParser {
         std::string const& fil, DirectEncodingParserOptions const& options = DirectEncodingParserOptions());
 
    private:
+    /*!
+     * The information parsed from a contiguous block of states, see parseStateBlock.
+     */
+    struct StateBlock;
+
     /*!
      * Parse states and return transition matrix.
      *
-     * @param file Input file stream.
+     * @param fileBegin Beginning of the (mapped) file, used to report line numbers.
+     * @param modelBegin Beginning of the state declarations in the file.
+     * @param modelEnd End of the state declarations in the file.
      * @param type Model type.
      * @param stateSize No. of states
      * @param placeholders Placeholders for values.
@@ -42,17 +54,48 @@ class DirectEncodingParser {
      * @return Transition matrix.
      */
     static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(
-        std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+        char const* fileBegin, char const* modelBegin, char const* modelEnd, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
+    /*!
+     * Counts the states, choices and transitions of a block of consecutive states without parsing any values.
+     *
+     * @param block The block to count. Its begin and end have to be set.
+     */
+    static void countStateBlock(StateBlock& block);
+
+    /*!
+     * Parse a block of consecutive states. The block has to start with a state declaration (or comments and empty lines).
+     * The parsed strings refer to the file content, i.e., no tokens are copied. The transitions are written directly into
+     * the part of the transition matrix that belongs to the block.
+     *
+     * @param block The block to fill. It has to be counted and its first state, row and entry have to be set.
+     * @param fileBegin Beginning of the (mapped) file, used to report line numbers.
+     * @param type Model type.
+     * @param stateSize No. of states
+     * @param placeholders Placeholders for values.
+     * @param valueParser Value parser.
+     * @param options Parser options.
+     * @param rowIndications The row indications of the transition matrix.
+     * @param entries The entries of the transition matrix.
+     * @param rowGroupIndices The row groups of the transition matrix (for nondeterministic models).
+     */
+    static void parseStateBlock(StateBlock& block, char const* fileBegin, storm::models::ModelType type, size_t stateSize,
+                                std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                                DirectEncodingParserOptions const& options, std::vector<storm::storage::SparseMatrixIndexType>& rowIndications,
+                                std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& entries,
+                                boost::optional<std::vector<storm::storage::SparseMatrixIndexType>>& rowGroupIndices);
 
     /*!
      * Parse value from string while using placeholders.
+     * Plain decimal numbers are parsed without copying the string if possible.
      * @param valueStr String.
      * @param placeholders Placeholders.
      * @param valueParser Value parser.
      * @return
      */
-    static ValueType parseValue(std::string const& valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
+    static ValueType parseValue(std::string_view const& valueStr, std::unordered_map<std::string, ValueType> const& placeholders,
                                 ValueParser<ValueType> const& valueParser);
 };
 
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/simulator/PrismStatisticalModelChecker.h"
+#include "storm/simulator/SparseStatisticalModelChecker.h"
+#include "storm/storage/prism/Program.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace api {
+
+/*!
+ * Retrieves the step-bounded until formula that is to be estimated by statistical model checking.
+ */
+inline storm::logic::BoundedUntilFormula const& getBoundedUntilFormulaForStatisticalModelChecking(storm::logic::Formula const& formula) {
+    storm::logic::Formula const* pathFormula = &formula;
+    if (pathFormula->isProbabilityOperatorFormula()) {
+        pathFormula = &pathFormula->asProbabilityOperatorFormula().getSubformula();
+    }
+    STORM_LOG_THROW(pathFormula->isBoundedUntilFormula(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking only supports step-bounded until formulas, got " << formula << ".");
+    storm::logic::BoundedUntilFormula const& boundedUntilFormula = pathFormula->asBoundedUntilFormula();
+    STORM_LOG_THROW(!boundedUntilFormula.isMultiDimensional() && !boundedUntilFormula.getTimeBoundReference().isRewardBound() &&
+                        !boundedUntilFormula.hasLowerBound() && boundedUntilFormula.hasUpperBound(),
+                    storm::exceptions::NotSupportedException,
+                    "Statistical model checking only supports until formulas with a single upper step bound, got " << formula << ".");
+    return boundedUntilFormula;
+}
+
+/*!
+ * Estimates the probability of a step-bounded until formula (e.g. P=? [a U<=10 b] or P=? [F<=10 b]) in the initial state
+ * of the given DTMC or MDP by sampling traces. Nondeterminism is resolved uniformly at random.
+ */
+template<typename ValueType>
+storm::simulator::StatisticalModelCheckingResult estimateWithStatisticalModelChecking(
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::shared_ptr<storm::logic::Formula const> const& formula,
+    storm::simulator::StatisticalModelCheckingOptions const& options = storm::simulator::StatisticalModelCheckingOptions()) {
+    storm::logic::BoundedUntilFormula const& boundedUntilFormula = getBoundedUntilFormulaForStatisticalModelChecking(*formula);
+
+    storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Model<ValueType>> propositionalChecker(*model);
+    storm::storage::BitVector phiStates =
+        propositionalChecker.check(boundedUntilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+    storm::storage::BitVector psiStates =
+        propositionalChecker.check(boundedUntilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+
+    storm::simulator::SparseStatisticalModelChecker<ValueType> checker(*model, options);
+    return checker.computeBoundedUntilProbability(phiStates, psiStates, boundedUntilFormula.getNonStrictUpperBound<uint64_t>());
+}
+
+/*!
+ * Estimates the probability of a step-bounded until formula in the initial state of the given discrete-time PRISM
+ * program by sampling traces on the fly, i.e., without building the state space. Nondeterminism is resolved uniformly at random.
+ */
+template<typename ValueType>
+storm::simulator::StatisticalModelCheckingResult estimateWithStatisticalModelChecking(
+    storm::prism::Program const& program, std::shared_ptr<storm::logic::Formula const> const& formula,
+    storm::simulator::StatisticalModelCheckingOptions const& options = storm::simulator::StatisticalModelCheckingOptions()) {
+    storm::logic::BoundedUntilFormula const& boundedUntilFormula = getBoundedUntilFormulaForStatisticalModelChecking(*formula);
+
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
+    storm::expressions::Expression phi = boundedUntilFormula.getLeftSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+    storm::expressions::Expression psi = boundedUntilFormula.getRightSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+
+    storm::simulator::PrismStatisticalModelChecker<ValueType> checker(program, options);
+    return checker.computeBoundedUntilProbability(phi, psi, boundedUntilFormula.getNonStrictUpperBound<uint64_t>());
+}
+
+}  // namespace api
+}  // namespace storm
@@ -4,5 +4,6 @@
 #include "storm/api/builder.h"
 #include "storm/api/export.h"
 #include "storm/api/properties.h"
+#include "storm/api/simulation.h"
 #include "storm/api/transformation.h"
 #include "storm/api/verification.h"
@@ -1,9 +1,18 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <map>
 
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/task_arena.h"
+#endif
+
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
 
@@ -22,6 +31,7 @@
 
 #include "storm/settings/modules/BuildSettings.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Automaton.h"
 #include "storm/storage/jani/AutomatonComposition.h"
@@ -53,16 +63,68 @@ uint64_t ExplicitStateLookup<StateType>::size() const {
     return this->stateToId.size();
 }
 
+namespace detail {
+
+/*!
+ * The data of a single thread that takes part in the parallel exploration.
+ */
+template<typename ValueType, typename StateType>
+struct ExplorationWorker {
+    ExplorationWorker(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator)
+        : generator(generator), currentState(generator->getStateSize()), newStateStorage(generator->getStateSize()) {
+        // Intentionally left empty.
+    }
+
+    /// The generator that is exclusively used by this worker.
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
+
+    /// The state that is currently explored by this worker.
+    CompressedState currentState;
+
+    /// The (temporary) indices of all states that were requested by the generator, in the order of the requests.
+    std::vector<StateType> discoveredStates;
+
+    /// The states that were inserted into the state map by this worker.
+    storm::storage::BitVectorArena newStateStorage;
+
+    /// The temporary indices of the states that were inserted into the state map by this worker together with their offset in the storage.
+    std::vector<std::pair<StateType, uint64_t>> newStates;
+};
+
+/*!
+ * Invokes the given function for all worker indices in [0, numberOfWorkers), using numberOfWorkers threads if possible.
+ */
+template<typename Function>
+void forEachWorker(uint64_t numberOfWorkers, Function const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    tbb::task_arena arena(static_cast<int>(numberOfWorkers));
+    arena.execute([numberOfWorkers, &function]() {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfWorkers, 1), [&function](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t workerIndex = range.begin(); workerIndex < range.end(); ++workerIndex) {
+                function(workerIndex);
+            }
+        });
+    });
+#else
+    for (uint64_t workerIndex = 0; workerIndex < numberOfWorkers; ++workerIndex) {
+        function(workerIndex);
+    }
+#endif
+}
+
+}  // namespace detail
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
-    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
+    : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()),
+      explorationThreads(storm::settings::getModule<storm::settings::modules::BuildSettings>().getNumberOfExplorationThreads()) {
     // Intentionally left empty.
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
-    : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+    : generator(generator), options(options), stateStorage(generator->getStateSize()), statesToExploreStorage(generator->getStateSize()) {
     // Intentionally left empty.
 }
 
@@ -117,12 +179,12 @@ StateType ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddS
 
     if (actualIndex == newIndex) {
         if (options.explorationOrder == ExplorationOrder::Dfs) {
-            statesToExplore.emplace_front(state, actualIndex);
+            statesToExplore.emplace_front(statesToExploreStorage.add(state), actualIndex);
 
             // Reserve one slot for the new state in the remapping.
             stateRemapping.get().push_back(storm::utility::zero<StateType>());
         } else if (options.explorationOrder == ExplorationOrder::Bfs) {
-            statesToExplore.emplace_back(state, actualIndex);
+            statesToExplore.emplace_back(statesToExploreStorage.add(state), actualIndex);
         } else {
             STORM_LOG_ASSERT(false, "Invalid exploration order.");
         }
@@ -146,6 +208,11 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
         stateAndChoiceInformationBuilder.stateValuationsBuilder() = generator->initializeStateValuationsBuilder();
     }
 
+    if (isParallelExplorationEnabled()) {
+        buildMatricesParallel(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder);
+        return;
+    }
+
     // Create a callback for the next-state generator to enable it to request the index of states.
     std::function<StateType(CompressedState const&)> stateToIdCallback =
         std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
@@ -171,10 +238,14 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint64_t numberOfExploredStates = 0;
     uint64_t numberOfExploredStatesSinceLastMessage = 0;
 
+    // The explored state is copied into this state, so that its storage can be reused for all states.
+    CompressedState currentState(generator->getStateSize());
+
     // Perform a search through the model.
     while (!statesToExplore.empty()) {
         // Get the first state in the queue.
-        CompressedState currentState = statesToExplore.front().first;
+        statesToExploreStorage.get(statesToExplore.front().first, currentState);
+        statesToExploreStorage.release(statesToExplore.front().first);
         StateType currentIndex = statesToExplore.front().second;
         statesToExplore.pop_front();
 
@@ -193,104 +264,8 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
         }
         storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
-
-        // If there is no behavior, we might have to introduce a self-loop.
-        if (behavior.empty()) {
-            if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                if (behavior.wasExpanded()) {
-                    this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                }
-
-                if (!generator->isDeterministicModel()) {
-                    transitionMatrixBuilder.newRowGroup(currentRow);
-                }
-
-                transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateRewards()) {
-                        rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                    }
-
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                    }
-                }
-
-                // This state shall be Markovian (to not introduce Zeno behavior)
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-                // Other state-based information does not need to be treated, in particular:
-                // * StateValuations have already been set above
-                // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-                ++currentRow;
-                ++currentRowGroup;
-            } else {
-                STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-            }
-        } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
-            }
-
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
-            }
-
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
-
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
-                }
-                ++currentRow;
-                firstChoiceOfState = false;
-            }
-
-            ++currentRowGroup;
-        }
+        addStateBehavior(currentState, currentIndex, behavior, nullptr, 0, transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder,
+                         currentRowGroup, currentRow);
 
         ++numberOfExploredStates;
         if (generator->getOptions().isShowProgressSet()) {
@@ -345,6 +320,328 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     }
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isParallelExplorationEnabled() const {
+    if (options.explorationThreads <= 1) {
+        return false;
+    }
+    if (options.explorationOrder != ExplorationOrder::Bfs) {
+        STORM_LOG_WARN("Parallel state-space exploration is only supported for breadth-first exploration. Falling back to sequential exploration.");
+        return false;
+    }
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        STORM_LOG_WARN("Parallel state-space exploration is not supported for parametric models. Falling back to sequential exploration.");
+        return false;
+    }
+    if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+        STORM_LOG_WARN("Parallel state-space exploration does not support labeling states with overlapping guards. Falling back to sequential exploration.");
+        return false;
+    }
+    if (!generator->isCloneable()) {
+        STORM_LOG_WARN("Parallel state-space exploration is not supported by the used next-state generator. Falling back to sequential exploration.");
+        return false;
+    }
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesParallel(
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder) {
+    uint64_t const numberOfWorkers = options.explorationThreads;
+#ifdef STORM_HAVE_INTELTBB
+    STORM_LOG_INFO("Exploring the state space with " << numberOfWorkers << " threads.");
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB. The state space is explored sequentially.");
+#endif
+
+    // Every worker exclusively uses its own generator. The first worker uses the generator of this builder.
+    std::vector<detail::ExplorationWorker<ValueType, StateType>> workers;
+    workers.reserve(numberOfWorkers);
+    workers.emplace_back(generator);
+    for (uint64_t workerIndex = 1; workerIndex < numberOfWorkers; ++workerIndex) {
+        workers.emplace_back(generator->clone());
+    }
+
+    // While a level is explored, the state storage is only read. States that are already stored there directly receive
+    // their final index, whereas newly discovered states receive a temporary index from a map that only holds the states
+    // discovered in the current level. Once all workers are done, the final indices of the new states are assigned
+    // sequentially in the order in which the sequential breadth-first search would discover them. The temporary indices
+    // start at the number of states stored before the level, so they can be distinguished from final indices.
+    auto createTemporaryIndices = [&]() {
+        return storm::storage::ConcurrentBitVectorHashMap<StateType>(generator->getStateSize(), 1000, 16 * numberOfWorkers);
+    };
+    storm::storage::ConcurrentBitVectorHashMap<StateType> temporaryIndices = createTemporaryIndices();
+    std::atomic<StateType> nextTemporaryIndex(0);
+    StateType firstTemporaryIndexOfLevel = 0;
+    StateType const unassignedIndex = std::numeric_limits<StateType>::max();
+    std::vector<StateType> temporaryToFinalIndex;
+
+    auto createStateToIdCallback = [this, &temporaryIndices, &nextTemporaryIndex](detail::ExplorationWorker<ValueType, StateType>& worker) {
+        return std::function<StateType(CompressedState const&)>([this, &temporaryIndices, &nextTemporaryIndex, &worker](CompressedState const& state) {
+            std::pair<bool, StateType> flagIndexPair = stateStorage.stateToId.find(state);
+            if (flagIndexPair.first) {
+                return flagIndexPair.second;
+            }
+            std::pair<StateType, bool> indexInsertedPair = temporaryIndices.findOrAddWith(state, [&nextTemporaryIndex]() { return nextTemporaryIndex++; });
+            if (indexInsertedPair.second) {
+                worker.newStates.emplace_back(indexInsertedPair.first, worker.newStateStorage.add(state));
+            }
+            worker.discoveredStates.push_back(indexInsertedPair.first);
+            return indexInsertedPair.first;
+        });
+    };
+
+    // The states of the level that is currently explored and of the next level. The state at position i of a level is
+    // stored under offset i. The storages are swapped (and thereby reused) after each level.
+    storm::storage::BitVectorArena currentLevelStorage(generator->getStateSize());
+    storm::storage::BitVectorArena nextLevelStorage(generator->getStateSize());
+    CompressedState state(generator->getStateSize());
+
+    // Assigns final indices to all states discovered by the workers, stores the ones that need to be explored next
+    // in the storage of the next level and returns their indices. Afterwards, temporaryToFinalIndex maps the temporary
+    // index firstTemporaryIndexOfLevel + i to its final index at position i.
+    auto assignFinalIndices = [&]() {
+        StateType const endOfLevel = nextTemporaryIndex.load();
+        temporaryToFinalIndex.assign(endOfLevel - firstTemporaryIndexOfLevel, unassignedIndex);
+
+        // The temporary indices of the states that were newly discovered are consecutive. For each of them, we store
+        // the worker that discovered it and the offset in the storage of that worker.
+        std::vector<std::pair<uint64_t, uint64_t>> newStates(endOfLevel - firstTemporaryIndexOfLevel);
+        for (uint64_t workerIndex = 0; workerIndex < numberOfWorkers; ++workerIndex) {
+            for (auto const& indexOffsetPair : workers[workerIndex].newStates) {
+                newStates[indexOffsetPair.first - firstTemporaryIndexOfLevel] = std::make_pair(workerIndex, indexOffsetPair.second);
+            }
+            workers[workerIndex].newStates.clear();
+        }
+
+        // The workers explored consecutive parts of the level, so iterating over them in order yields the discovery
+        // order of the sequential search.
+        nextLevelStorage.clear();
+        std::vector<StateType> statesOfNextLevel;
+        statesOfNextLevel.reserve(newStates.size());
+        for (auto& worker : workers) {
+            for (auto const& temporaryIndex : worker.discoveredStates) {
+                StateType& finalIndex = temporaryToFinalIndex[temporaryIndex - firstTemporaryIndexOfLevel];
+                if (finalIndex == unassignedIndex) {
+                    finalIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
+                    auto const& [workerIndex, offset] = newStates[temporaryIndex - firstTemporaryIndexOfLevel];
+                    workers[workerIndex].newStateStorage.get(offset, state);
+                    stateStorage.stateToId.findOrAdd(state, finalIndex);
+                    nextLevelStorage.add(state);
+                    statesOfNextLevel.push_back(finalIndex);
+                }
+            }
+            worker.discoveredStates.clear();
+        }
+        for (auto& worker : workers) {
+            worker.newStateStorage.clear();
+        }
+        return statesOfNextLevel;
+    };
+
+    // Prepares the exploration of the next level. All states discovered so far are in the state storage, so the map of
+    // temporary indices is replaced by an empty one.
+    auto startNextLevel = [&]() {
+        firstTemporaryIndexOfLevel = static_cast<StateType>(stateStorage.getNumberOfStates());
+        nextTemporaryIndex = firstTemporaryIndexOfLevel;
+        temporaryIndices = createTemporaryIndices();
+    };
+
+    // Let the generator create all initial states.
+    std::vector<StateType> initialStates = generator->getInitialStates(createStateToIdCallback(workers.front()));
+    STORM_LOG_THROW(!initialStates.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+    std::vector<StateType> currentLevel = assignFinalIndices();
+    std::swap(currentLevelStorage, nextLevelStorage);
+    for (auto const& temporaryIndex : initialStates) {
+        this->stateStorage.initialStateIndices.push_back(temporaryToFinalIndex[temporaryIndex]);
+    }
+
+    uint_fast64_t currentRowGroup = 0;
+    uint_fast64_t currentRow = 0;
+
+    auto timeOfStart = std::chrono::high_resolution_clock::now();
+    auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+    uint64_t numberOfExploredStates = 0;
+
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+    while (!currentLevel.empty()) {
+        // Explore the current level. Each worker takes care of a consecutive part of the level.
+        behaviors.clear();
+        behaviors.resize(currentLevel.size());
+        startNextLevel();
+        uint64_t const statesPerWorker = (currentLevel.size() + numberOfWorkers - 1) / numberOfWorkers;
+        detail::forEachWorker(numberOfWorkers, [&](uint64_t workerIndex) {
+            auto& worker = workers[workerIndex];
+            auto stateToIdCallback = createStateToIdCallback(worker);
+            uint64_t const end = std::min<uint64_t>(currentLevel.size(), (workerIndex + 1) * statesPerWorker);
+            for (uint64_t levelIndex = workerIndex * statesPerWorker; levelIndex < end; ++levelIndex) {
+                currentLevelStorage.get(levelIndex, worker.currentState);
+                worker.generator->load(worker.currentState);
+                behaviors[levelIndex] = worker.generator->expand(stateToIdCallback);
+            }
+        });
+        std::vector<StateType> nextLevel = assignFinalIndices();
+
+        // Add the behaviors in the order of the state indices.
+        for (uint64_t levelIndex = 0; levelIndex < currentLevel.size(); ++levelIndex) {
+            StateType const stateIndex = currentLevel[levelIndex];
+            currentLevelStorage.get(levelIndex, state);
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                generator->load(state);
+                generator->addStateValuation(stateIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+            }
+            addStateBehavior(state, stateIndex, behaviors[levelIndex], &temporaryToFinalIndex, firstTemporaryIndexOfLevel, transitionMatrixBuilder,
+                             rewardModelBuilders, stateAndChoiceInformationBuilder, currentRowGroup, currentRow);
+        }
+        numberOfExploredStates += currentLevel.size();
+
+        if (generator->getOptions().isShowProgressSet()) {
+            auto now = std::chrono::high_resolution_clock::now();
+            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+            if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (" << nextLevel.size()
+                          << " states in the next level).\n";
+                timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+            std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+
+        currentLevel = std::move(nextLevel);
+        std::swap(currentLevelStorage, nextLevelStorage);
+    }
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(
+    CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+    std::vector<StateType> const* columnRemapping, StateType firstRemappedColumn, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow) {
+    // If there is no behavior, we might have to introduce a self-loop.
+    if (behavior.empty()) {
+        if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+            // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+            if (behavior.wasExpanded()) {
+                this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+            }
+
+            if (!generator->isDeterministicModel()) {
+                transitionMatrixBuilder.newRowGroup(currentRow);
+            }
+
+            transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
+
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                }
+
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                }
+            }
+
+            // This state shall be Markovian (to not introduce Zeno behavior)
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+            // Other state-based information does not need to be treated, in particular:
+            // * StateValuations have already been set above
+            // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+            ++currentRow;
+            ++currentRowGroup;
+        } else {
+            STORM_LOG_THROW(false, storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(state) << "). For fixing these, please provide the appropriate option.");
+        }
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (auto& rewardModelBuilder : rewardModelBuilders) {
+            if (rewardModelBuilder.hasStateRewards()) {
+                rewardModelBuilder.addStateReward(*stateRewardIt);
+            }
+            ++stateRewardIt;
+        }
+
+        // If the model is nondeterministic, we need to open a row group.
+        if (!generator->isDeterministicModel()) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+
+        // Now add all choices.
+        std::vector<std::pair<StateType, ValueType>> remappedEntries;
+        bool firstChoiceOfState = true;
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+                for (auto const& label : choice.getLabels()) {
+                    stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+                stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+            }
+            if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+                STORM_LOG_ASSERT(
+                    firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                    "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+                if (firstChoiceOfState) {
+                    stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+                }
+            }
+            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
+                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+            }
+
+            // Add the probabilistic behavior to the matrix.
+            if (columnRemapping) {
+                // As the remapping does not preserve the order of the target states, we have to sort the entries again.
+                remappedEntries.clear();
+                for (auto const& stateProbabilityPair : choice) {
+                    StateType column = stateProbabilityPair.first;
+                    if (column >= firstRemappedColumn) {
+                        column = (*columnRemapping)[column - firstRemappedColumn];
+                    }
+                    remappedEntries.emplace_back(column, stateProbabilityPair.second);
+                }
+                std::sort(remappedEntries.begin(), remappedEntries.end(),
+                          [](std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                for (auto const& stateProbabilityPair : remappedEntries) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            } else {
+                for (auto const& stateProbabilityPair : choice) {
+                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                }
+            }
+
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                }
+                ++choiceRewardIt;
+            }
+            ++currentRow;
+            firstChoiceOfState = false;
+        }
+
+        ++currentRowGroup;
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
     // Determine whether we have to combine different choices to one or whether this model can have more than
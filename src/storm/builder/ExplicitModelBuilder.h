@@ -16,6 +16,7 @@
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/storage/BitVectorArena.h"
 #include "storm/storage/BitVectorHashMap.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
@@ -78,6 +79,9 @@ class ExplicitModelBuilder {
 
         // The order in which to explore the model.
         ExplorationOrder explorationOrder;
+
+        // The number of threads used to explore the model. Only breadth-first exploration is parallelized.
+        uint64_t explorationThreads;
     };
 
     /*!
@@ -144,6 +148,42 @@ class ExplicitModelBuilder {
                        std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
                        StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
 
+    /*!
+     * Retrieves whether the state space is to be explored by several threads. If parallel exploration was
+     * requested but is not possible for the current configuration, a warning is issued and false is returned.
+     */
+    bool isParallelExplorationEnabled() const;
+
+    /*!
+     * Explores the state space with several threads in a level-synchronous breadth-first search. The states are
+     * numbered exactly as in the sequential breadth-first search, so the resulting matrices coincide.
+     *
+     * @param transitionMatrixBuilder The builder of the transition matrix.
+     * @param rewardModelBuilders The builders for the selected reward models.
+     * @param stateAndChoiceInformationBuilder The builder for the requested information of the individual states and choices
+     */
+    void buildMatricesParallel(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                               std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                               StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder);
+
+    /*!
+     * Adds the behavior of the given state to the builders.
+     *
+     * @param state The state whose behavior is added.
+     * @param stateIndex The index of the state.
+     * @param behavior The behavior of the state.
+     * @param columnRemapping If given, the target states of all choices are translated via this mapping first.
+     * @param firstRemappedColumn Only target states with at least this index are translated. The target state i is
+     * translated to the entry at position i - firstRemappedColumn of the mapping.
+     * @param currentRowGroup The row group of the state. Is increased by this method.
+     * @param currentRow The first row of the state. Is increased by the number of added rows.
+     */
+    void addStateBehavior(CompressedState const& state, StateType stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                          std::vector<StateType> const* columnRemapping, StateType firstRemappedColumn,
+                          storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                          std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                          StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow);
+
     /*!
      * Explores the state space of the given program and returns the components of the model as a result.
      *
@@ -167,8 +207,11 @@ class ExplicitModelBuilder {
     /// Internal information about the states that were explored.
     storm::storage::sparse::StateStorage<StateType> stateStorage;
 
-    /// A set of states that still need to be explored.
-    std::deque<std::pair<CompressedState, StateType>> statesToExplore;
+    /// The storage of the states that still need to be explored.
+    storm::storage::BitVectorArena statesToExploreStorage;
+
+    /// A set of states that still need to be explored, given by their offset in the storage and their index.
+    std::deque<std::pair<uint64_t, StateType>> statesToExplore;
 
     /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
     /// built in case the exploration order is not BFS.
@@ -16,6 +16,9 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    ltlOnTheFlyProduct = mcSettings.isLtlOnTheFlyProductSet();
+    numberOfGraphThreads = mcSettings.getNumberOfGraphThreads();
+    hybridAcyclicLayers = mcSettings.isHybridAcyclicLayersSet() ? mcSettings.getHybridAcyclicLayers() : 0;
 }
 
 ModelCheckerEnvironment::~ModelCheckerEnvironment() {
@@ -46,4 +49,29 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+bool ModelCheckerEnvironment::isLtlOnTheFlyProductSet() const {
+    return ltlOnTheFlyProduct;
+}
+
+void ModelCheckerEnvironment::setLtlOnTheFlyProduct(bool value) {
+    ltlOnTheFlyProduct = value;
+}
+
+uint64_t ModelCheckerEnvironment::getNumberOfGraphThreads() const {
+    return numberOfGraphThreads;
+}
+
+void ModelCheckerEnvironment::setNumberOfGraphThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidEnvironmentException, "The number of graph threads must be positive.");
+    numberOfGraphThreads = value;
+}
+
+uint64_t ModelCheckerEnvironment::getHybridAcyclicLayers() const {
+    return hybridAcyclicLayers;
+}
+
+void ModelCheckerEnvironment::setHybridAcyclicLayers(uint64_t value) {
+    hybridAcyclicLayers = value;
+}
+
 }  // namespace storm
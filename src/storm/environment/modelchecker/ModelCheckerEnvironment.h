@@ -25,8 +25,23 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    bool isLtlOnTheFlyProductSet() const;
+    void setLtlOnTheFlyProduct(bool value);
+
+    uint64_t getNumberOfGraphThreads() const;
+    void setNumberOfGraphThreads(uint64_t value);
+
+    /*!
+     * The maximal number of acyclic layers that the hybrid engine solves symbolically. Zero disables this.
+     */
+    uint64_t getHybridAcyclicLayers() const;
+    void setHybridAcyclicLayers(uint64_t value);
+
    private:
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
+    bool ltlOnTheFlyProduct;
+    uint64_t numberOfGraphThreads;
+    uint64_t hybridAcyclicLayers;
 };
 }  // namespace storm
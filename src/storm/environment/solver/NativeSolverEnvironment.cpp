@@ -26,6 +26,11 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    if (nativeSettings.isParallelChunkSizeSet()) {
+        parallelChunkSize = nativeSettings.getParallelChunkSize();
+    } else {
+        parallelChunkSize = 0;
+    }
 }
 
 NativeSolverEnvironment::~NativeSolverEnvironment() {
@@ -93,4 +98,12 @@ void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+uint64_t const& NativeSolverEnvironment::getParallelChunkSize() const {
+    return parallelChunkSize;
+}
+
+void NativeSolverEnvironment::setParallelChunkSize(uint64_t value) {
+    parallelChunkSize = value;
+}
+
 }  // namespace storm
@@ -15,6 +15,8 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
 
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
+
+    numberOfThreads = topologicalSettings.getNumberOfThreads();
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -51,4 +53,13 @@ void TopologicalSolverEnvironment::setUnderlyingMinMaxMethod(storm::solver::MinM
     underlyingMinMaxMethod = value;
 }
 
+uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+    numberOfThreads = value;
+}
+
 }  // namespace storm
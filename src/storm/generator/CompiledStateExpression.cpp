@@ -0,0 +1,473 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace generator {
+
+namespace {
+bool compare(double first, storm::expressions::RelationType relation, double second) {
+    switch (relation) {
+        case storm::expressions::RelationType::Equal:
+            return first == second;
+        case storm::expressions::RelationType::NotEqual:
+            return first != second;
+        case storm::expressions::RelationType::Less:
+            return first < second;
+        case storm::expressions::RelationType::LessOrEqual:
+            return first <= second;
+        case storm::expressions::RelationType::Greater:
+            return first > second;
+        case storm::expressions::RelationType::GreaterOrEqual:
+            return first >= second;
+    }
+    return false;
+}
+
+storm::expressions::RelationType mirror(storm::expressions::RelationType relation) {
+    switch (relation) {
+        case storm::expressions::RelationType::Less:
+            return storm::expressions::RelationType::Greater;
+        case storm::expressions::RelationType::LessOrEqual:
+            return storm::expressions::RelationType::GreaterOrEqual;
+        case storm::expressions::RelationType::Greater:
+            return storm::expressions::RelationType::Less;
+        case storm::expressions::RelationType::GreaterOrEqual:
+            return storm::expressions::RelationType::LessOrEqual;
+        default:
+            return relation;
+    }
+}
+}  // namespace
+
+bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+    return evaluateAsDouble(state) == 1.0;
+}
+
+int64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+    return static_cast<int64_t>(evaluateAsDouble(state));
+}
+
+double CompiledStateExpression::evaluateAsDouble(CompressedState const& state) const {
+    // The first entry of the stack is never used, so top always points into the stack.
+    double* top = stack.data();
+    uint64_t const numberOfInstructions = instructions.size();
+    for (uint64_t position = 0; position < numberOfInstructions; ++position) {
+        Instruction const& instruction = instructions[position];
+        switch (instruction.opCode) {
+            case OpCode::PushConstant:
+                *++top = instruction.value;
+                break;
+            case OpCode::LoadBoolean:
+                *++top = state.get(instruction.bitOffsetOrTarget) ? 1.0 : 0.0;
+                break;
+            case OpCode::LoadInteger:
+                *++top = static_cast<double>(state.getAsInt(instruction.bitOffsetOrTarget, instruction.bitWidth)) + instruction.value;
+                break;
+            case OpCode::CompareInteger:
+                *++top = compare(static_cast<double>(state.getAsInt(instruction.bitOffsetOrTarget, instruction.bitWidth)) + instruction.lowerBound,
+                                 instruction.relation, instruction.value)
+                             ? 1.0
+                             : 0.0;
+                break;
+            case OpCode::Negate:
+                *top = -*top;
+                break;
+            case OpCode::Not:
+                *top = *top == 0.0 ? 1.0 : 0.0;
+                break;
+            case OpCode::Floor:
+                *top = std::floor(*top);
+                break;
+            case OpCode::Ceil:
+                *top = std::ceil(*top);
+                break;
+            case OpCode::ToBoolean:
+                *top = *top != 0.0 ? 1.0 : 0.0;
+                break;
+            case OpCode::Plus:
+                --top;
+                *top += top[1];
+                break;
+            case OpCode::Minus:
+                --top;
+                *top -= top[1];
+                break;
+            case OpCode::Times:
+                --top;
+                *top *= top[1];
+                break;
+            case OpCode::Divide:
+                --top;
+                *top /= top[1];
+                break;
+            case OpCode::Power:
+                --top;
+                *top = std::pow(*top, top[1]);
+                break;
+            case OpCode::Modulo:
+                --top;
+                *top = std::fmod(*top, top[1]);
+                break;
+            case OpCode::Min:
+                --top;
+                *top = std::min(*top, top[1]);
+                break;
+            case OpCode::Max:
+                --top;
+                *top = std::max(*top, top[1]);
+                break;
+            case OpCode::Xor:
+                --top;
+                *top = (*top == 0.0) != (top[1] == 0.0) ? 1.0 : 0.0;
+                break;
+            case OpCode::Equal:
+                --top;
+                *top = *top == top[1] ? 1.0 : 0.0;
+                break;
+            case OpCode::NotEqual:
+                --top;
+                *top = *top != top[1] ? 1.0 : 0.0;
+                break;
+            case OpCode::Less:
+                --top;
+                *top = *top < top[1] ? 1.0 : 0.0;
+                break;
+            case OpCode::LessOrEqual:
+                --top;
+                *top = *top <= top[1] ? 1.0 : 0.0;
+                break;
+            case OpCode::Greater:
+                --top;
+                *top = *top > top[1] ? 1.0 : 0.0;
+                break;
+            case OpCode::GreaterOrEqual:
+                --top;
+                *top = *top >= top[1] ? 1.0 : 0.0;
+                break;
+            case OpCode::Jump:
+                position = instruction.bitOffsetOrTarget - 1;
+                break;
+            case OpCode::JumpIfFalse:
+                if (*top-- == 0.0) {
+                    position = instruction.bitOffsetOrTarget - 1;
+                }
+                break;
+            case OpCode::JumpIfFalseOrPop:
+                // The value (which is false) remains on the stack as the result of the conjunction.
+                if (*top == 0.0) {
+                    position = instruction.bitOffsetOrTarget - 1;
+                } else {
+                    --top;
+                }
+                break;
+            case OpCode::JumpIfTrueOrPop:
+                // The value (normalized to true) remains on the stack as the result of the disjunction.
+                if (*top != 0.0) {
+                    *top = 1.0;
+                    position = instruction.bitOffsetOrTarget - 1;
+                } else {
+                    --top;
+                }
+                break;
+        }
+    }
+    STORM_LOG_ASSERT(top == stack.data() + 1, "Expected exactly one value on the stack after evaluating a compiled expression.");
+    return *top;
+}
+
+uint64_t CompiledStateExpression::getNumberOfInstructions() const {
+    return instructions.size();
+}
+
+/*!
+ * Emits the instructions of an expression in a postorder traversal of the expression. As soon as an unsupported
+ * subexpression is encountered, the emitter stops emitting instructions.
+ */
+class StateExpressionCompiler::InstructionEmitter : public storm::expressions::ExpressionVisitor {
+   public:
+    typedef CompiledStateExpression::OpCode OpCode;
+    typedef CompiledStateExpression::Instruction Instruction;
+
+    InstructionEmitter(std::unordered_map<uint64_t, VariableLocation> const& variableLocations)
+        : variableLocations(variableLocations), supported(true), stackSize(0), maximalStackSize(0) {
+        // Intentionally left empty.
+    }
+
+    std::optional<CompiledStateExpression> emit(storm::expressions::Expression const& expression) {
+        expression.getBaseExpression().accept(*this, boost::none);
+        if (!supported) {
+            return std::nullopt;
+        }
+        STORM_LOG_ASSERT(stackSize == 1, "Unexpected stack size after compiling expression " << expression << ".");
+        CompiledStateExpression result;
+        result.instructions = std::move(instructions);
+        result.stack.resize(maximalStackSize + 1);
+        return result;
+    }
+
+    virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override {
+        expression.getCondition()->accept(*this, data);
+        uint64_t const jumpToElse = emitJump(OpCode::JumpIfFalse, -1);
+        expression.getThenExpression()->accept(*this, data);
+        uint64_t const jumpToEnd = emitJump(OpCode::Jump, 0);
+        // Only one of the branches pushes its value.
+        --stackSize;
+        setJumpTarget(jumpToElse);
+        expression.getElseExpression()->accept(*this, data);
+        setJumpTarget(jumpToEnd);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::BinaryBooleanFunctionExpression::OperatorType OperatorType;
+        switch (expression.getOperatorType()) {
+            case OperatorType::And:
+            case OperatorType::Or: {
+                // The second operand is only evaluated if the first one does not already determine the result.
+                expression.getFirstOperand()->accept(*this, data);
+                uint64_t const jump =
+                    emitJump(expression.getOperatorType() == OperatorType::And ? OpCode::JumpIfFalseOrPop : OpCode::JumpIfTrueOrPop, -1);
+                expression.getSecondOperand()->accept(*this, data);
+                emit(OpCode::ToBoolean, 0);
+                setJumpTarget(jump);
+                break;
+            }
+            case OperatorType::Implies: {
+                expression.getFirstOperand()->accept(*this, data);
+                emit(OpCode::Not, 0);
+                uint64_t const jump = emitJump(OpCode::JumpIfTrueOrPop, -1);
+                expression.getSecondOperand()->accept(*this, data);
+                emit(OpCode::ToBoolean, 0);
+                setJumpTarget(jump);
+                break;
+            }
+            case OperatorType::Xor:
+                emitBinary(expression, OpCode::Xor, data);
+                break;
+            case OperatorType::Iff:
+                emitBinary(expression, OpCode::Equal, data);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::BinaryNumericalFunctionExpression::OperatorType OperatorType;
+        switch (expression.getOperatorType()) {
+            case OperatorType::Plus:
+                emitBinary(expression, OpCode::Plus, data);
+                break;
+            case OperatorType::Minus:
+                emitBinary(expression, OpCode::Minus, data);
+                break;
+            case OperatorType::Times:
+                emitBinary(expression, OpCode::Times, data);
+                break;
+            case OperatorType::Divide:
+                emitBinary(expression, OpCode::Divide, data);
+                break;
+            case OperatorType::Power:
+                emitBinary(expression, OpCode::Power, data);
+                break;
+            case OperatorType::Modulo:
+                emitBinary(expression, OpCode::Modulo, data);
+                break;
+            case OperatorType::Min:
+                emitBinary(expression, OpCode::Min, data);
+                break;
+            case OperatorType::Max:
+                emitBinary(expression, OpCode::Max, data);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override {
+        // Comparisons of an integer variable with a constant are the most common guards, so they get a dedicated instruction.
+        if (tryEmitComparison(*expression.getFirstOperand(), expression.getRelationType(), *expression.getSecondOperand()) ||
+            tryEmitComparison(*expression.getSecondOperand(), mirror(expression.getRelationType()), *expression.getFirstOperand())) {
+            return boost::any();
+        }
+        switch (expression.getRelationType()) {
+            case storm::expressions::RelationType::Equal:
+                emitBinary(expression, OpCode::Equal, data);
+                break;
+            case storm::expressions::RelationType::NotEqual:
+                emitBinary(expression, OpCode::NotEqual, data);
+                break;
+            case storm::expressions::RelationType::Less:
+                emitBinary(expression, OpCode::Less, data);
+                break;
+            case storm::expressions::RelationType::LessOrEqual:
+                emitBinary(expression, OpCode::LessOrEqual, data);
+                break;
+            case storm::expressions::RelationType::Greater:
+                emitBinary(expression, OpCode::Greater, data);
+                break;
+            case storm::expressions::RelationType::GreaterOrEqual:
+                emitBinary(expression, OpCode::GreaterOrEqual, data);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+        auto locationIt = variableLocations.find(expression.getVariable().getIndex());
+        if (locationIt == variableLocations.end()) {
+            supported = false;
+            return boost::any();
+        }
+        VariableLocation const& location = locationIt->second;
+        Instruction instruction = createInstruction(OpCode::LoadBoolean);
+        instruction.bitOffsetOrTarget = location.bitOffset;
+        if (!location.isBoolean) {
+            if (location.bitWidth == 0) {
+                instruction.opCode = OpCode::PushConstant;
+            } else {
+                instruction.opCode = OpCode::LoadInteger;
+                instruction.bitWidth = static_cast<uint32_t>(location.bitWidth);
+            }
+            instruction.value = static_cast<double>(location.lowerBound);
+        }
+        emit(instruction, 1);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override {
+        expression.getOperand()->accept(*this, data);
+        emit(OpCode::Not, 0);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override {
+        typedef storm::expressions::UnaryNumericalFunctionExpression::OperatorType OperatorType;
+        expression.getOperand()->accept(*this, data);
+        switch (expression.getOperatorType()) {
+            case OperatorType::Minus:
+                emit(OpCode::Negate, 0);
+                break;
+            case OperatorType::Floor:
+                emit(OpCode::Floor, 0);
+                break;
+            case OperatorType::Ceil:
+                emit(OpCode::Ceil, 0);
+                break;
+        }
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+        emitConstant(expression.getValue() ? 1.0 : 0.0);
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+        emitConstant(static_cast<double>(expression.getValue()));
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+        emitConstant(expression.getValueAsDouble());
+        return boost::any();
+    }
+
+    virtual boost::any visit(storm::expressions::PredicateExpression const&, boost::any const&) override {
+        supported = false;
+        return boost::any();
+    }
+
+   private:
+    static Instruction createInstruction(OpCode opCode) {
+        return Instruction{opCode, storm::expressions::RelationType::Equal, 0, 0, 0.0, 0.0};
+    }
+
+    void emit(Instruction const& instruction, int64_t stackSizeChange) {
+        if (!supported) {
+            return;
+        }
+        instructions.push_back(instruction);
+        stackSize += stackSizeChange;
+        maximalStackSize = std::max(maximalStackSize, stackSize);
+    }
+
+    void emit(OpCode opCode, int64_t stackSizeChange) {
+        emit(createInstruction(opCode), stackSizeChange);
+    }
+
+    void emitConstant(double value) {
+        Instruction instruction = createInstruction(OpCode::PushConstant);
+        instruction.value = value;
+        emit(instruction, 1);
+    }
+
+    // Emits a jump whose target needs to be set later and returns its position.
+    uint64_t emitJump(OpCode opCode, int64_t stackSizeChange) {
+        emit(opCode, stackSizeChange);
+        return instructions.size() - 1;
+    }
+
+    // Lets the jump at the given position target the next instruction that is emitted.
+    void setJumpTarget(uint64_t jumpPosition) {
+        if (supported) {
+            instructions[jumpPosition].bitOffsetOrTarget = instructions.size();
+        }
+    }
+
+    template<typename BinaryExpressionType>
+    void emitBinary(BinaryExpressionType const& expression, OpCode opCode, boost::any const& data) {
+        expression.getFirstOperand()->accept(*this, data);
+        expression.getSecondOperand()->accept(*this, data);
+        emit(opCode, -1);
+    }
+
+    bool tryEmitComparison(storm::expressions::BaseExpression const& variableOperand, storm::expressions::RelationType relation,
+                           storm::expressions::BaseExpression const& constantOperand) {
+        if (!variableOperand.isVariable() || !constantOperand.isLiteral() || constantOperand.hasBooleanType()) {
+            return false;
+        }
+        auto locationIt = variableLocations.find(variableOperand.asVariableExpression().getVariable().getIndex());
+        if (locationIt == variableLocations.end() || locationIt->second.isBoolean || locationIt->second.bitWidth == 0) {
+            return false;
+        }
+        Instruction instruction = createInstruction(OpCode::CompareInteger);
+        instruction.relation = relation;
+        instruction.bitOffsetOrTarget = locationIt->second.bitOffset;
+        instruction.bitWidth = static_cast<uint32_t>(locationIt->second.bitWidth);
+        instruction.value = constantOperand.evaluateAsDouble();
+        instruction.lowerBound = static_cast<double>(locationIt->second.lowerBound);
+        emit(instruction, 1);
+        return true;
+    }
+
+    std::unordered_map<uint64_t, VariableLocation> const& variableLocations;
+    std::vector<Instruction> instructions;
+    bool supported;
+    int64_t stackSize;
+    int64_t maximalStackSize;
+};
+
+StateExpressionCompiler::StateExpressionCompiler(VariableInformation const& variableInformation) {
+    for (auto const& locationVariable : variableInformation.locationVariables) {
+        variableLocations[locationVariable.variable.getIndex()] = {false, locationVariable.bitOffset, locationVariable.bitWidth, 0};
+    }
+    for (auto const& booleanVariable : variableInformation.booleanVariables) {
+        variableLocations[booleanVariable.variable.getIndex()] = {true, booleanVariable.bitOffset, 1, 0};
+    }
+    for (auto const& integerVariable : variableInformation.integerVariables) {
+        variableLocations[integerVariable.variable.getIndex()] = {false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound};
+    }
+}
+
+std::optional<CompiledStateExpression> StateExpressionCompiler::compile(storm::expressions::Expression const& expression) const {
+    return InstructionEmitter(variableLocations).emit(expression);
+}
+
+}  // namespace generator
+}  // namespace storm
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/BinaryRelationType.h"
+
+namespace storm {
+namespace expressions {
+class Expression;
+}
+
+namespace generator {
+
+struct VariableInformation;
+class StateExpressionCompiler;
+
+/*!
+ * An expression over the variables of a model that was compiled to a sequence of instructions. The instructions read
+ * the values of variables directly from the bits of a compressed state. Hence, evaluating the expression neither
+ * requires to unpack the state into an expression evaluator nor to traverse the expression.
+ *
+ * Just as for the exprtk-based expression evaluator, all values are represented as doubles.
+ *
+ * As the instructions operate on a stack owned by the expression, an expression must not be evaluated concurrently
+ * from several threads.
+ */
+class CompiledStateExpression {
+   public:
+    /*!
+     * Evaluates the expression in the given state and interprets the result as a boolean value.
+     */
+    bool evaluateAsBool(CompressedState const& state) const;
+
+    /*!
+     * Evaluates the expression in the given state and interprets the result as an integer value.
+     */
+    int64_t evaluateAsInt(CompressedState const& state) const;
+
+    /*!
+     * Evaluates the expression in the given state.
+     */
+    double evaluateAsDouble(CompressedState const& state) const;
+
+    /*!
+     * Retrieves the number of instructions of this expression.
+     */
+    uint64_t getNumberOfInstructions() const;
+
+   private:
+    friend class StateExpressionCompiler;
+
+    enum class OpCode : uint8_t {
+        PushConstant,
+        LoadBoolean,
+        LoadInteger,
+        CompareInteger,
+        Negate,
+        Not,
+        Floor,
+        Ceil,
+        ToBoolean,
+        Plus,
+        Minus,
+        Times,
+        Divide,
+        Power,
+        Modulo,
+        Min,
+        Max,
+        Xor,
+        Equal,
+        NotEqual,
+        Less,
+        LessOrEqual,
+        Greater,
+        GreaterOrEqual,
+        Jump,
+        JumpIfFalse,
+        JumpIfFalseOrPop,
+        JumpIfTrueOrPop
+    };
+
+    struct Instruction {
+        OpCode opCode;
+
+        // The relation of a CompareInteger instruction.
+        storm::expressions::RelationType relation;
+
+        // The bit width of the loaded variable.
+        uint32_t bitWidth;
+
+        // The bit offset of the loaded variable or the target of a jump.
+        uint64_t bitOffsetOrTarget;
+
+        // The pushed constant, the lower bound of the loaded variable or the constant a variable is compared with.
+        double value;
+
+        // The lower bound of the variable of a CompareInteger instruction.
+        double lowerBound;
+    };
+
+    CompiledStateExpression() = default;
+
+    // The instructions of this expression.
+    std::vector<Instruction> instructions;
+
+    // The stack on which the instructions operate. It is large enough to hold all intermediate values.
+    mutable std::vector<double> stack;
+};
+
+/*!
+ * Compiles expressions over the variables of a model into compiled state expressions.
+ */
+class StateExpressionCompiler {
+   public:
+    /*!
+     * Creates a compiler for expressions over the variables described by the given variable information.
+     */
+    StateExpressionCompiler(VariableInformation const& variableInformation);
+
+    /*!
+     * Compiles the given expression.
+     *
+     * @return The compiled expression or nothing if the expression contains variables that are not stored in the
+     * compressed states or operators that are not supported.
+     */
+    std::optional<CompiledStateExpression> compile(storm::expressions::Expression const& expression) const;
+
+   private:
+    struct VariableLocation {
+        bool isBoolean;
+        uint64_t bitOffset;
+        uint64_t bitWidth;
+        int64_t lowerBound;
+    };
+
+    class InstructionEmitter;
+
+    // The location within the compressed states of each variable, indexed by the index of the variable.
+    std::unordered_map<uint64_t, VariableLocation> variableLocations;
+};
+
+}  // namespace generator
+}  // namespace storm
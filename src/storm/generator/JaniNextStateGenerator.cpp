@@ -560,7 +560,11 @@ storm::storage::sparse::StateValuationsBuilder JaniNextStateGenerator<ValueType,
         result.addVariable(varInfo.variable);
     }
     for (auto const& varInfo : transientVariableInformation.integerVariableInformation) {
-        result.addVariable(varInfo.variable);
+        if (varInfo.lowerBound && varInfo.upperBound) {
+            result.addVariable(varInfo.variable, varInfo.lowerBound.get(), varInfo.upperBound.get());
+        } else {
+            result.addVariable(varInfo.variable);
+        }
     }
     for (auto const& varInfo : transientVariableInformation.rationalVariableInformation) {
         result.addVariable(varInfo.variable);
@@ -772,7 +776,8 @@ Choice<ValueType> JaniNextStateGenerator<ValueType, StateType>::expandNonSynchro
             int64_t assignmentLevel = edge.getLowestAssignmentLevel();  // Might be the largest possible integer, if there is no assignment
             int64_t const& highestLevel = edge.getHighestAssignmentLevel();
             bool hasTransientAssignments = destination.hasTransientAssignment();
-            CompressedState newState = state;
+            CompressedState& newState = successorState;
+            newState = state;
             applyUpdate(newState, destination, this->variableInformation.locationVariables[automatonIndex], assignmentLevel, *this->evaluator);
             if (hasTransientAssignments) {
                 STORM_LOG_ASSERT(this->options.isScaleAndLiftTransitionRewardsSet(),
@@ -888,7 +893,7 @@ void JaniNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribut
         destinations.clear();
         locationVars.clear();
         transientVariableValuation.clear();
-        CompressedState successorState = state;
+        successorState = state;
         ValueType successorProbability = storm::utility::one<ValueType>();
 
         uint64_t destinationIndex = destinationId;
@@ -1347,6 +1352,19 @@ void JaniNextStateGenerator<ValueType, StateType>::createSynchronizationInformat
     STORM_LOG_TRACE("Number of synchronizations: " << this->edges.size() << ".");
 }
 
+template<typename ValueType, typename StateType>
+bool JaniNextStateGenerator<ValueType, StateType>::isCloneable() const {
+    // The variable information of models with eliminated arrays depends on the original (unprocessed) model.
+    return arrayEliminatorData.eliminatedArrayVariables.empty();
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> JaniNextStateGenerator<ValueType, StateType>::clone() const {
+    STORM_LOG_THROW(isCloneable(), storm::exceptions::NotSupportedException, "Cannot clone a JANI next-state generator for a model with arrays.");
+    // The model has already been preprocessed, so we can directly use the delegate constructor.
+    return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new JaniNextStateGenerator<ValueType, StateType>(model, this->options, false));
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::storage::sparse::ChoiceOrigins> JaniNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(
     std::vector<boost::any>& dataForChoiceOrigins) const {
@@ -63,6 +63,9 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+    virtual bool isCloneable() const override;
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+
     /*!
      * Sets the values of all transient variables in the current state to the given evaluator.
      * @pre The values of non-transient variables have been set in the provided evaluator
@@ -231,6 +234,9 @@ class JaniNextStateGenerator : public NextStateGenerator<ValueType, StateType> {
 
     /// Information about the transient variables of the model.
     TransientVariableInformation<ValueType> transientVariableInformation;
+
+    /// The state in which successor states are created. Its storage is reused to avoid allocating a new state for each successor.
+    CompressedState successorState;
 };
 
 }  // namespace generator
@@ -1,5 +1,6 @@
 #include "storm/generator/NextStateGenerator.h"
 #include <storm/exceptions/NotImplementedException.h>
+#include <storm/exceptions/NotSupportedException.h>
 #include <storm/exceptions/WrongFormatException.h>
 
 #include "storm/adapters/JsonAdapter.h"
@@ -77,13 +78,13 @@ template<typename ValueType, typename StateType>
 storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder() const {
     storm::storage::sparse::StateValuationsBuilder result;
     for (auto const& v : variableInformation.locationVariables) {
-        result.addVariable(v.variable);
+        result.addVariable(v.variable, 0, static_cast<int64_t>(v.highestValue));
     }
     for (auto const& v : variableInformation.booleanVariables) {
         result.addVariable(v.variable);
     }
     for (auto const& v : variableInformation.integerVariables) {
-        result.addVariable(v.variable);
+        result.addVariable(v.variable, v.lowerBound, v.upperBound);
     }
     return result;
 }
@@ -98,7 +99,7 @@ storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, Sta
     }
     for (auto const& v : variableInformation.integerVariables) {
         if (v.observable) {
-            result.addVariable(v.variable);
+            result.addVariable(v.variable, v.lowerBound, v.upperBound);
         }
     }
     for (auto const& l : variableInformation.observationLabels) {
@@ -342,6 +343,16 @@ void NextStateGenerator<ValueType, StateType>::remapStateIds(std::function<State
     // Nothing to be done.
 }
 
+template<typename ValueType, typename StateType>
+bool NextStateGenerator<ValueType, StateType>::isCloneable() const {
+    return false;
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> NextStateGenerator<ValueType, StateType>::clone() const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This next-state generator can not be cloned.");
+}
+
 template class NextStateGenerator<double>;
 
 template class ActionMask<double>;
@@ -135,6 +135,22 @@ class NextStateGenerator {
      */
     void remapStateIds(std::function<StateType(StateType const&)> const& remapping);
 
+    /*!
+     * Retrieves whether this generator can be cloned, i.e., whether independent copies that can expand states
+     * concurrently to this generator can be created via clone().
+     */
+    virtual bool isCloneable() const;
+
+    /*!
+     * Creates a fresh generator that generates the same state space as this generator. The returned generator
+     * shares no mutable state with this generator and can thus be used to expand states concurrently. The
+     * implementation of this base class throws a NotSupportedException, so generators that return true in
+     * isCloneable() have to override this method.
+     *
+     * @pre isCloneable() holds.
+     */
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const;
+
    protected:
     /*!
      * Creates the state labeling for the given states using the provided labels and expressions.
@@ -15,6 +15,7 @@
 #include "storm/solver/SmtSolver.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
@@ -101,6 +102,12 @@ PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::pr
         moduleIndexToPlayerIndexMap = program.buildModuleIndexToPlayerIndexMap();
         actionIndexToPlayerIndexMap = program.buildActionIndexToPlayerIndexMap();
     }
+
+    successorStates.resize(std::max<uint64_t>(program.getNumberOfModules(), 1), CompressedState(this->getStateSize()));
+
+    if (this->options.isCompileExpressionsSet()) {
+        compileExpressions();
+    }
 }
 
 template<typename ValueType, typename StateType>
@@ -424,14 +431,74 @@ StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType
     return result;
 }
 
+template<typename ValueType, typename StateType>
+void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+    StateExpressionCompiler compiler(this->variableInformation);
+    uint64_t numberOfInstructions = 0;
+    uint64_t numberOfFailedCompilations = 0;
+    auto compile = [&](storm::expressions::Expression const& expression) {
+        std::optional<CompiledStateExpression> result = compiler.compile(expression);
+        if (result) {
+            numberOfInstructions += result->getNumberOfInstructions();
+        } else {
+            ++numberOfFailedCompilations;
+        }
+        return result;
+    };
+
+    for (auto const& module : program.getModules()) {
+        for (auto const& command : module.getCommands()) {
+            if (command.getGlobalIndex() >= compiledGuards.size()) {
+                compiledGuards.resize(command.getGlobalIndex() + 1);
+            }
+            compiledGuards[command.getGlobalIndex()] = compile(command.getGuardExpression());
+
+            for (auto const& update : command.getUpdates()) {
+                if (update.getGlobalIndex() >= compiledUpdates.size()) {
+                    compiledUpdates.resize(update.getGlobalIndex() + 1);
+                }
+                CompiledUpdate& compiledUpdate = compiledUpdates[update.getGlobalIndex()];
+                // Only likelihoods of floating point type are evaluated as doubles, so other types use the evaluator.
+                if constexpr (std::is_same<ValueType, double>::value) {
+                    compiledUpdate.likelihood = compile(update.getLikelihoodExpression());
+                }
+                for (auto const& assignment : update.getAssignments()) {
+                    compiledUpdate.assignments.push_back(compile(assignment.getExpression()));
+                }
+            }
+        }
+    }
+    STORM_LOG_DEBUG("Compiled expressions of the program to " << numberOfInstructions << " instructions (" << numberOfFailedCompilations
+                                                              << " expressions could not be compiled).");
+}
+
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::evaluateGuard(storm::prism::Command const& command) const {
+    if (!compiledGuards.empty() && compiledGuards[command.getGlobalIndex()]) {
+        return compiledGuards[command.getGlobalIndex()]->evaluateAsBool(*this->state);
+    }
+    return this->evaluator->asBool(command.getGuardExpression());
+}
+
+template<typename ValueType, typename StateType>
+ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateLikelihood(storm::prism::Update const& update) const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (!compiledUpdates.empty() && compiledUpdates[update.getGlobalIndex()].likelihood) {
+            return compiledUpdates[update.getGlobalIndex()].likelihood->evaluateAsDouble(*this->state);
+        }
+    }
+    return this->evaluator->asRational(update.getLikelihoodExpression());
+}
+
 template<typename ValueType, typename StateType>
 bool PrismNextStateGenerator<ValueType, StateType>::evaluateBooleanExpressionInCurrentState(expressions::Expression const& expr) const {
     return this->evaluator->asBool(expr);
 }
 
 template<typename ValueType, typename StateType>
-CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
-    CompressedState newState(state);
+CompressedState const& PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update,
+                                                                                   CompressedState& newState) {
+    newState = state;
 
     // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
     // assignments to boolean variables precede the assignments to all integer variables and that within the
@@ -441,13 +508,22 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
     auto assignmentIt = update.getAssignments().begin();
     auto assignmentIte = update.getAssignments().end();
 
+    // The compiled assignments (if any) are evaluated in the loaded state, just like the expressions in the evaluator.
+    std::vector<std::optional<CompiledStateExpression>> const* compiledAssignments =
+        compiledUpdates.empty() ? nullptr : &compiledUpdates[update.getGlobalIndex()].assignments;
+    uint64_t assignmentIndex = 0;
+
     // Iterate over all boolean assignments and carry them out.
     auto boolIt = this->variableInformation.booleanVariables.begin();
     for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
         while (assignmentIt->getVariable() != boolIt->variable) {
             ++boolIt;
         }
-        newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+        bool assignedValue = compiledAssignments && (*compiledAssignments)[assignmentIndex]
+                                 ? (*compiledAssignments)[assignmentIndex]->evaluateAsBool(*this->state)
+                                 : this->evaluator->asBool(assignmentIt->getExpression());
+        newState.set(boolIt->bitOffset, assignedValue);
+        ++assignmentIndex;
     }
 
     // Iterate over all integer assignments and carry them out.
@@ -456,7 +532,10 @@ CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(Compr
         while (assignmentIt->getVariable() != integerIt->variable) {
             ++integerIt;
         }
-        int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+        int_fast64_t assignedValue = compiledAssignments && (*compiledAssignments)[assignmentIndex]
+                                         ? (*compiledAssignments)[assignmentIndex]->evaluateAsInt(*this->state)
+                                         : this->evaluator->asInt(assignmentIt->getExpression());
+        ++assignmentIndex;
         if (this->options.isAddOutOfBoundsStateSet()) {
             if (assignedValue < integerIt->lowerBound || assignedValue > integerIt->upperBound) {
                 return this->outOfBoundsState;
@@ -531,7 +610,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (evaluateGuard(command)) {
                 // Found the first enabled command for this module.
                 hasOneEnabledCommand = true;
                 activeCommands.emplace_back(&module, &commandIndices, commandIndexIt);
@@ -565,7 +644,7 @@ PrismNextStateGenerator<ValueType, StateType>::getActiveCommandsByActionIndex(ui
                     continue;
                 }
             }
-            if (this->evaluator->asBool(command.getGuardExpression())) {
+            if (evaluateGuard(command)) {
                 commands.push_back(command);
             }
         }
@@ -608,7 +687,7 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             }
 
             // Skip the command, if it is not enabled.
-            if (!this->evaluator->asBool(command.getGuardExpression())) {
+            if (!evaluateGuard(command)) {
                 continue;
             }
 
@@ -626,11 +705,11 @@ std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::ge
             for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
                 storm::prism::Update const& update = command.getUpdate(k);
 
-                ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
+                ValueType probability = evaluateLikelihood(update);
                 if (probability != storm::utility::zero<ValueType>()) {
                     // Obtain target state index and add it to the list of known states. If it has not yet been
                     // seen, we also add it to the set of states that have yet to be explored.
-                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update, successorStates.front()));
 
                     // Update the choice by adding the probability/target state to it.
                     choice.addProbability(stateIndex, probability);
@@ -692,8 +771,9 @@ void PrismNextStateGenerator<ValueType, StateType>::generateSynchronizedDistribu
         storm::prism::Command const& command = *iteratorList[position];
         for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
             storm::prism::Update const& update = command.getUpdate(j);
-            generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()),
-                                             position + 1, iteratorList, distribution, stateToIdCallback);
+            generateSynchronizedDistribution(applyUpdate(state, update, successorStates[position]),
+                                             probability * evaluateLikelihood(update), position + 1, iteratorList, distribution,
+                                             stateToIdCallback);
         }
     }
 }
@@ -869,6 +949,19 @@ storm::builder::RewardModelInformation PrismNextStateGenerator<ValueType, StateT
                                                   rewardModel.hasTransitionRewards());
 }
 
+template<typename ValueType, typename StateType>
+bool PrismNextStateGenerator<ValueType, StateType>::isCloneable() const {
+    // An action mask may carry state that can not be shared among several generators.
+    return !this->actionMask;
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+    STORM_LOG_THROW(isCloneable(), storm::exceptions::NotSupportedException, "Cannot clone a PRISM next-state generator that uses an action mask.");
+    // The program has already been preprocessed, so we can directly use the delegate constructor.
+    return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new PrismNextStateGenerator<ValueType, StateType>(program, this->options, nullptr, false));
+}
+
 template<typename ValueType, typename StateType>
 std::shared_ptr<storm::storage::sparse::ChoiceOrigins> PrismNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(
     std::vector<boost::any>& dataForChoiceOrigins) const {
@@ -1,6 +1,9 @@
 #ifndef STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
+#include <optional>
+
+#include "storm/generator/CompiledStateExpression.h"
 #include "storm/generator/NextStateGenerator.h"
 
 #include "storm/storage/BoostTypes.h"
@@ -47,6 +50,9 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+    virtual bool isCloneable() const override;
+    virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+
    private:
     void checkValid() const;
 
@@ -63,9 +69,10 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
      * the given compressed state.
      * @params state The state to which to apply the new values.
      * @params update The update to apply.
-     * @return The resulting state.
+     * @params newState A state into which the result is written. Its storage is reused if it has the proper size.
+     * @return The resulting state, which is either the given new state or the out-of-bounds state.
      */
-    CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
+    CompressedState const& applyUpdate(CompressedState const& state, storm::prism::Update const& update, CompressedState& newState);
 
     /*!
      * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
@@ -125,6 +132,21 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
 
     bool isCommandPotentiallySynchronizing(prism::Command const& command) const;
 
+    /*!
+     * Compiles the guards and updates of all commands of the program (as far as possible).
+     */
+    void compileExpressions();
+
+    /*!
+     * Evaluates the guard of the given command in the currently loaded state.
+     */
+    bool evaluateGuard(storm::prism::Command const& command) const;
+
+    /*!
+     * Evaluates the likelihood of the given update in the currently loaded state.
+     */
+    ValueType evaluateLikelihood(storm::prism::Update const& update) const;
+
     // The program used for the generation of next states.
     storm::prism::Program program;
 
@@ -137,6 +159,24 @@ class PrismNextStateGenerator : public NextStateGenerator<ValueType, StateType>
     // Mappings from module/action indices to the programs players
     std::vector<storm::storage::PlayerIndex> moduleIndexToPlayerIndexMap;
     std::map<uint_fast64_t, storm::storage::PlayerIndex> actionIndexToPlayerIndexMap;
+
+    // The successor states are created in these states to avoid allocating a new state for each of them. There is
+    // one state per module, because synchronizing commands apply their updates one after another.
+    std::vector<CompressedState> successorStates;
+
+    struct CompiledUpdate {
+        // The compiled likelihood expression (if it could be compiled and the likelihood is a double).
+        std::optional<CompiledStateExpression> likelihood;
+
+        // The compiled expressions of the assignments in the order of the assignments of the update.
+        std::vector<std::optional<CompiledStateExpression>> assignments;
+    };
+
+    // If expressions are to be compiled, these store the compiled guards (indexed by the global index of the
+    // command) and the compiled updates (indexed by the global index of the update). Expressions that could not be
+    // compiled are evaluated with the evaluator instead.
+    std::vector<std::optional<CompiledStateExpression>> compiledGuards;
+    std::vector<CompiledUpdate> compiledUpdates;
 };
 
 }  // namespace generator
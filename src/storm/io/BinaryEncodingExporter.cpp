@@ -0,0 +1,174 @@
+#include "storm/io/BinaryEncodingExporter.h"
+
+#include <algorithm>
+#include <sstream>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace exporter {
+
+namespace {
+/*!
+ * Writes sizes, arrays, strings, bit vectors and matrices in the layout of the binary format.
+ */
+class BinaryWriter {
+   public:
+    BinaryWriter(std::ostream& os) : os(os) {
+        // Intentionally left empty.
+    }
+
+    void writeUint(uint64_t value) {
+        os.write(reinterpret_cast<char const*>(&value), sizeof(value));
+    }
+
+    template<typename T>
+    void writeVector(std::vector<T> const& vector) {
+        writeArray(vector.data(), vector.size());
+    }
+
+    template<typename T>
+    void writeArray(T const* data, uint64_t size) {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be written in binary format.");
+        writeUint(size);
+        uint64_t const numberOfBytes = size * sizeof(T);
+        os.write(reinterpret_cast<char const*>(data), numberOfBytes);
+        // Pad to the next multiple of 8 bytes
+        char const zeros[8] = {};
+        if (numberOfBytes % 8 != 0) {
+            os.write(zeros, 8 - numberOfBytes % 8);
+        }
+    }
+
+    void writeString(std::string const& str) {
+        writeArray(str.data(), str.size());
+    }
+
+    void writeBitVector(storm::storage::BitVector const& bitVector) {
+        writeUint(bitVector.size());
+        std::vector<uint64_t> buckets;
+        buckets.reserve((bitVector.size() + 63) / 64);
+        for (uint64_t bitIndex = 0; bitIndex < bitVector.size(); bitIndex += 64) {
+            buckets.push_back(bitVector.getAsInt(bitIndex, std::min<uint64_t>(64, bitVector.size() - bitIndex)));
+        }
+        writeVector(buckets);
+    }
+
+    void writeMatrix(storm::storage::SparseMatrix<double> const& matrix) {
+        using MatrixEntry = storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, double>;
+        static_assert(sizeof(MatrixEntry) == 16, "Unexpected size of matrix entries.");
+
+        writeUint(matrix.getColumnCount());
+        std::vector<uint64_t> rowIndications;
+        rowIndications.reserve(matrix.getRowCount() + 1);
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            rowIndications.push_back(matrix.begin(row) - matrix.begin());
+        }
+        uint64_t const numberOfEntries = matrix.end() - matrix.begin();
+        rowIndications.push_back(numberOfEntries);
+        writeVector(rowIndications);
+        writeArray(numberOfEntries == 0 ? nullptr : &*matrix.begin(), numberOfEntries);
+        writeUint(matrix.hasTrivialRowGrouping() ? 0 : 1);
+        if (!matrix.hasTrivialRowGrouping()) {
+            writeVector(matrix.getRowGroupIndices());
+        }
+    }
+
+    void writeLabeling(storm::models::sparse::StateLabeling const& labeling) {
+        std::set<std::string> labels = labeling.getLabels();
+        writeUint(labels.size());
+        for (auto const& label : labels) {
+            writeString(label);
+            writeBitVector(labeling.getStates(label));
+        }
+    }
+
+    void writeLabeling(storm::models::sparse::ChoiceLabeling const& labeling) {
+        std::set<std::string> labels = labeling.getLabels();
+        writeUint(labels.size());
+        for (auto const& label : labels) {
+            writeString(label);
+            writeBitVector(labeling.getChoices(label));
+        }
+    }
+
+   private:
+    std::ostream& os;
+};
+}  // namespace
+
+template<typename ValueType>
+void explicitExportSparseModelBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel) {
+    if constexpr (!std::is_same<ValueType, double>::value) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting models in binary format is only supported for models over doubles.");
+    } else {
+        STORM_LOG_THROW(sparseModel->getType() != storm::models::ModelType::S2pg && sparseModel->getType() != storm::models::ModelType::Smg,
+                        storm::exceptions::NotSupportedException, "Exporting games in binary format is not supported.");
+        STORM_LOG_WARN_COND(!sparseModel->hasStateValuations(), "State valuations are not exported in binary format.");
+        STORM_LOG_WARN_COND(!sparseModel->hasChoiceOrigins(), "Choice origins are not exported in binary format.");
+        BinaryWriter writer(os);
+
+        // Write header
+        os.write(binaryEncodingMagic, sizeof(binaryEncodingMagic));
+        writer.writeUint(binaryEncodingVersion);
+        writer.writeUint(binaryEncodingByteOrderMark);
+        std::stringstream modelType;
+        modelType << sparseModel->getType();
+        writer.writeString(modelType.str());
+
+        // Notice that for CTMCs we write the rate matrix instead of probabilities
+        writer.writeMatrix(sparseModel->getTransitionMatrix());
+        writer.writeLabeling(sparseModel->getStateLabeling());
+
+        writer.writeUint(sparseModel->getNumberOfRewardModels());
+        for (auto const& rewardModel : sparseModel->getRewardModels()) {
+            writer.writeString(rewardModel.first);
+            writer.writeUint(rewardModel.second.hasStateRewards() ? 1 : 0);
+            if (rewardModel.second.hasStateRewards()) {
+                writer.writeVector(rewardModel.second.getStateRewardVector());
+            }
+            writer.writeUint(rewardModel.second.hasStateActionRewards() ? 1 : 0);
+            if (rewardModel.second.hasStateActionRewards()) {
+                writer.writeVector(rewardModel.second.getStateActionRewardVector());
+            }
+            writer.writeUint(rewardModel.second.hasTransitionRewards() ? 1 : 0);
+            if (rewardModel.second.hasTransitionRewards()) {
+                writer.writeMatrix(rewardModel.second.getTransitionRewardMatrix());
+            }
+        }
+
+        writer.writeUint(sparseModel->hasChoiceLabeling() ? 1 : 0);
+        if (sparseModel->hasChoiceLabeling()) {
+            writer.writeLabeling(sparseModel->getChoiceLabeling());
+        }
+
+        // Write the components that are specific to the model type
+        if (sparseModel->getType() == storm::models::ModelType::Ctmc) {
+            writer.writeVector(sparseModel->template as<storm::models::sparse::Ctmc<ValueType>>()->getExitRateVector());
+        } else if (sparseModel->getType() == storm::models::ModelType::MarkovAutomaton) {
+            auto ma = sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>();
+            writer.writeVector(ma->getExitRates());
+            writer.writeBitVector(ma->getMarkovianStates());
+        } else if (sparseModel->getType() == storm::models::ModelType::Pomdp) {
+            writer.writeVector(sparseModel->template as<storm::models::sparse::Pomdp<ValueType>>()->getObservations());
+        }
+        STORM_LOG_THROW(os.good(), storm::exceptions::FileIoException, "Error while writing the model in binary format.");
+    }
+}
+
+// Template instantiations
+template void explicitExportSparseModelBinary<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel);
+template void explicitExportSparseModelBinary<storm::RationalNumber>(std::ostream& os,
+                                                                     std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> sparseModel);
+template void explicitExportSparseModelBinary<storm::RationalFunction>(std::ostream& os,
+                                                                       std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel);
+}  // namespace exporter
+}  // namespace storm
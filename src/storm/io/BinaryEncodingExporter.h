@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "storm/models/sparse/Model.h"
+
+namespace storm {
+namespace exporter {
+
+/// The first bytes of every file in the binary format.
+constexpr char binaryEncodingMagic[8] = {'S', 'T', 'O', 'R', 'M', 'B', 'I', 'N'};
+/// The version of the binary format. It has to be increased whenever the layout of the format changes.
+constexpr uint64_t binaryEncodingVersion = 1;
+/// Written in native byte order to detect files that were exported on a machine with a different endianness.
+constexpr uint64_t binaryEncodingByteOrderMark = 0x0102030405060708ull;
+
+/*!
+ * Exports a sparse model into a binary format that stores the raw arrays of the model (in native byte order), i.e.,
+ * - the transition matrix in compressed row format (row indications, column-value entries and row group indices),
+ * - the state labeling and the choice labeling as bit vectors,
+ * - the reward vectors and matrices,
+ * - the exit rates and Markovian states (for CTMCs and MAs) and the observations (for POMDPs).
+ * Every array is prefixed by its size and padded to a multiple of 8 bytes, such that it can be loaded with a single copy.
+ * State valuations and choice origins are not exported. Only models over doubles are supported.
+ *
+ * @param os           Stream to export to (has to be opened in binary mode)
+ * @param sparseModel  Model to export
+ */
+template<typename ValueType>
+void explicitExportSparseModelBinary(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel);
+
+}  // namespace exporter
+}  // namespace storm
@@ -25,6 +25,7 @@
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/FormatUnsupportedBySolverException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -268,6 +269,68 @@ std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
     return result;
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesAtTimePoints(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
+    std::vector<double> const& timePoints) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_THROW(std::is_sorted(timePoints.begin(), timePoints.end()), storm::exceptions::InvalidArgumentException, "The time points must be sorted.");
+    STORM_LOG_THROW(timePoints.empty() || (timePoints.front() >= 0 && timePoints.back() != storm::utility::infinity<double>()),
+                    storm::exceptions::InvalidArgumentException, "The time points must be non-negative and finite.");
+
+    uint_fast64_t numberOfStates = rateMatrix.getRowCount();
+    std::vector<std::vector<ValueType>> result;
+    result.reserve(timePoints.size());
+
+    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates);
+    storm::storage::BitVector statesWithProbabilityGreater0NonPsi = statesWithProbabilityGreater0 & ~psiStates;
+    STORM_LOG_INFO("Found " << statesWithProbabilityGreater0NonPsi.getNumberOfSetBits() << " 'maybe' states.");
+
+    std::vector<ValueType> psiResult(numberOfStates, storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues<ValueType>(psiResult, psiStates, storm::utility::one<ValueType>());
+    if (statesWithProbabilityGreater0NonPsi.empty()) {
+        result.assign(timePoints.size(), psiResult);
+        return result;
+    }
+
+    // Find the maximal rate of all 'maybe' states to take it as the uniformization rate.
+    ValueType uniformizationRate = 0;
+    for (auto state : statesWithProbabilityGreater0NonPsi) {
+        uniformizationRate = std::max(uniformizationRate, exitRates[state]);
+    }
+    uniformizationRate *= 1.02;
+    STORM_LOG_THROW(uniformizationRate > 0, storm::exceptions::InvalidStateException, "The uniformization rate must be positive.");
+
+    // Compute the uniformized matrix and the vector that is to be added as a compensation for removing the absorbing states.
+    storm::storage::SparseMatrix<ValueType> uniformizedMatrix =
+        computeUniformizedMatrix(rateMatrix, statesWithProbabilityGreater0NonPsi, uniformizationRate, exitRates);
+    std::vector<ValueType> b = rateMatrix.getConstrainedRowSumVector(statesWithProbabilityGreater0NonPsi, psiStates);
+    for (auto& element : b) {
+        element /= uniformizationRate;
+    }
+
+    // The transient probabilities of all time points are computed in a single batch, so the iterates are shared among the time points
+    // and the number of matrix multiplications only depends on the largest time point. As every time point is computed from the
+    // initial values, the truncation errors of different time points do not add up.
+    ValueType epsilon = storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision()) / 8.0;
+    std::vector<ValueType> timeBounds;
+    timeBounds.reserve(timePoints.size());
+    for (auto const& timePoint : timePoints) {
+        timeBounds.push_back(storm::utility::convertNumber<ValueType>(timePoint));
+    }
+    std::vector<std::vector<ValueType>> initialValues(1, std::vector<ValueType>(statesWithProbabilityGreater0NonPsi.getNumberOfSetBits(),
+                                                                                 storm::utility::zero<ValueType>()));
+    std::vector<std::vector<std::vector<ValueType>>> values =
+        computeBatchedTransientProbabilities(uniformizedMatrix, &b, timeBounds, uniformizationRate, initialValues, epsilon);
+    for (auto const& valuesOfTimePoint : values) {
+        result.push_back(psiResult);
+        storm::utility::vector::setVectorValues(result.back(), statesWithProbabilityGreater0NonPsi, valuesOfTimePoint.front());
+    }
+    return result;
+}
+
 template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
 std::vector<ValueType> SparseCtmcCslHelper::computeBoundedUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                              storm::storage::SparseMatrix<ValueType> const&,
@@ -738,6 +801,115 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType, bool useMixedPoissonProbabilities, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<std::vector<ValueType>>> SparseCtmcCslHelper::computeBatchedTransientProbabilities(
+    storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds,
+    ValueType uniformizationRate, std::vector<std::vector<ValueType>> const& values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+    // For mixed poisson probabilities, the iterates before the left truncation point are computed without the add vector. As the
+    // truncation points differ between the time bounds, these iterates cannot be shared.
+    STORM_LOG_THROW(!useMixedPoissonProbabilities || addVector == nullptr, storm::exceptions::InvalidArgumentException,
+                    "Batched transient probabilities with mixed poisson probabilities do not support an add vector.");
+    uint64_t const numberOfStates = uniformizedMatrix.getRowCount();
+    uint64_t const numberOfVectors = values.size();
+    std::vector<std::vector<std::vector<ValueType>>> result(
+        timeBounds.size(), std::vector<std::vector<ValueType>>(numberOfVectors, std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>())));
+    if (numberOfVectors == 0) {
+        return result;
+    }
+
+    // Use Fox-Glynn to get the truncation points and the weights for every time bound. If no time can pass, the
+    // initial values are the result.
+    std::vector<boost::optional<storm::utility::numerical::FoxGlynnResult<ValueType>>> foxGlynnResults(timeBounds.size());
+    uint64_t numberOfIterations = 0;
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        ValueType lambda = timeBounds[timeBoundIndex] * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            result[timeBoundIndex] = values;
+            continue;
+        }
+        foxGlynnResults[timeBoundIndex] = storm::utility::numerical::foxGlynn(lambda, epsilon);
+        auto& foxGlynnResult = foxGlynnResults[timeBoundIndex].get();
+        STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[timeBoundIndex] << ": left=" << foxGlynnResult.left
+                                                                  << ", right=" << foxGlynnResult.right);
+
+        // If the cumulative reward is to be computed, we need to adjust the weights.
+        if (useMixedPoissonProbabilities) {
+            ValueType sum = storm::utility::zero<ValueType>();
+            for (auto& element : foxGlynnResult.weights) {
+                sum += element;
+                element = (foxGlynnResult.totalWeight - sum) / uniformizationRate;
+            }
+        }
+        numberOfIterations = std::max<uint64_t>(numberOfIterations, foxGlynnResult.right);
+    }
+
+    // Store the vectors interleaved, so that a single pass over the matrix suffices to multiply all of them.
+    std::vector<ValueType> currentValues(numberOfStates * numberOfVectors);
+    for (uint64_t vectorIndex = 0; vectorIndex < numberOfVectors; ++vectorIndex) {
+        STORM_LOG_ASSERT(values[vectorIndex].size() == numberOfStates, "Initial vector has an unexpected size.");
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            currentValues[state * numberOfVectors + vectorIndex] = values[vectorIndex][state];
+        }
+    }
+    std::vector<ValueType> nextValues(currentValues.size());
+
+    // For mixed poisson probabilities, all iterates before the left truncation point contribute with the same weight.
+    // We therefore keep track of their sum.
+    std::vector<ValueType> sumOfPreviousValues;
+    if (useMixedPoissonProbabilities) {
+        sumOfPreviousValues.resize(currentValues.size(), storm::utility::zero<ValueType>());
+    }
+
+    auto addScaledValues = [&](std::vector<std::vector<ValueType>>& target, std::vector<ValueType> const& interleavedValues, ValueType const& weight) {
+        auto valueIt = interleavedValues.begin();
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            for (auto& targetVector : target) {
+                targetVector[state] += weight * *valueIt;
+                ++valueIt;
+            }
+        }
+    };
+
+    STORM_LOG_DEBUG("Starting " << numberOfIterations << " iterations with " << uniformizedMatrix.getRowCount() << " x "
+                                << uniformizedMatrix.getColumnCount() << " matrix and " << numberOfVectors << " vectors.");
+    for (uint64_t iteration = 0; iteration <= numberOfIterations; ++iteration) {
+        if (iteration > 0) {
+            uniformizedMatrix.multiplyWithVectors(currentValues, nextValues, numberOfVectors, addVector);
+            std::swap(currentValues, nextValues);
+        }
+
+        for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+            if (!foxGlynnResults[timeBoundIndex]) {
+                continue;
+            }
+            auto const& foxGlynnResult = foxGlynnResults[timeBoundIndex].get();
+            if (useMixedPoissonProbabilities && iteration == foxGlynnResult.left && iteration > 0) {
+                addScaledValues(result[timeBoundIndex], sumOfPreviousValues, foxGlynnResult.totalWeight / uniformizationRate);
+            }
+            if (iteration >= foxGlynnResult.left && iteration <= foxGlynnResult.right) {
+                addScaledValues(result[timeBoundIndex], currentValues, foxGlynnResult.weights[iteration - foxGlynnResult.left]);
+            }
+        }
+
+        if (useMixedPoissonProbabilities) {
+            storm::utility::vector::addVectors(sumOfPreviousValues, currentValues, sumOfPreviousValues);
+        }
+    }
+
+    // Finally, divide the results by the total weights.
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        if (foxGlynnResults[timeBoundIndex]) {
+            for (auto& resultVector : result[timeBoundIndex]) {
+                storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(
+                    resultVector, storm::utility::one<ValueType>() / foxGlynnResults[timeBoundIndex].get().totalWeight);
+            }
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -773,6 +945,11 @@ template std::vector<double> SparseCtmcCslHelper::computeBoundedUntilProbabiliti
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
     std::vector<double> const& exitRates, bool qualitative, double lowerBound, double upperBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeBoundedUntilProbabilitiesAtTimePoints(
+    Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates,
+    std::vector<double> const& timePoints);
+
 template std::vector<double> SparseCtmcCslHelper::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<double>&& goal,
                                                                             storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                             storm::storage::SparseMatrix<double> const& backwardTransitions,
@@ -834,6 +1011,16 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 storm::storage::SparseMatrix<double> const& uniformizedMatrix,
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
+template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities<double, true>(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, double timeBound,
+    double uniformizationRate, std::vector<double> values, double epsilon);
+
+template std::vector<std::vector<std::vector<double>>> SparseCtmcCslHelper::computeBatchedTransientProbabilities<double, false>(
+    storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds,
+    double uniformizationRate, std::vector<std::vector<double>> const& values, double epsilon);
+template std::vector<std::vector<std::vector<double>>> SparseCtmcCslHelper::computeBatchedTransientProbabilities<double, true>(
+    storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector, std::vector<double> const& timeBounds,
+    double uniformizationRate, std::vector<std::vector<double>> const& values, double epsilon);
 
 #ifdef STORM_HAVE_CARL
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeBoundedUntilProbabilities(
@@ -38,6 +38,20 @@ class SparseCtmcCslHelper {
                                                                    std::vector<ValueType> const& exitRates, bool qualitative, double lowerBound,
                                                                    double upperBound);
 
+    /*!
+     * Computes the probabilities of satisfying phi until psi within [0, t] for every given time point t. The
+     * transient probabilities of all time points are computed in a single batch (see computeBatchedTransientProbabilities),
+     * so the overall effort corresponds to a single computation for the largest time point.
+     *
+     * @param timePoints The (sorted) time points.
+     * @return For each time point, the probabilities of all states.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesAtTimePoints(
+        Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
+        std::vector<double> const& timePoints);
+
     template<typename ValueType>
     static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                             storm::storage::SparseMatrix<ValueType> const& rateMatrix,
@@ -142,6 +156,29 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for several time bounds and several initial vectors at once. All
+     * initial vectors are multiplied with the uniformized matrix together and the resulting iterates are shared by
+     * all time bounds, so the number of matrix multiplications only depends on the largest time bound.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. It is added for all initial vectors. If this is not supposed to be used, it can
+     * be set to nullptr. It must be nullptr if mixed poisson probabilities are used.
+     * @param timeBounds The time bounds to use.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values The vectors mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points
+     * @tparam useMixedPoissonProbabilities If set to true, instead of taking the poisson probabilities,  mixed
+     * poisson probabilities are used.
+     * @return For each time bound, the vectors of transient probabilities (in the order of the initial vectors).
+     */
+    template<typename ValueType, bool useMixedPoissonProbabilities = false,
+             typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<std::vector<ValueType>>> computeBatchedTransientProbabilities(
+        storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix, std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds,
+        ValueType uniformizationRate, std::vector<std::vector<ValueType>> const& values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
@@ -6,6 +6,7 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidOperationException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -487,12 +488,19 @@ class UnifPlusHelper {
     storm::storage::BitVector const& markovianStates;
 };
 
+/*!
+ * Performs the discretized value iteration of IMCA. The number of steps is given as a sorted list. Whenever one of
+ * these numbers is reached, the given callback (if any) is invoked with the current values, which allows to obtain
+ * the values for several step bounds in a single run.
+ */
 template<typename ValueType>
-void computeBoundedReachabilityProbabilitiesImca(Environment const& env, OptimizationDirection dir,
-                                                 storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates,
-                                                 storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates,
-                                                 storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues,
-                                                 std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, uint64_t numberOfSteps) {
+void computeBoundedReachabilityProbabilitiesImca(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, std::vector<ValueType> const& exitRates,
+    storm::storage::BitVector const& goalStates, storm::storage::BitVector const& markovianNonGoalStates,
+    storm::storage::BitVector const& probabilisticNonGoalStates, std::vector<ValueType>& markovianNonGoalValues,
+    std::vector<ValueType>& probabilisticNonGoalValues, ValueType delta, std::vector<uint64_t> const& numbersOfSteps,
+    std::function<void(std::vector<ValueType> const&, std::vector<ValueType> const&)> const& stepBoundReached = {}) {
+    STORM_LOG_ASSERT(!numbersOfSteps.empty() && std::is_sorted(numbersOfSteps.begin(), numbersOfSteps.end()), "Expected sorted step bounds.");
     // Start by computing four sparse matrices:
     // * a matrix aMarkovian with all (discretized) transitions from Markovian non-goal states to all Markovian non-goal states.
     // * a matrix aMarkovianToProbabilistic with all (discretized) transitions from Markovian non-goal states to all probabilistic non-goal states.
@@ -563,13 +571,15 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
     auto solver = setUpProbabilisticStatesSolver(solverEnv, dir, aProbabilistic);
 
     // Perform the actual value iteration
-    // * loop until the step bound has been reached
+    // * loop until the (largest) step bound has been reached
     // * in the loop:
     // *    perform value iteration using A_PSwG, v_PS and the vector b where b = (A * 1_G)|PS + A_PStoMS * v_MS
     //      and 1_G being the characteristic vector for all goal states.
+    // *    if a step bound is reached, report the current values
     // *    perform one timed-step using v_MS := A_MSwG * v_MS + A_MStoPS * v_PS + (A * 1_G)|MS
     std::vector<ValueType> markovianNonGoalValuesSwap(markovianNonGoalValues);
-    for (uint64_t currentStep = 0; currentStep < numberOfSteps; ++currentStep) {
+    auto stepBoundIt = numbersOfSteps.begin();
+    for (uint64_t currentStep = 0;; ++currentStep) {
         if (existProbabilisticStates) {
             // Start by (re-)computing bProbabilistic = bProbabilisticFixed + aProbabilisticToMarkovian * vMarkovian.
             aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
@@ -587,6 +597,17 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
             storm::utility::vector::addVectors(bMarkovian, bMarkovianFixed, bMarkovian);
         }
 
+        // If we are asked to terminate, the current values are reported for all remaining step bounds.
+        bool terminate = storm::utility::resources::isTerminate();
+        for (; stepBoundIt != numbersOfSteps.end() && (*stepBoundIt == currentStep || terminate); ++stepBoundIt) {
+            if (stepBoundReached) {
+                stepBoundReached(markovianNonGoalValues, probabilisticNonGoalValues);
+            }
+        }
+        if (stepBoundIt == numbersOfSteps.end()) {
+            break;
+        }
+
         aMarkovian.multiplyWithVector(markovianNonGoalValues, markovianNonGoalValuesSwap);
         std::swap(markovianNonGoalValues, markovianNonGoalValuesSwap);
         if (existProbabilisticStates) {
@@ -594,20 +615,6 @@ void computeBoundedReachabilityProbabilitiesImca(Environment const& env, Optimiz
         } else {
             storm::utility::vector::addVectors(markovianNonGoalValues, bMarkovianFixed, markovianNonGoalValues);
         }
-        if (storm::utility::resources::isTerminate()) {
-            break;
-        }
-    }
-
-    if (existProbabilisticStates) {
-        // After the loop, perform one more step of the value iteration for PS states.
-        aProbabilisticToMarkovian.multiplyWithVector(markovianNonGoalValues, bProbabilistic);
-        storm::utility::vector::addVectors(bProbabilistic, bProbabilisticFixed, bProbabilistic);
-        if (solver) {
-            solver->solveEquations(solverEnv, dir, probabilisticNonGoalValues, bProbabilistic);
-        } else {
-            storm::utility::vector::reduceVectorMinOrMax(dir, bProbabilistic, probabilisticNonGoalValues, aProbabilistic.getRowGroupIndices());
-        }
     }
 }
 
@@ -644,7 +651,7 @@ std::vector<ValueType> computeBoundedUntilProbabilitiesImca(Environment const& e
     std::vector<ValueType> vMarkovian(markovianNonGoalStates.getNumberOfSetBits());
 
     computeBoundedReachabilityProbabilitiesImca(env, dir, transitionMatrix, exitRateVector, psiStates, markovianNonGoalStates, probabilisticNonGoalStates,
-                                                vMarkovian, vProbabilistic, delta, numberOfSteps);
+                                                vMarkovian, vProbabilistic, delta, {numberOfSteps});
 
     // (4) If the lower bound of interval was non-zero, we need to take the current values as the starting values for a subsequent value iteration.
     if (lowerBound != storm::utility::zero<ValueType>()) {
@@ -663,7 +670,7 @@ std::vector<ValueType> computeBoundedUntilProbabilitiesImca(Environment const& e
 
         // Compute the bounded reachability for interval [0, b-a].
         computeBoundedReachabilityProbabilitiesImca(env, dir, transitionMatrix, exitRateVector, storm::storage::BitVector(numberOfStates), markovianStates,
-                                                    ~markovianStates, vAllMarkovian, vAllProbabilistic, delta, numberOfSteps);
+                                                    ~markovianStates, vAllMarkovian, vAllProbabilistic, delta, {numberOfSteps});
 
         // Create the result vector out of vAllProbabilistic and vAllMarkovian and return it.
         std::vector<ValueType> result(numberOfStates, storm::utility::zero<ValueType>());
@@ -716,6 +723,64 @@ std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbab
     }
 }
 
+template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
+std::vector<std::vector<ValueType>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesAtTimePoints(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates, std::vector<double> const& timePoints) {
+    STORM_LOG_THROW(!env.solver().isForceExact(), storm::exceptions::InvalidOperationException,
+                    "Exact computations not possible for bounded until probabilities.");
+    STORM_LOG_THROW(std::is_sorted(timePoints.begin(), timePoints.end()), storm::exceptions::InvalidArgumentException, "The time points must be sorted.");
+    STORM_LOG_THROW(timePoints.empty() || (timePoints.front() >= 0 && timePoints.back() != storm::utility::infinity<double>()),
+                    storm::exceptions::InvalidArgumentException, "The time points must be non-negative and finite.");
+    STORM_LOG_TRACE("Using IMCA's technique to compute bounded until probabilities at " << timePoints.size() << " time points.");
+
+    uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+    std::vector<std::vector<ValueType>> result;
+    result.reserve(timePoints.size());
+    if (timePoints.empty()) {
+        return result;
+    }
+
+    // (1) Compute the accuracy we need to achieve the required error bound for the largest time point. As the
+    // discretization error grows with the time bound, this also suffices for all other time points.
+    ValueType maxExitRate = 0;
+    for (auto value : exitRateVector) {
+        maxExitRate = std::max(maxExitRate, value);
+    }
+    // If no time can pass, only the probabilistic states need to be considered.
+    bool timeCanPass = !storm::utility::isZero(timePoints.back()) && !storm::utility::isZero(maxExitRate);
+    ValueType delta = storm::utility::one<ValueType>();
+    if (timeCanPass) {
+        delta = (2.0 * storm::utility::convertNumber<ValueType>(env.solver().timeBounded().getPrecision())) / (timePoints.back() * maxExitRate * maxExitRate);
+    }
+
+    // (2) Compute the number of steps for every time point.
+    std::vector<uint64_t> numbersOfSteps;
+    numbersOfSteps.reserve(timePoints.size());
+    for (auto const& timePoint : timePoints) {
+        numbersOfSteps.push_back(timeCanPass ? static_cast<uint64_t>(std::ceil(timePoint / delta)) : 0);
+    }
+    STORM_LOG_INFO("Performing " << numbersOfSteps.back() << " iterations (delta=" << delta << ") for interval [0, " << timePoints.back() << "].\n");
+
+    // (3) Compute the non-goal states. States that satisfy neither phi nor psi are excluded and thereby keep the value zero.
+    storm::storage::BitVector markovianNonGoalStates = markovianStates & phiStates & ~psiStates;
+    storm::storage::BitVector probabilisticNonGoalStates = ~markovianStates & phiStates & ~psiStates;
+    std::vector<ValueType> vProbabilistic(probabilisticNonGoalStates.getNumberOfSetBits());
+    std::vector<ValueType> vMarkovian(markovianNonGoalStates.getNumberOfSetBits());
+    std::vector<ValueType> psiResult(numberOfStates, storm::utility::zero<ValueType>());
+    storm::utility::vector::setVectorValues<ValueType>(psiResult, psiStates, storm::utility::one<ValueType>());
+
+    computeBoundedReachabilityProbabilitiesImca(env, dir, transitionMatrix, exitRateVector, psiStates, markovianNonGoalStates, probabilisticNonGoalStates,
+                                                vMarkovian, vProbabilistic, delta, numbersOfSteps,
+                                                [&](std::vector<ValueType> const& markovianValues, std::vector<ValueType> const& probabilisticValues) {
+                                                    result.push_back(psiResult);
+                                                    storm::utility::vector::setVectorValues(result.back(), probabilisticNonGoalStates, probabilisticValues);
+                                                    storm::utility::vector::setVectorValues(result.back(), markovianNonGoalStates, markovianValues);
+                                                });
+    return result;
+}
+
 template<typename ValueType, typename std::enable_if<!storm::NumberTraits<ValueType>::SupportsExponential, int>::type>
 std::vector<ValueType> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -787,6 +852,11 @@ template std::vector<double> SparseMarkovAutomatonCslHelper::computeBoundedUntil
     std::vector<double> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
     storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+template std::vector<std::vector<double>> SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesAtTimePoints(
+    Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, std::vector<double> const& exitRateVector,
+    storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+    std::vector<double> const& timePoints);
+
 template MDPSparseModelCheckingHelperReturnType<double> SparseMarkovAutomatonCslHelper::computeUntilProbabilities(
     Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
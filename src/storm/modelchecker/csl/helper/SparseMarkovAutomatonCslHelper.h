@@ -32,6 +32,20 @@ class SparseMarkovAutomatonCslHelper {
                                                                    storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
                                                                    storm::storage::BitVector const& psiStates, std::pair<double, double> const& boundsPair);
 
+    /*!
+     * Computes the optimal probabilities of satisfying phi until psi within [0, t] for every given time point t. This
+     * uses the discretization of IMCA (with a step size suitable for the largest time point) and reports the values
+     * whenever a time point is passed, so the effort corresponds to a single computation for the largest time point.
+     *
+     * @param timePoints The (sorted) time points.
+     * @return For each time point, the probabilities of all states.
+     */
+    template<typename ValueType, typename std::enable_if<storm::NumberTraits<ValueType>::SupportsExponential, int>::type = 0>
+    static std::vector<std::vector<ValueType>> computeBoundedUntilProbabilitiesAtTimePoints(
+        Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        std::vector<ValueType> const& exitRateVector, storm::storage::BitVector const& markovianStates, storm::storage::BitVector const& phiStates,
+        storm::storage::BitVector const& psiStates, std::vector<double> const& timePoints);
+
     template<typename ValueType>
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(Environment const& env, OptimizationDirection dir,
                                                                                        storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -177,6 +177,11 @@ bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiv
     return result;
 }
 
+template<typename StateType, typename ValueType>
+std::size_t ExplorationInformation<StateType, ValueType>::getNumberOfExplorationStepsUntilPrecomputation() const {
+    return numberOfExplorationStepsUntilPrecomputation;
+}
+
 template<typename StateType, typename ValueType>
 bool ExplorationInformation<StateType, ValueType>::performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const {
     if (!numberOfSampledPathsUntilPrecomputation) {
@@ -86,6 +86,8 @@ class ExplorationInformation {
 
     bool performPrecomputationExcessiveExplorationSteps(std::size_t& numberExplorationStepsSinceLastPrecomputation) const;
 
+    std::size_t getNumberOfExplorationStepsUntilPrecomputation() const;
+
     bool performPrecomputationExcessiveSampledPaths(std::size_t& numberOfSampledPathsSinceLastPrecomputation) const;
 
     bool useLocalPrecomputation() const;
@@ -1,5 +1,11 @@
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 
+#include <atomic>
+#include <shared_mutex>
+#include <thread>
+
+#include "storm-config.h"
+
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
@@ -35,14 +41,27 @@
 #include "storm/exceptions/InvalidPropertyException.h"
 #include "storm/exceptions/NotSupportedException.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#endif
+
 namespace storm {
 namespace modelchecker {
 
 template<typename ModelType, typename StateType>
 SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program)
+    : SparseExplorationModelChecker(program, storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfThreads()) {
+    // Intentionally left empty.
+}
+
+template<typename ModelType, typename StateType>
+SparseExplorationModelChecker<ModelType, StateType>::SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads)
     : program(program.substituteConstantsFormulas()),
       randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()),
-      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()) {
+      comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()),
+      numberOfThreads(numberOfThreads) {
     // Intentionally left empty.
 }
 
@@ -96,6 +115,14 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
     // Now perform the actual sampling.
     Statistics<StateType, ValueType> stats;
     bool convergenceCriterionMet = false;
+    if (numberOfThreads > 1) {
+#ifdef STORM_HAVE_INTELTBB
+        performParallelSampling(stateGeneration, explorationInformation, bounds, stats, initialStateIndex);
+        convergenceCriterionMet = true;
+#else
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential exploration.");
+#endif
+    }
     while (!convergenceCriterionMet) {
         bool result = samplePathFromInitialState(stateGeneration, explorationInformation, stack, bounds, stats);
 
@@ -136,6 +163,163 @@ std::tuple<StateType, typename ModelType::ValueType, typename ModelType::ValueTy
                            bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
 }
 
+template<typename ModelType, typename StateType>
+void SparseExplorationModelChecker<ModelType, StateType>::performParallelSampling(StateGeneration<StateType, ValueType>& stateGeneration,
+                                                                                  ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                                                                  Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats,
+                                                                                  StateType const& initialStateIndex) const {
+#ifdef STORM_HAVE_INTELTBB
+    // The mutex guards the exploration information, the bounds, the state generation and the statistics. As the
+    // workers request shared access almost all the time, they back off while a worker waits for exclusive access.
+    std::shared_mutex mutex;
+    std::atomic<uint64_t> numberOfWaitingWriters(0);
+    auto lockShared = [&]() {
+        while (numberOfWaitingWriters.load() > 0) {
+            std::this_thread::yield();
+        }
+        return std::shared_lock<std::shared_mutex>(mutex);
+    };
+    auto lockExclusively = [&]() {
+        ++numberOfWaitingWriters;
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        --numberOfWaitingWriters;
+        return lock;
+    };
+
+    // Collapsing MECs moves actions in the matrix, so paths that were (partly) sampled before a precomputation
+    // refer to outdated actions. To detect this, we count the precomputations (guarded by the mutex).
+    uint64_t numberOfPrecomputations = 0;
+
+    std::atomic<std::size_t> explorationStepsSinceLastPrecomputation(0);
+    std::atomic<bool> convergenceCriterionMet(false);
+
+    std::vector<std::default_random_engine::result_type> seeds(numberOfThreads);
+    for (auto& seed : seeds) {
+        seed = randomGenerator();
+    }
+
+    auto sampleUntilConvergence = [&](std::default_random_engine& generator) {
+        StateActionStack stack;
+        while (!convergenceCriterionMet.load()) {
+            uint64_t precomputationsBeforePath;
+            {
+                auto lock = lockShared();
+                precomputationsBeforePath = numberOfPrecomputations;
+            }
+
+            // Sample a path from the initial state until a terminal state is found.
+            stack.clear();
+            stack.emplace_back(initialStateIndex, 0);
+            bool foundTerminalState = false;
+            bool pathAborted = false;
+            std::size_t explorationSteps = 0;
+            // The steps are added to the shared counter in chunks of 64 to avoid contention. This is the number of steps that were added.
+            std::size_t countedExplorationSteps = 0;
+            while (!foundTerminalState && !pathAborted) {
+                if (convergenceCriterionMet.load()) {
+                    pathAborted = true;
+                    break;
+                }
+
+                StateType currentStateId = stack.back().first;
+                bool stateIsUnexplored = false;
+                {
+                    auto lock = lockShared();
+                    if (numberOfPrecomputations != precomputationsBeforePath) {
+                        pathAborted = true;
+                        break;
+                    }
+                    stateIsUnexplored = explorationInformation.findUnexploredState(currentStateId) != explorationInformation.unexploredStatesEnd();
+                    if (!stateIsUnexplored) {
+                        if (explorationInformation.isTerminal(currentStateId)) {
+                            foundTerminalState = true;
+                        } else {
+                            ActionType chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, generator);
+                            stack.back().second = chosenAction;
+                            stack.emplace_back(sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, generator), 0);
+                        }
+                    }
+                }
+
+                if (stateIsUnexplored) {
+                    // Exploring the state modifies the shared information, so we need exclusive access. Note that
+                    // another worker may have explored the state in the meantime, in which case we simply sample
+                    // from it in the next iteration.
+                    auto lock = lockExclusively();
+                    if (numberOfPrecomputations != precomputationsBeforePath) {
+                        pathAborted = true;
+                        break;
+                    }
+                    auto unexploredIt = explorationInformation.findUnexploredState(currentStateId);
+                    if (unexploredIt != explorationInformation.unexploredStatesEnd()) {
+                        foundTerminalState = exploreState(stateGeneration, currentStateId, unexploredIt->second, explorationInformation, bounds, stats);
+                        explorationInformation.removeUnexploredState(unexploredIt);
+                    }
+                }
+                ++explorationSteps;
+
+                // If the number of exploration steps exceeds a certain threshold, do a precomputation and abort the path.
+                if (!foundTerminalState && explorationSteps % 64 == 0) {
+                    std::size_t steps = explorationStepsSinceLastPrecomputation.fetch_add(64) + 64;
+                    countedExplorationSteps = explorationSteps;
+                    if (steps > explorationInformation.getNumberOfExplorationStepsUntilPrecomputation()) {
+                        auto lock = lockExclusively();
+                        steps = explorationStepsSinceLastPrecomputation.load();
+                        if (numberOfPrecomputations == precomputationsBeforePath &&
+                            explorationInformation.performPrecomputationExcessiveExplorationSteps(steps)) {
+                            performPrecomputation(stack, explorationInformation, bounds, stats);
+                            explorationStepsSinceLastPrecomputation = 0;
+                            ++numberOfPrecomputations;
+                        }
+                        pathAborted = true;
+                    }
+                }
+            }
+
+            auto lock = lockExclusively();
+            // Add the remaining steps of the path to the counter, unless it was reset by a precomputation in the meantime.
+            if (numberOfPrecomputations == precomputationsBeforePath) {
+                explorationStepsSinceLastPrecomputation += explorationSteps - countedExplorationSteps;
+            }
+            stats.explorationSteps += explorationSteps;
+            stats.sampledPath();
+            stats.updateMaxPathLength(stack.size());
+            if (pathAborted || numberOfPrecomputations != precomputationsBeforePath) {
+                STORM_LOG_TRACE("Discarding aborted path.");
+                continue;
+            }
+
+            // Update the bounds along the path to the terminal state.
+            STORM_LOG_TRACE("Found terminal state, updating probabilities along path.");
+            updateProbabilityBoundsAlongSampledPath(stack, explorationInformation, bounds);
+
+            ValueType difference = bounds.getDifferenceOfStateBounds(initialStateIndex, explorationInformation);
+            STORM_LOG_DEBUG("Difference after iteration " << stats.pathsSampled << " is " << difference << ".");
+            if (comparator.isZero(difference)) {
+                convergenceCriterionMet = true;
+            } else if (explorationInformation.performPrecomputationExcessiveSampledPaths(stats.pathsSampledSinceLastPrecomputation)) {
+                performPrecomputation(stack, explorationInformation, bounds, stats);
+                explorationStepsSinceLastPrecomputation = 0;
+                ++numberOfPrecomputations;
+            }
+        }
+    };
+
+    tbb::task_arena arena(static_cast<int>(numberOfThreads));
+    arena.execute([&] {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfThreads, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t worker = range.begin(); worker < range.end(); ++worker) {
+                std::default_random_engine generator(seeds[worker]);
+                sampleUntilConvergence(generator);
+            }
+        });
+    });
+    stats.explorationStepsSinceLastPrecomputation = explorationStepsSinceLastPrecomputation.load();
+#else
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Parallel exploration requires Intel TBB.");
+#endif
+}
+
 template<typename ModelType, typename StateType>
 bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                                      ExplorationInformation<StateType, ValueType>& explorationInformation,
@@ -177,11 +361,11 @@ bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialS
         if (!foundTerminalState) {
             // At this point, we can be sure that the state was expanded and that we can sample according to the
             // probabilities in the matrix.
-            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds);
+            uint32_t chosenAction = sampleActionOfState(currentStateId, explorationInformation, bounds, randomGenerator);
             stack.back().second = chosenAction;
             STORM_LOG_TRACE("Sampled action " << chosenAction << " in state " << currentStateId << ".");
 
-            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds);
+            StateType successor = sampleSuccessorFromAction(chosenAction, explorationInformation, bounds, randomGenerator);
             STORM_LOG_TRACE("Sampled successor " << successor << " according to action " << chosenAction << " of state " << currentStateId << ".");
 
             // Put the successor state and a dummy action on top of the stack.
@@ -314,7 +498,8 @@ bool SparseExplorationModelChecker<ModelType, StateType>::exploreState(StateGene
 
 template<typename ModelType, typename StateType>
 typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseExplorationModelChecker<ModelType, StateType>::sampleActionOfState(
-    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType>& bounds) const {
+    StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& generator) const {
     // Determine the values of all available actions.
     std::vector<std::pair<ActionType, ValueType>> actionValues;
     StateType rowGroup = explorationInformation.getRowGroup(currentStateId);
@@ -350,13 +535,13 @@ typename SparseExplorationModelChecker<ModelType, StateType>::ActionType SparseE
 
     // Now sample from all maximizing actions.
     std::uniform_int_distribution<ActionType> distribution(0, std::distance(actionValues.begin(), end) - 1);
-    return actionValues[distribution(randomGenerator)].first;
+    return actionValues[distribution(generator)].first;
 }
 
 template<typename ModelType, typename StateType>
 StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromAction(
-    ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-    Bounds<StateType, ValueType> const& bounds) const {
+    ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation, Bounds<StateType, ValueType> const& bounds,
+    std::default_random_engine& generator) const {
     std::vector<storm::storage::MatrixEntry<StateType, ValueType>> const& row = explorationInformation.getRowOfMatrix(chosenAction);
     if (row.size() == 1) {
         return row.front().getColumn();
@@ -377,11 +562,11 @@ StateType SparseExplorationModelChecker<ModelType, StateType>::sampleSuccessorFr
 
         // Now sample according to the probabilities.
         std::discrete_distribution<StateType> distribution(probabilities.begin(), probabilities.end());
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     } else {
         STORM_LOG_ASSERT(explorationInformation.useUniformHeuristic(), "Illegal next-state heuristic.");
         std::uniform_int_distribution<ActionType> distribution(0, row.size() - 1);
-        return row[distribution(randomGenerator)].getColumn();
+        return row[distribution(generator)].getColumn();
     }
 }
 
@@ -48,6 +48,12 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     SparseExplorationModelChecker(storm::prism::Program const& program);
 
+    /*!
+     * Creates a model checker that samples paths with the given number of threads (instead of the number given
+     * in the settings).
+     */
+    SparseExplorationModelChecker(storm::prism::Program const& program, uint64_t numberOfThreads);
+
     virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
 
     virtual std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env,
@@ -57,6 +63,14 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
     std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration,
                                                                    ExplorationInformation<StateType, ValueType>& explorationInformation) const;
 
+    /*!
+     * Samples paths with several threads concurrently until the bounds of the initial state have
+     * converged. Sampling a path only reads the explored fragment of the system and is done by all workers in
+     * parallel, whereas exploring states, updating bounds and performing precomputations is done exclusively.
+     */
+    void performParallelSampling(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation,
+                                 Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats, StateType const& initialStateIndex) const;
+
     bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration,
                                     ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack,
                                     Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -66,10 +80,10 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
                       Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
 
     ActionType sampleActionOfState(StateType const& currentStateId, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                   Bounds<StateType, ValueType>& bounds) const;
+                                   Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
 
     StateType sampleSuccessorFromAction(ActionType const& chosenAction, ExplorationInformation<StateType, ValueType> const& explorationInformation,
-                                        Bounds<StateType, ValueType> const& bounds) const;
+                                        Bounds<StateType, ValueType> const& bounds, std::default_random_engine& generator) const;
 
     bool performPrecomputation(StateActionStack const& stack, ExplorationInformation<StateType, ValueType>& explorationInformation,
                                Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
@@ -110,6 +124,9 @@ class SparseExplorationModelChecker : public AbstractModelChecker<ModelType> {
 
     // A comparator used to determine whether values are equal.
     storm::utility::ConstantsComparator<ValueType> comparator;
+
+    // The number of threads that sample paths concurrently.
+    uint64_t numberOfThreads;
 };
 }  // namespace modelchecker
 }  // namespace storm
@@ -171,8 +171,10 @@ void SparseDeterministicVisitingTimesHelper<ValueType>::createDecomposition(Envi
 
     if (!this->_sccDecomposition) {
         // The decomposition has not been provided or computed, yet.
-        auto options =
-            storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(env.solver().isForceSoundness());
+        auto options = storm::storage::StronglyConnectedComponentDecompositionOptions()
+                           .forceTopologicalSort()
+                           .computeSccDepths(env.solver().isForceSoundness())
+                           .threads(env.solver().topological().getNumberOfThreads());
         this->_computedSccDecomposition =
             std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(this->_transitionMatrix, options);
         this->_sccDecomposition = this->_computedSccDecomposition.get();
@@ -7,6 +7,7 @@
 
 #include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
 
+#include "storm/modelchecker/helper/ltl/internal/SparseLTLProductExplorer.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
@@ -219,6 +220,13 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
         statesOfInterest = storm::storage::BitVector(this->_transitionMatrix.getRowGroupCount(), true);
     }
 
+    if (env.modelchecker().isLtlOnTheFlyProductSet()) {
+        if (!this->isProduceSchedulerSet()) {
+            return computeDAProductProbabilitiesOnTheFly(env, da, statesForAP, statesOfInterest);
+        }
+        STORM_LOG_WARN("Scheduler export is not supported for the on-the-fly product, building the full product instead.");
+    }
+
     STORM_LOG_INFO("Building " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " product with deterministic automaton, starting from "
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
     transformer::DAProductBuilder productBuilder(da, statesForAP);
@@ -298,6 +306,55 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     return numericResult;
 }
 
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAProductProbabilitiesOnTheFly(
+    Environment const& env, storm::automata::DeterministicAutomaton const& da, std::vector<storm::storage::BitVector> const& statesForAP,
+    storm::storage::BitVector const& statesOfInterest) {
+    STORM_LOG_INFO("Exploring " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " product on the fly, starting from "
+                   << statesOfInterest.getNumberOfSetBits() << " model states...");
+    internal::SparseLTLProductExplorer<ValueType, Nondeterministic> explorer(this->_transitionMatrix, da, statesForAP);
+    explorer.explore(statesOfInterest);
+    storm::storage::SparseMatrix<ValueType> const& productMatrix = explorer.getProductMatrix();
+    storm::storage::SparseMatrix<ValueType> backwardTransitions = productMatrix.transpose(true);
+
+    // Compute accepting states. The absorbing states of the product are accepting and rejecting by construction.
+    storm::storage::BitVector acceptingStates;
+    if (Nondeterministic) {
+        STORM_LOG_INFO("Computing MECs and checking for acceptance...");
+        acceptingStates = computeAcceptingECs(*explorer.getProductAcceptance(), productMatrix, backwardTransitions, nullptr);
+    } else {
+        STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
+        acceptingStates = computeAcceptingBCCs(*explorer.getProductAcceptance(), productMatrix);
+    }
+    acceptingStates.set(explorer.getAcceptingProductState());
+    acceptingStates.set(explorer.getRejectingProductState(), false);
+
+    STORM_LOG_INFO("Computing probabilities for reaching accepting components...");
+    storm::storage::BitVector bvTrue(productMatrix.getRowGroupCount(), true);
+    storm::storage::BitVector soiProduct = explorer.getProductStatesOfInterest();
+
+    storm::solver::SolveGoal<ValueType> solveGoalProduct;
+    if (this->isValueThresholdSet()) {
+        solveGoalProduct = storm::solver::SolveGoal<ValueType>(OptimizationDirection::Maximize, this->getValueThresholdComparisonType(),
+                                                               this->getValueThresholdValue(), std::move(soiProduct));
+    } else {
+        solveGoalProduct = storm::solver::SolveGoal<ValueType>(OptimizationDirection::Maximize);
+        solveGoalProduct.setRelevantValues(std::move(soiProduct));
+    }
+
+    std::vector<ValueType> prodNumericResult;
+    if (Nondeterministic) {
+        prodNumericResult = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
+                                env, std::move(solveGoalProduct), productMatrix, backwardTransitions, bvTrue, acceptingStates, this->isQualitativeSet(), false)
+                                .values;
+    } else {
+        prodNumericResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeUntilProbabilities(
+            env, std::move(solveGoalProduct), productMatrix, backwardTransitions, bvTrue, acceptingStates, this->isQualitativeSet());
+    }
+
+    return explorer.projectToOriginalModel(this->_transitionMatrix.getRowGroupCount(), prodNumericResult);
+}
+
 template<typename ValueType, bool Nondeterministic>
 std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeLTLProbabilities(Environment const& env, storm::logic::PathFormula const& formula,
                                                                                              std::map<std::string, storm::storage::BitVector>& apSatSets) {
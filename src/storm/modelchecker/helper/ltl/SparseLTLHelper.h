@@ -87,6 +87,17 @@ class SparseLTLHelper : public SingleValueModelCheckerHelper<ValueType, storm::m
                                                    std::map<std::string, storm::storage::BitVector>& apSatSets);
 
    private:
+    /*!
+     * Computes the (maximizing) probabilities for the DA product, which is explored on the fly.
+     * @param da the DA to build the product with
+     * @param statesForAP for each atomic proposition of the DA, the states satisfying it
+     * @param statesOfInterest the states from which the product is explored
+     * @return a value for each state
+     */
+    std::vector<ValueType> computeDAProductProbabilitiesOnTheFly(Environment const& env, storm::automata::DeterministicAutomaton const& da,
+                                                                 std::vector<storm::storage::BitVector> const& statesForAP,
+                                                                 storm::storage::BitVector const& statesOfInterest);
+
     /*!
      * Computes a set S of states that admit a probability 1 strategy of satisfying the given acceptance condition (in DNF).
      * More precisely, let
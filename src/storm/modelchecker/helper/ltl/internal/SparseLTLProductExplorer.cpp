@@ -0,0 +1,244 @@
+#include "storm/modelchecker/helper/ltl/internal/SparseLTLProductExplorer.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+template<typename ValueType, bool Nondeterministic>
+SparseLTLProductExplorer<ValueType, Nondeterministic>::SparseLTLProductExplorer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                storm::automata::DeterministicAutomaton const& da,
+                                                                                std::vector<storm::storage::BitVector> const& statesForAP)
+    : transitionMatrix(transitionMatrix), da(da), labels(transitionMatrix.getRowGroupCount(), da.getAPSet().elementAllFalse()) {
+    for (unsigned int ap = 0; ap < da.getAPSet().size(); ++ap) {
+        for (auto state : statesForAP[ap]) {
+            labels[state] = da.getAPSet().elementAddAP(labels[state], ap);
+        }
+    }
+    analyzeAutomaton();
+}
+
+template<typename ValueType, bool Nondeterministic>
+void SparseLTLProductExplorer<ValueType, Nondeterministic>::analyzeAutomaton() {
+    uint64_t numberOfAutomatonStates = da.getNumberOfStates();
+    storm::automata::AcceptanceCondition const& acceptance = *da.getAcceptance();
+
+    // Build the graph of the automaton, where every letter may occur.
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfAutomatonStates, numberOfAutomatonStates);
+    std::vector<uint64_t> successors;
+    for (uint64_t automatonState = 0; automatonState < numberOfAutomatonStates; ++automatonState) {
+        successors.clear();
+        for (storm::automata::APSet::alphabet_element letter = 0; letter < da.getAPSet().alphabetSize(); ++letter) {
+            successors.push_back(da.getSuccessor(automatonState, letter));
+        }
+        std::sort(successors.begin(), successors.end());
+        successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+        for (auto successor : successors) {
+            builder.addNextValue(automatonState, successor, 1.0);
+        }
+    }
+    storm::storage::SparseMatrix<double> automatonGraph = builder.build();
+    storm::storage::SparseMatrix<double> backwardAutomatonGraph = automatonGraph.transpose(true);
+    storm::storage::BitVector allAutomatonStates(numberOfAutomatonStates, true);
+
+    // Every run of the automaton eventually visits exactly the states of a (non-trivial) strongly connected set of
+    // states infinitely often. An automaton state accepts every continuation if all strongly connected sets reachable
+    // from it are accepting. As this is hard to decide for sets with more than one state, we only rely on singletons.
+    // Similarly, it rejects every continuation if none of the reachable strongly connected sets is accepting.
+    storm::storage::BitVector possiblyAccepting(numberOfAutomatonStates, false);
+    storm::storage::BitVector possiblyRejecting(numberOfAutomatonStates, false);
+    storm::storage::StronglyConnectedComponentDecomposition<double> sccs(automatonGraph,
+                                                                         storm::storage::StronglyConnectedComponentDecompositionOptions().dropNaiveSccs());
+    for (auto const& scc : sccs) {
+        bool singleton = scc.size() == 1;
+        bool accepting = singleton && acceptance.isAccepting(scc);
+        for (auto automatonState : scc) {
+            if (!singleton || accepting) {
+                possiblyAccepting.set(automatonState);
+            }
+            if (!singleton || !accepting) {
+                possiblyRejecting.set(automatonState);
+            }
+        }
+    }
+
+    if (Nondeterministic) {
+        // For nondeterministic models, the acceptance condition is in DNF. This allows us to decide exactly whether a
+        // strongly connected set satisfies one of the conjunctions, just like for the end components of the product.
+        possiblyAccepting.clear();
+        for (auto const& conjunction : acceptance.extractFromDNF()) {
+            storm::storage::BitVector allowed(numberOfAutomatonStates, true);
+            for (auto const& literal : conjunction) {
+                if (literal->isFALSE()) {
+                    allowed.clear();
+                } else if (literal->isAtom() && literal->getAtom().getType() == cpphoafparser::AtomAcceptance::TEMPORAL_FIN) {
+                    storm::storage::BitVector const& accSet = acceptance.getAcceptanceSet(literal->getAtom().getAcceptanceSet());
+                    allowed &= literal->getAtom().isNegated() ? accSet : ~accSet;
+                }
+            }
+            if (allowed.empty()) {
+                continue;
+            }
+
+            storm::storage::StronglyConnectedComponentDecomposition<double> allowedSccs(
+                automatonGraph, storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(&allowed).dropNaiveSccs());
+            for (auto const& scc : allowedSccs) {
+                bool accepting = true;
+                for (auto const& literal : conjunction) {
+                    if (literal->isAtom() && literal->getAtom().getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) {
+                        storm::storage::BitVector const& accSet = acceptance.getAcceptanceSet(literal->getAtom().getAcceptanceSet());
+                        bool negated = literal->getAtom().isNegated();
+                        accepting &= std::any_of(scc.begin(), scc.end(), [&](uint64_t automatonState) { return accSet.get(automatonState) != negated; });
+                    }
+                }
+                if (accepting) {
+                    for (auto automatonState : scc) {
+                        possiblyAccepting.set(automatonState);
+                    }
+                }
+            }
+        }
+    }
+
+    acceptingAutomatonStates = ~storm::utility::graph::performProbGreater0(backwardAutomatonGraph, allAutomatonStates, possiblyRejecting);
+    rejectingAutomatonStates = ~storm::utility::graph::performProbGreater0(backwardAutomatonGraph, allAutomatonStates, possiblyAccepting);
+    STORM_LOG_INFO("Found " << acceptingAutomatonStates.getNumberOfSetBits() << " automaton states accepting and "
+                            << rejectingAutomatonStates.getNumberOfSetBits() << " automaton states rejecting every continuation.");
+}
+
+template<typename ValueType, bool Nondeterministic>
+void SparseLTLProductExplorer<ValueType, Nondeterministic>::explore(storm::storage::BitVector const& statesOfInterest) {
+    uint64_t numberOfAutomatonStates = da.getNumberOfStates();
+
+    // The product states are numbered in the order of their discovery. Hence, processing them in the order of their
+    // index is a breadth-first search and the rows of the product matrix can be inserted in order.
+    // The first two product states are the absorbing rejecting and accepting state, respectively.
+    std::unordered_map<uint64_t, state_type> productStateToIndex;
+    std::vector<state_type> productToModelState = {0, 0};
+    productToAutomatonState = {da.getInitialState(), da.getInitialState()};
+    auto getOrAddProductState = [&](state_type modelState, state_type automatonState) -> state_type {
+        if (acceptingAutomatonStates.get(automatonState)) {
+            return getAcceptingProductState();
+        } else if (rejectingAutomatonStates.get(automatonState)) {
+            return getRejectingProductState();
+        }
+        auto insertionResult = productStateToIndex.try_emplace(modelState * numberOfAutomatonStates + automatonState, productToModelState.size());
+        if (insertionResult.second) {
+            productToModelState.push_back(modelState);
+            productToAutomatonState.push_back(automatonState);
+        }
+        return insertionResult.first->second;
+    };
+
+    modelStatesOfInterest.clear();
+    initialProductStates.clear();
+    for (auto modelState : statesOfInterest) {
+        modelStatesOfInterest.push_back(modelState);
+        initialProductStates.push_back(getOrAddProductState(modelState, da.getSuccessor(da.getInitialState(), labels[modelState])));
+    }
+
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, Nondeterministic, 0);
+    uint64_t currentRow = 0;
+    for (state_type sink : {getRejectingProductState(), getAcceptingProductState()}) {
+        if (Nondeterministic) {
+            builder.newRowGroup(currentRow);
+        }
+        builder.addNextValue(currentRow++, sink, storm::utility::one<ValueType>());
+    }
+
+    std::vector<std::pair<state_type, ValueType>> rowEntries;
+    for (state_type productState = 2; productState < productToModelState.size(); ++productState) {
+        state_type modelState = productToModelState[productState];
+        state_type automatonState = productToAutomatonState[productState];
+        if (Nondeterministic) {
+            builder.newRowGroup(currentRow);
+        }
+        uint64_t firstRow = Nondeterministic ? transitionMatrix.getRowGroupIndices()[modelState] : modelState;
+        uint64_t endRow = Nondeterministic ? transitionMatrix.getRowGroupIndices()[modelState + 1] : modelState + 1;
+        for (uint64_t row = firstRow; row < endRow; ++row) {
+            rowEntries.clear();
+            for (auto const& entry : transitionMatrix.getRow(row)) {
+                state_type successor = getOrAddProductState(entry.getColumn(), da.getSuccessor(automatonState, labels[entry.getColumn()]));
+                rowEntries.emplace_back(successor, entry.getValue());
+            }
+            // Several successors may be redirected to the same absorbing state, so the entries need to be sorted and merged.
+            std::sort(rowEntries.begin(), rowEntries.end(), [](auto const& first, auto const& second) { return first.first < second.first; });
+            for (auto entryIt = rowEntries.begin(); entryIt != rowEntries.end(); ++entryIt) {
+                ValueType value = entryIt->second;
+                while (entryIt + 1 != rowEntries.end() && (entryIt + 1)->first == entryIt->first) {
+                    ++entryIt;
+                    value += entryIt->second;
+                }
+                builder.addNextValue(currentRow, entryIt->first, value);
+            }
+            ++currentRow;
+        }
+    }
+    productMatrix = builder.build(currentRow, productToModelState.size(), Nondeterministic ? productToModelState.size() : 0);
+    STORM_LOG_INFO("Explored " << productMatrix.getRowGroupCount() << " product states with " << productMatrix.getEntryCount() << " transitions.");
+}
+
+template<typename ValueType, bool Nondeterministic>
+storm::storage::SparseMatrix<ValueType> const& SparseLTLProductExplorer<ValueType, Nondeterministic>::getProductMatrix() const {
+    return productMatrix;
+}
+
+template<typename ValueType, bool Nondeterministic>
+storm::automata::AcceptanceCondition::ptr SparseLTLProductExplorer<ValueType, Nondeterministic>::getProductAcceptance() const {
+    return da.getAcceptance()->lift(productToAutomatonState.size(), [this](std::size_t productState) { return productToAutomatonState[productState]; });
+}
+
+template<typename ValueType, bool Nondeterministic>
+typename SparseLTLProductExplorer<ValueType, Nondeterministic>::state_type SparseLTLProductExplorer<ValueType, Nondeterministic>::getAcceptingProductState()
+    const {
+    return 1;
+}
+
+template<typename ValueType, bool Nondeterministic>
+typename SparseLTLProductExplorer<ValueType, Nondeterministic>::state_type SparseLTLProductExplorer<ValueType, Nondeterministic>::getRejectingProductState()
+    const {
+    return 0;
+}
+
+template<typename ValueType, bool Nondeterministic>
+storm::storage::BitVector SparseLTLProductExplorer<ValueType, Nondeterministic>::getProductStatesOfInterest() const {
+    storm::storage::BitVector result(productMatrix.getRowGroupCount(), false);
+    for (auto productState : initialProductStates) {
+        result.set(productState);
+    }
+    return result;
+}
+
+template<typename ValueType, bool Nondeterministic>
+std::vector<ValueType> SparseLTLProductExplorer<ValueType, Nondeterministic>::projectToOriginalModel(uint64_t numberOfStates,
+                                                                                                   std::vector<ValueType> const& productValues) const {
+    std::vector<ValueType> result(numberOfStates, storm::utility::zero<ValueType>());
+    for (uint64_t index = 0; index < modelStatesOfInterest.size(); ++index) {
+        result[modelStatesOfInterest[index]] = productValues[initialProductStates[index]];
+    }
+    return result;
+}
+
+template class SparseLTLProductExplorer<double, false>;
+template class SparseLTLProductExplorer<double, true>;
+
+#ifdef STORM_HAVE_CARL
+template class SparseLTLProductExplorer<storm::RationalNumber, false>;
+template class SparseLTLProductExplorer<storm::RationalNumber, true>;
+template class SparseLTLProductExplorer<storm::RationalFunction, false>;
+
+#endif
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/automata/AcceptanceCondition.h"
+#include "storm/automata/DeterministicAutomaton.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+
+namespace modelchecker {
+namespace helper {
+namespace internal {
+
+/*!
+ * Helper class that explores the product of a sparse model and a deterministic automaton on the fly.
+ *
+ * In contrast to the DAProductBuilder, the product is not materialized as a model. Instead, only the transition matrix
+ * of the reachable product states is built. Moreover, the automaton is analyzed upfront: Product states whose automaton
+ * state already decides the acceptance of all continuations (e.g. rejecting or accepting sinks) are not explored but
+ * redirected to one of two absorbing product states.
+ *
+ * @tparam ValueType the type a value can have
+ * @tparam Nondeterministic A flag indicating if there is nondeterminism in the Model (MDP)
+ */
+template<typename ValueType, bool Nondeterministic>
+class SparseLTLProductExplorer {
+   public:
+    typedef storm::storage::sparse::state_type state_type;
+
+    /*!
+     * Initializes the explorer.
+     * @param transitionMatrix the transition matrix of the model
+     * @param da the deterministic automaton
+     * @param statesForAP for each atomic proposition of the automaton, the states of the model satisfying it
+     */
+    SparseLTLProductExplorer(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::automata::DeterministicAutomaton const& da,
+                             std::vector<storm::storage::BitVector> const& statesForAP);
+
+    /*!
+     * Explores all product states that are reachable from the given model states.
+     * @param statesOfInterest the model states from which the exploration starts
+     */
+    void explore(storm::storage::BitVector const& statesOfInterest);
+
+    /*!
+     * Retrieves the transition matrix of the explored product.
+     */
+    storm::storage::SparseMatrix<ValueType> const& getProductMatrix() const;
+
+    /*!
+     * Retrieves the acceptance condition of the automaton lifted to the explored product states.
+     * @note The acceptance of the absorbing states is meaningless. It is given by the accepting and rejecting product state.
+     */
+    storm::automata::AcceptanceCondition::ptr getProductAcceptance() const;
+
+    /*!
+     * Retrieves the absorbing product state that collects all product states accepting every continuation.
+     */
+    state_type getAcceptingProductState() const;
+
+    /*!
+     * Retrieves the absorbing product state that collects all product states rejecting every continuation.
+     */
+    state_type getRejectingProductState() const;
+
+    /*!
+     * Retrieves the product states that correspond to the model states of interest.
+     */
+    storm::storage::BitVector getProductStatesOfInterest() const;
+
+    /*!
+     * Maps the given values of the product states to the model states of interest.
+     * @param numberOfStates the number of states of the model
+     * @param productValues the values of the product states
+     */
+    std::vector<ValueType> projectToOriginalModel(uint64_t numberOfStates, std::vector<ValueType> const& productValues) const;
+
+   private:
+    /*!
+     * Computes the automaton states that accept and reject every continuation, respectively.
+     */
+    void analyzeAutomaton();
+
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+    storm::automata::DeterministicAutomaton const& da;
+
+    // The label of every model state wrt. the atomic propositions of the automaton.
+    std::vector<storm::automata::APSet::alphabet_element> labels;
+
+    storm::storage::BitVector acceptingAutomatonStates;
+    storm::storage::BitVector rejectingAutomatonStates;
+
+    storm::storage::SparseMatrix<ValueType> productMatrix;
+    std::vector<state_type> productToAutomatonState;
+    std::vector<state_type> modelStatesOfInterest;
+    std::vector<state_type> initialProductStates;
+};
+
+}  // namespace internal
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
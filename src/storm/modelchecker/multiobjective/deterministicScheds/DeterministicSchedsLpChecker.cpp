@@ -15,6 +15,8 @@
 
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 
+#include <limits>
+#include <memory>
 #include <set>
 #include <storm/exceptions/UnexpectedException.h>
 #include "storm/exceptions/InvalidOperationException.h"
@@ -287,6 +289,40 @@ bool DeterministicSchedsLpChecker<ModelType, GeometryValueType>::processEndCompo
     }
     storm::storage::MaximalEndComponentDecomposition<ValueType> mecs(model.getTransitionMatrix(), backwardTransitions,
                                                                      storm::storage::BitVector(model.getNumberOfStates(), true), choicesWithValueZero);
+
+    // The sub-end components of a mec that remain once the states with a non-zero scheduler-independent value for an objective are excluded
+    // are obtained by refining the mec decomposition once per objective. This only decomposes the mecs that contain such states again.
+    std::vector<std::unique_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType>>> subEcDecompositions(objectiveHelper.size());
+    std::vector<std::vector<uint64_t>> stateToSubEcIndex(objectiveHelper.size());
+    auto getSubEcs = [&](uint64_t objIndex, storm::storage::MaximalEndComponent const& mec) {
+        if (!subEcDecompositions[objIndex]) {
+            storm::storage::BitVector excludedStates(model.getNumberOfStates(), false);
+            for (auto const& stateValue : objectiveHelper[objIndex].getSchedulerIndependentStateValues()) {
+                if (!storm::utility::isZero(stateValue.second)) {
+                    excludedStates.set(stateValue.first, true);
+                }
+            }
+            subEcDecompositions[objIndex] = std::make_unique<storm::storage::MaximalEndComponentDecomposition<ValueType>>(mecs);
+            subEcDecompositions[objIndex]->refine(model.getTransitionMatrix(), excludedStates, storm::storage::BitVector(model.getNumberOfChoices(), false));
+            stateToSubEcIndex[objIndex].assign(model.getNumberOfStates(), std::numeric_limits<uint64_t>::max());
+            for (uint64_t subEcIndex = 0; subEcIndex < subEcDecompositions[objIndex]->size(); ++subEcIndex) {
+                for (auto const& stateChoices : subEcDecompositions[objIndex]->getBlock(subEcIndex)) {
+                    stateToSubEcIndex[objIndex][stateChoices.first] = subEcIndex;
+                }
+            }
+        }
+        std::set<uint64_t> subEcIndices;
+        for (auto const& stateChoices : mec) {
+            if (stateToSubEcIndex[objIndex][stateChoices.first] != std::numeric_limits<uint64_t>::max()) {
+                subEcIndices.insert(stateToSubEcIndex[objIndex][stateChoices.first]);
+            }
+        }
+        std::vector<storm::storage::MaximalEndComponent const*> result;
+        for (auto const& subEcIndex : subEcIndices) {
+            result.push_back(&subEcDecompositions[objIndex]->getBlock(subEcIndex));
+        }
+        return result;
+    };
     for (auto const& mec : mecs) {
         // For each objective we might need to split this mec into several subECs, if the objective yields a non-zero scheduler-independent state value for some
         // states of this ec. However, note that this split happens objective-wise which is why we can not consider a subsystem in the mec-decomposition above
@@ -317,21 +353,10 @@ bool DeterministicSchedsLpChecker<ModelType, GeometryValueType>::processEndCompo
                         }
                     }
                 } else {
-                    // Compute sub-end components
-                    storm::storage::BitVector subEcStates(model.getNumberOfStates(), false), subEcChoices(model.getNumberOfChoices(), false);
-                    for (auto const& stateChoices : mec) {
-                        if (exclStates.first.count(stateChoices.first) == 0) {
-                            subEcStates.set(stateChoices.first, true);
-                            for (auto const& choice : stateChoices.second) {
-                                subEcChoices.set(choice, true);
-                            }
-                        }
-                    }
-                    storm::storage::MaximalEndComponentDecomposition<ValueType> subEcs(model.getTransitionMatrix(), backwardTransitions, subEcStates,
-                                                                                       subEcChoices);
-                    for (auto const& subEc : subEcs) {
+                    // Compute sub-end components. All objectives of this group exclude the same states of this mec.
+                    for (auto const* subEc : getSubEcs(exclStates.second.front(), mec)) {
                         auto varsForSubEc =
-                            processEc(subEc, model.getTransitionMatrix(), "o" + std::to_string(*exclStates.second.begin()), choiceVariables, *lpModel);
+                            processEc(*subEc, model.getTransitionMatrix(), "o" + std::to_string(exclStates.second.front()), choiceVariables, *lpModel);
                         ++ecCounter;
                         for (auto const& stateVar : varsForSubEc) {
                             for (auto const& objIndex : exclStates.second) {
@@ -56,7 +56,10 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
                 maybeStates.template toAdd<ValueType>() * model.getManager().template getConstant<ValueType>(storm::utility::convertNumber<ValueType>(0.5))));
     } else {
         // If there are maybe states, we need to solve an equation system.
-        if (!maybeStates.isZero()) {
+        if (!maybeStates.isZero() && env.modelchecker().getHybridAcyclicLayers() > 0) {
+            return computeUntilProbabilitiesDecomposed(env, model, transitionMatrix, maybeStates, statesWithProbability01.second,
+                                                       env.modelchecker().getHybridAcyclicLayers());
+        } else if (!maybeStates.isZero()) {
             storm::utility::Stopwatch conversionWatch;
 
             // Create the ODD for the translation between symbolic and explicit storage.
@@ -121,6 +124,133 @@ std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUn
     }
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+storm::dd::Add<DdType, ValueType> solveAcyclicPart(storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                   storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& states,
+                                                   storm::dd::Add<DdType, ValueType> const& knownValues, uint64_t numberOfLayers) {
+    storm::dd::Add<DdType, ValueType> statesAdd = states.template toAdd<ValueType>();
+    storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * statesAdd;
+    storm::dd::Add<DdType, ValueType> b =
+        (submatrix * knownValues.swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+    submatrix *= statesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+
+    // As the states are acyclic, the values of the states in the i-th layer are exact after i iterations. Hence, the
+    // iteration reaches a fixed point after at most numberOfLayers iterations.
+    storm::dd::Add<DdType, ValueType> x = b;
+    for (uint64_t iteration = 0; iteration < numberOfLayers; ++iteration) {
+        storm::dd::Add<DdType, ValueType> nextX =
+            submatrix.multiplyMatrix(x.swapVariables(model.getRowColumnMetaVariablePairs()), model.getColumnVariables()) + b;
+        if (nextX == x) {
+            break;
+        }
+        x = nextX;
+    }
+    return x;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilitiesDecomposed(
+    Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+    storm::dd::Bdd<DdType> const& maybeStates, storm::dd::Bdd<DdType> const& statesWithProbability1, uint64_t maximalNumberOfLayers) {
+    storm::dd::Bdd<DdType> maybeTransitions = transitionMatrix.notZero() && maybeStates;
+
+    // Peel off the maybe states all of whose maybe successors have already been peeled off.
+    storm::dd::Bdd<DdType> sinkSideStates = model.getManager().getBddZero();
+    storm::dd::Bdd<DdType> remainingStates = maybeStates;
+    uint64_t sinkSideLayers = 0;
+    for (; sinkSideLayers < maximalNumberOfLayers; ++sinkSideLayers) {
+        storm::dd::Bdd<DdType> statesWithRemainingSuccessor =
+            maybeTransitions.andExists(remainingStates.swapVariables(model.getRowColumnMetaVariablePairs()), model.getColumnVariables());
+        storm::dd::Bdd<DdType> layer = remainingStates && !statesWithRemainingSuccessor;
+        if (layer.isZero()) {
+            break;
+        }
+        sinkSideStates |= layer;
+        remainingStates &= !layer;
+    }
+
+    // Peel off the remaining states all of whose remaining predecessors have already been peeled off.
+    storm::dd::Bdd<DdType> sourceSideStates = model.getManager().getBddZero();
+    uint64_t sourceSideLayers = 0;
+    for (; sourceSideLayers < maximalNumberOfLayers; ++sourceSideLayers) {
+        storm::dd::Bdd<DdType> statesWithRemainingPredecessor =
+            (maybeTransitions && remainingStates).existsAbstract(model.getRowVariables()).swapVariables(model.getRowColumnMetaVariablePairs());
+        storm::dd::Bdd<DdType> layer = remainingStates && !statesWithRemainingPredecessor;
+        if (layer.isZero()) {
+            break;
+        }
+        sourceSideStates |= layer;
+        remainingStates &= !layer;
+    }
+    STORM_LOG_INFO("Decomposition: " << sinkSideStates.getNonZeroCount() << " acyclic states in " << sinkSideLayers << " layers towards the targets, "
+                                     << sourceSideStates.getNonZeroCount() << " acyclic states in " << sourceSideLayers
+                                     << " layers towards the initial states (" << remainingStates.getNonZeroCount() << " states remaining).");
+
+    // The states on the side of the targets only have successors with known values, so they are solved first.
+    storm::dd::Add<DdType, ValueType> symbolicValues = statesWithProbability1.template toAdd<ValueType>();
+    if (!sinkSideStates.isZero()) {
+        symbolicValues += solveAcyclicPart(model, transitionMatrix, sinkSideStates, symbolicValues, sinkSideLayers);
+    }
+
+    // If no states remain, the states on the side of the initial states only depend on values that are known already.
+    if (remainingStates.isZero()) {
+        if (!sourceSideStates.isZero()) {
+            symbolicValues += solveAcyclicPart(model, transitionMatrix, sourceSideStates, symbolicValues, sourceSideLayers);
+        }
+        return std::unique_ptr<CheckResult>(
+            new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), symbolicValues));
+    }
+
+    // Solve the remaining states explicitly.
+    storm::utility::Stopwatch conversionWatch(true);
+    storm::dd::Odd odd = remainingStates.createOdd();
+    storm::dd::Add<DdType, ValueType> remainingStatesAdd = remainingStates.template toAdd<ValueType>();
+    storm::dd::Add<DdType, ValueType> submatrix = transitionMatrix * remainingStatesAdd;
+    storm::dd::Add<DdType, ValueType> subvector =
+        (submatrix * symbolicValues.swapVariables(model.getRowColumnMetaVariablePairs())).sumAbstract(model.getColumnVariables());
+
+    storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+    auto req = linearEquationSolverFactory.getRequirements(env);
+    req.clearLowerBounds();
+    req.clearUpperBounds();
+    STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
+                    "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
+
+    submatrix *= remainingStatesAdd.swapVariables(model.getRowColumnMetaVariablePairs());
+    if (linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem) {
+        submatrix = (model.getRowColumnIdentity() * remainingStatesAdd) - submatrix;
+    }
+
+    std::vector<ValueType> x(remainingStates.getNonZeroCount(), storm::utility::convertNumber<ValueType>(0.5));
+    storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+    std::vector<ValueType> b = subvector.toVector(odd);
+    conversionWatch.stop();
+    STORM_LOG_INFO("Converting symbolic matrix/vector of the remaining states to explicit representation done in " << conversionWatch.getTimeInMilliseconds()
+                                                                                                                    << "ms.");
+
+    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+    solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+    solver->solveEquations(env, x, b);
+
+    // The states on the side of the initial states may depend on the values of the remaining states. We only translate
+    // the values of those remaining states that actually have a predecessor on that side back to the symbolic representation.
+    if (!sourceSideStates.isZero()) {
+        storm::dd::Bdd<DdType> boundaryStates =
+            (maybeTransitions && sourceSideStates).existsAbstract(model.getRowVariables()).swapVariables(model.getRowColumnMetaVariablePairs()) &&
+            remainingStates;
+        std::vector<ValueType> boundaryValues(x.size(), storm::utility::zero<ValueType>());
+        for (auto index : boundaryStates.toVector(odd)) {
+            boundaryValues[index] = x[index];
+        }
+        storm::dd::Add<DdType, ValueType> knownValues =
+            symbolicValues + storm::dd::Add<DdType, ValueType>::fromVector(model.getManager(), boundaryValues, odd, model.getRowVariables());
+        symbolicValues += solveAcyclicPart(model, transitionMatrix, sourceSideStates, knownValues, sourceSideLayers);
+    }
+
+    return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(
+        model.getReachableStates(), model.getReachableStates() && !remainingStates, symbolicValues, remainingStates, odd, x));
+}
+
 template<storm::dd::DdType DdType, typename ValueType>
 std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeGloballyProbabilities(
     Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix,
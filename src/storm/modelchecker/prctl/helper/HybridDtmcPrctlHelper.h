@@ -57,6 +57,21 @@ class HybridDtmcPrctlHelper {
     static std::unique_ptr<CheckResult> computeReachabilityTimes(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model,
                                                                  storm::dd::Add<DdType, ValueType> const& transitionMatrix,
                                                                  storm::dd::Bdd<DdType> const& targetStates, bool qualitative);
+
+   private:
+    /*!
+     * Computes the until probabilities of the maybe states. Maybe states that can not reach a cycle of maybe states
+     * and maybe states that can not be reached from such a cycle are peeled off layer by layer. They form acyclic
+     * parts that are solved symbolically. Only the remaining states are converted to an explicit equation system.
+     *
+     * @param maximalNumberOfLayers The maximal number of layers that are peeled off on either side.
+     */
+    static std::unique_ptr<CheckResult> computeUntilProbabilitiesDecomposed(Environment const& env,
+                                                                            storm::models::symbolic::Model<DdType, ValueType> const& model,
+                                                                            storm::dd::Add<DdType, ValueType> const& transitionMatrix,
+                                                                            storm::dd::Bdd<DdType> const& maybeStates,
+                                                                            storm::dd::Bdd<DdType> const& statesWithProbability1,
+                                                                            uint64_t maximalNumberOfLayers);
 };
 
 }  // namespace helper
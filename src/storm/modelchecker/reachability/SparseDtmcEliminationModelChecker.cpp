@@ -878,17 +878,12 @@ void SparseDtmcEliminationModelChecker<SparseDtmcModelType>::performPrioritizedS
     bool computeResultsForInitialStatesOnly) {
     storm::solver::stateelimination::PrioritizedStateEliminator<ValueType> stateEliminator(transitionMatrix, backwardTransitions, priorityQueue, values);
 
-    while (priorityQueue->hasNext()) {
-        storm::storage::sparse::state_type state = priorityQueue->pop();
-        bool removeForwardTransitions = computeResultsForInitialStatesOnly && !initialStates.get(state);
-        stateEliminator.eliminateState(state, removeForwardTransitions);
-        if (removeForwardTransitions) {
-            values[state] = storm::utility::zero<ValueType>();
-        }
+    stateEliminator.eliminateAll(
+        [&](storm::storage::sparse::state_type const& state) { return computeResultsForInitialStatesOnly && !initialStates.get(state); },
+        storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads());
 #ifdef STORM_DEV
-        STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
+    STORM_LOG_ASSERT(checkConsistent(transitionMatrix, backwardTransitions), "The forward and backward transition matrices became inconsistent.");
 #endif
-    }
 }
 
 template<typename SparseDtmcModelType>
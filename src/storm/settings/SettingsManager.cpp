@@ -675,6 +675,11 @@ storm::settings::modules::AbstractionSettings& mutableAbstractionSettings() {
     return dynamic_cast<storm::settings::modules::AbstractionSettings&>(mutableManager().getModule(storm::settings::modules::AbstractionSettings::moduleName));
 }
 
+storm::settings::modules::BisimulationSettings& mutableBisimulationSettings() {
+    return dynamic_cast<storm::settings::modules::BisimulationSettings&>(
+        mutableManager().getModule(storm::settings::modules::BisimulationSettings::moduleName));
+}
+
 void initializeAll(std::string const& name, std::string const& executableName) {
     storm::settings::mutableManager().setName(name, executableName);
 
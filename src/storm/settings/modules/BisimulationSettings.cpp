@@ -22,6 +22,8 @@ const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+const std::string BisimulationSettings::sparseThreadsOptionName = "sparsethreads";
+const std::string BisimulationSettings::sylvanTableCapacityOptionName = "sylvantable";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> types = {"strong", "weak"};
@@ -91,6 +93,26 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseThreadsOptionName, true,
+                                                   "Sets the number of threads used for the bisimulation of sparse models. If larger than one, the "
+                                                   "partition is refined in rounds based on the signatures of all states.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, sylvanTableCapacityOptionName, true,
+                                                   "Sets the initial number of entries of the block table used by the Sylvan signature refiner. The table "
+                                                   "grows on demand.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of entries.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1ull << 20)
+                                         .build())
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -173,6 +195,18 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+uint64_t BisimulationSettings::getNumberOfSparseThreads() const {
+    return this->getOption(sparseThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t BisimulationSettings::getSylvanRefinerTableCapacity() const {
+    return this->getOption(sylvanTableCapacityOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+void BisimulationSettings::setSylvanRefinerTableCapacity(uint64_t value) {
+    this->getOption(sylvanTableCapacityOptionName).getArgumentByName("count").setFromStringValue(std::to_string(value));
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
@@ -96,6 +96,23 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the number of threads used for the bisimulation of sparse models.
+     */
+    uint64_t getNumberOfSparseThreads() const;
+
+    /*!
+     * Retrieves the initial number of entries of the block table used by the Sylvan signature refiner.
+     */
+    uint64_t getSylvanRefinerTableCapacity() const;
+
+    /*!
+     * Sets the initial number of entries of the block table used by the Sylvan signature refiner.
+     *
+     * @param value The capacity to set. Must be positive.
+     */
+    void setSylvanRefinerTableCapacity(uint64_t value);
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -113,6 +130,8 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
     static const std::string exactArithmeticDdOptionName;
+    static const std::string sparseThreadsOptionName;
+    static const std::string sylvanTableCapacityOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -20,8 +20,10 @@ const std::string BuildSettings::moduleName = "build";
 
 const std::string explorationOrderOptionName = "explorder";
 const std::string explorationOrderOptionShortName = "eo";
+const std::string explorationThreadsOptionName = "explthreads";
 const std::string explorationChecksOptionName = "explchecks";
 const std::string explorationChecksOptionShortName = "ec";
+const std::string compileExpressionsOptionName = "compile-expressions";
 const std::string prismCompatibilityOptionName = "prismcompat";
 const std::string prismCompatibilityOptionShortName = "pc";
 const std::string dontFixDeadlockOptionName = "nofixdl";
@@ -80,10 +82,24 @@ BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("bfs")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOptionName, false,
+                                                   "Sets the number of threads used for explicit state-space exploration and for parsing models in "
+                                                   "the DRN format. Only breadth-first exploration is parallelized.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false,
                                                    "If set, additional checks (if available) are performed during model exploration to debug the model.")
                         .setShortName(explorationChecksOptionShortName)
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, compileExpressionsOptionName, false,
+                                                   "If set, guards, probabilities and assignments of PRISM commands are compiled to instructions that "
+                                                   "operate directly on the compressed states during explicit exploration.")
+                        .setIsAdvanced()
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added")
                         .setIsAdvanced()
                         .build());
@@ -183,10 +199,18 @@ storm::builder::ExplorationOrder BuildSettings::getExplorationOrder() const {
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
 }
 
+uint64_t BuildSettings::getNumberOfExplorationThreads() const {
+    return this->getOption(explorationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool BuildSettings::isExplorationChecksSet() const {
     return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
 }
 
+bool BuildSettings::isCompileExpressionsSet() const {
+    return this->getOption(compileExpressionsOptionName).getHasOptionBeenSet();
+}
+
 bool BuildSettings::isNoSimplifySet() const {
     return this->getOption(noSimplifyOptionName).getHasOptionBeenSet();
 }
@@ -28,6 +28,13 @@ class BuildSettings : public ModuleSettings {
      */
     bool isExplorationChecksSet() const;
 
+    /*!
+     * Retrieves whether the guards and updates of PRISM commands are to be compiled for the explicit exploration.
+     *
+     * @return True if the expressions are to be compiled.
+     */
+    bool isCompileExpressionsSet() const;
+
     /*!
      * Retrieves the exploration order if it was set.
      *
@@ -35,6 +42,13 @@ class BuildSettings : public ModuleSettings {
      */
     storm::builder::ExplorationOrder getExplorationOrder() const;
 
+    /*!
+     * Retrieves the number of threads to use for explicit state-space exploration and for parsing DRN files.
+     *
+     * @return The number of exploration threads.
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
     /*!
      * Retrieves whether the PRISM compatibility mode was enabled.
      *
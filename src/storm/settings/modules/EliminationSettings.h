@@ -15,7 +15,17 @@ class EliminationSettings : public ModuleSettings {
     /*!
      * An enum that contains all available state elimination orders.
      */
-    enum class EliminationOrder { Forward, ForwardReversed, Backward, BackwardReversed, Random, StaticPenalty, DynamicPenalty, RegularExpression };
+    enum class EliminationOrder {
+        Forward,
+        ForwardReversed,
+        Backward,
+        BackwardReversed,
+        Random,
+        StaticPenalty,
+        DynamicPenalty,
+        RegularExpression,
+        ApproximateMinimumDegree
+    };
 
     /*!
      * An enum that contains all available elimination methods.
@@ -62,6 +72,13 @@ class EliminationSettings : public ModuleSettings {
      */
     bool isUseDedicatedModelCheckerSet() const;
 
+    /*!
+     * Retrieves the number of threads that eliminate independent states concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
     const static std::string moduleName;
 
    private:
@@ -70,6 +87,7 @@ class EliminationSettings : public ModuleSettings {
     const static std::string entryStatesLastOptionName;
     const static std::string maximalSccSizeOptionName;
     const static std::string useDedicatedModelCheckerOptionName;
+    const static std::string threadsOptionName;
 };
 
 }  // namespace modules
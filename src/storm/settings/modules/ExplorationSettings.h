@@ -79,6 +79,13 @@ class ExplorationSettings : public ModuleSettings {
      */
     double getPrecision() const;
 
+    /*!
+     * Retrieves the number of threads that sample paths concurrently.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfThreads() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -92,6 +99,7 @@ class ExplorationSettings : public ModuleSettings {
     static const std::string nextStateHeuristicOptionName;
     static const std::string precisionOptionName;
     static const std::string precisionOptionShortName;
+    static const std::string threadsOptionName;
 };
 }  // namespace modules
 }  // namespace settings
@@ -14,6 +14,9 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::ltlOnTheFlyProductOptionName = "ltlonthefly";
+const std::string ModelCheckerSettings::graphThreadsOptionName = "graphthreads";
+const std::string ModelCheckerSettings::hybridAcyclicLayersOptionName = "hybridacyclic";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +30,30 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, ltlOnTheFlyProductOptionName, false,
+                                                   "If set, the product of a sparse model and the automaton of an LTL formula is explored on the fly. "
+                                                   "Product states whose acceptance is already decided by the automaton are not explored.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, graphThreadsOptionName, false,
+                                                   "Sets the number of threads used for the qualitative (prob0/prob1) graph analyses of sparse models. "
+                                                   "With more than one thread, the analyses are performed as parallel breadth-first searches.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, hybridAcyclicLayersOptionName, false,
+                                                   "If set, the hybrid engine solves the acyclic parts of the equation system for DTMC until probabilities "
+                                                   "symbolically and only converts the remaining states to an explicit representation.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "layers", "The maximal number of acyclic layers that are solved symbolically on either side of the remaining states.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1000)
+                                         .build())
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +68,22 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isLtlOnTheFlyProductSet() const {
+    return this->getOption(ltlOnTheFlyProductOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfGraphThreads() const {
+    return this->getOption(graphThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool ModelCheckerSettings::isHybridAcyclicLayersSet() const {
+    return this->getOption(hybridAcyclicLayersOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getHybridAcyclicLayers() const {
+    return this->getOption(hybridAcyclicLayersOptionName).getArgumentByName("layers").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -35,6 +35,34 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves whether the product of the model and the automaton for LTL formulas is to be explored on the fly.
+     *
+     * @return True iff the option was set.
+     */
+    bool isLtlOnTheFlyProductSet() const;
+
+    /*!
+     * Retrieves the number of threads that are used for the qualitative graph analyses of sparse models.
+     *
+     * @return The number of threads.
+     */
+    uint64_t getNumberOfGraphThreads() const;
+
+    /*!
+     * Retrieves whether the hybrid engine is to solve the acyclic parts of equation systems symbolically.
+     *
+     * @return True iff the option was set.
+     */
+    bool isHybridAcyclicLayersSet() const;
+
+    /*!
+     * Retrieves the maximal number of acyclic layers that the hybrid engine solves symbolically.
+     *
+     * @return The number of layers.
+     */
+    uint64_t getHybridAcyclicLayers() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +70,9 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string ltlOnTheFlyProductOptionName;
+    static const std::string graphThreadsOptionName;
+    static const std::string hybridAcyclicLayersOptionName;
 };
 
 }  // namespace modules
@@ -24,6 +24,7 @@ const std::string NativeEquationSolverSettings::precisionOptionName = "precision
 const std::string NativeEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
 const std::string NativeEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string NativeEquationSolverSettings::parallelChunkSizeOptionName = "parallelchunks";
 
 NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> methods = {"jacobi", "gaussseidel",           "sor", "walkerchae",
@@ -80,6 +81,16 @@ NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(mo
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, parallelChunkSizeOptionName, false,
+                                                   "If set, (optimistic) value iteration processes chunks of row groups in parallel. Requires Intel TBB.")
+                        .setIsAdvanced()
+                        .addArgument(
+                            storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("entries", "The targeted number of matrix entries per chunk.")
+                                .setDefaultValueUnsignedInteger(1ull << 16)
+                                .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                .build())
+                        .build());
 }
 
 bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -159,6 +170,14 @@ bool NativeEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet()
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
 
+bool NativeEquationSolverSettings::isParallelChunkSizeSet() const {
+    return this->getOption(parallelChunkSizeOptionName).getHasOptionBeenSet();
+}
+
+uint64_t NativeEquationSolverSettings::getParallelChunkSize() const {
+    return this->getOption(parallelChunkSizeOptionName).getArgumentByName("entries").getValueAsUnsignedInteger();
+}
+
 bool NativeEquationSolverSettings::check() const {
     return true;
 }
@@ -105,6 +105,20 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MultiplicationStyle getPowerMethodMultiplicationStyle() const;
 
+    /*!
+     * Retrieves whether the value iteration operator is to be applied in parallel chunks.
+     *
+     * @return True iff the parallel chunk size has been set.
+     */
+    bool isParallelChunkSizeSet() const;
+
+    /*!
+     * Retrieves the targeted number of matrix entries per chunk when applying the value iteration operator in parallel.
+     *
+     * @return The number of matrix entries per chunk.
+     */
+    uint64_t getParallelChunkSize() const;
+
     /*!
      * Retrieves whether the  force bounds option has been set.
      */
@@ -126,6 +140,7 @@ class NativeEquationSolverSettings : public ModuleSettings {
     static const std::string intervalIterationSymmetricUpdatesOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
     static const std::string forceBoundsOptionName;
+    static const std::string parallelChunkSizeOptionName;
 };
 
 }  // namespace modules
@@ -24,6 +24,11 @@ void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::setSeed(uint6
     generator = storm::utility::RandomProbabilityGenerator<ValueType>(seed);
 }
 
+template<typename ValueType, typename RewardModelType>
+void DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::buildAliasTables(uint64_t minimalRowLength, uint64_t maximalNumberOfEntries) {
+    aliasTables.emplace(model.getTransitionMatrix(), minimalRowLength, maximalNumberOfEntries);
+}
+
 template<typename ValueType, typename RewardModelType>
 bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::randomStep() {
     // TODO random_uint is slow
@@ -48,23 +53,33 @@ bool DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t
         }
         ++i;
     }
+    currentState = sampleSuccessor(row, probability);
+    i = 0;
+    for (auto const& rewModPair : model.getRewardModels()) {
+        if (rewModPair.second.hasStateRewards()) {
+            lastRewards[i] += rewModPair.second.getStateReward(currentState);
+        }
+        ++i;
+    }
+    return true;
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t DiscreteTimeSparseModelSimulator<ValueType, RewardModelType>::sampleSuccessor(uint64_t row, ValueType const& probability) const {
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    if (aliasTables && aliasTables->hasTable(row)) {
+        return (transitionMatrix.begin(row) + aliasTables->sample(row, storm::utility::convertNumber<double>(probability)))->getColumn();
+    }
     ValueType sum = storm::utility::zero<ValueType>();
-    for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
+    for (auto const& entry : transitionMatrix.getRow(row)) {
         sum += entry.getValue();
         if (sum >= probability) {
-            currentState = entry.getColumn();
-            i = 0;
-            for (auto const& rewModPair : model.getRewardModels()) {
-                if (rewModPair.second.hasStateRewards()) {
-                    lastRewards[i] += rewModPair.second.getStateReward(currentState);
-                }
-                ++i;
-            }
-            return true;
+            return entry.getColumn();
         }
     }
-    // This position should never be reached
-    return false;
+    // Due to rounding, the probabilities may sum up to slightly less than one.
+    STORM_LOG_ASSERT(transitionMatrix.begin(row) != transitionMatrix.end(row), "Row " << row << " has no successors.");
+    return (transitionMatrix.end(row) - 1)->getColumn();
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -1,5 +1,8 @@
 #include <cstdint>
+#include <limits>
+#include <boost/optional.hpp>
 #include "storm/models/sparse/Model.h"
+#include "storm/storage/AliasTables.h"
 #include "storm/utility/random.h"
 
 namespace storm {
@@ -18,6 +21,14 @@ class DiscreteTimeSparseModelSimulator {
    public:
     DiscreteTimeSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model);
     void setSeed(uint64_t);
+    /**
+     * Builds alias tables for the rows of the transition matrix that have at least the given number of successors,
+     * such that successors of these rows are sampled in constant time.
+     *
+     * @param minimalRowLength The minimal number of successors of rows that get a table.
+     * @param maximalNumberOfEntries The maximal number of entries of all tables combined. The longest rows are preferred.
+     */
+    void buildAliasTables(uint64_t minimalRowLength = 8, uint64_t maximalNumberOfEntries = std::numeric_limits<uint64_t>::max());
     bool step(uint64_t action);
     bool randomStep();
     std::vector<ValueType> const& getLastRewards() const;
@@ -25,11 +36,14 @@ class DiscreteTimeSparseModelSimulator {
     bool resetToInitial();
 
    protected:
+    uint64_t sampleSuccessor(uint64_t row, ValueType const& probability) const;
+
     storm::models::sparse::Model<ValueType, RewardModelType> const& model;
     uint64_t currentState;
     std::vector<ValueType> lastRewards;
     std::vector<ValueType> zeroRewards;
     storm::utility::RandomProbabilityGenerator<ValueType> generator;
+    boost::optional<storm::storage::AliasTables<ValueType>> aliasTables;
 };
 }  // namespace simulator
 }  // namespace storm
\ No newline at end of file
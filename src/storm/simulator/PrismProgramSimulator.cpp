@@ -85,6 +85,11 @@ std::vector<std::string> DiscreteTimePrismProgramSimulator<ValueType>::getCurren
     return labels;
 }
 
+template<typename ValueType>
+bool DiscreteTimePrismProgramSimulator<ValueType>::evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const& expression) const {
+    return stateGenerator->evaluateBooleanExpressionInCurrentState(expression);
+}
+
 template<typename ValueType>
 std::vector<generator::Choice<ValueType, uint32_t>> const& DiscreteTimePrismProgramSimulator<ValueType>::getChoices() const {
     return behavior.getChoices();
@@ -61,6 +61,11 @@ class DiscreteTimePrismProgramSimulator {
     expressions::SimpleValuation getCurrentStateAsValuation() const;
     std::vector<std::string> getCurrentStateLabelling() const;
 
+    /**
+     * Evaluates the given boolean expression over the variables of the program in the current state.
+     */
+    bool evaluateBooleanExpressionInCurrentState(storm::expressions::Expression const& expression) const;
+
     storm::json<ValueType> getStateAsJson() const;
 
     storm::json<ValueType> getObservationAsJson() const;
@@ -0,0 +1,116 @@
+#include "storm/simulator/PrismStatisticalModelChecker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "storm-config.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/simulator/PrismProgramSimulator.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/random.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#endif
+
+namespace storm {
+namespace simulator {
+
+// The number of traces that a thread claims at once.
+uint64_t const tracesPerTask = 64;
+
+template<typename ValueType>
+PrismStatisticalModelChecker<ValueType>::PrismStatisticalModelChecker(storm::prism::Program const& program, StatisticalModelCheckingOptions const& options,
+                                                                      storm::generator::NextStateGeneratorOptions const& generatorOptions)
+    : program(program), options(options), generatorOptions(generatorOptions) {
+    STORM_LOG_THROW(program.getModelType() == storm::prism::Program::ModelType::DTMC || program.getModelType() == storm::prism::Program::ModelType::MDP,
+                    storm::exceptions::InvalidArgumentException,
+                    "Statistical model checking is only supported for DTMCs and MDPs, got " << program.getModelType() << ".");
+    STORM_LOG_THROW(!program.hasUndefinedConstants(), storm::exceptions::InvalidArgumentException, "The program has undefined constants.");
+    checkStatisticalModelCheckingOptions(options);
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(options.numberOfThreads <= 1, "Storm was built without support for Intel TBB, defaulting to sequential sampling.");
+#endif
+}
+
+template<typename ValueType>
+StatisticalModelCheckingResult PrismStatisticalModelChecker<ValueType>::computeBoundedUntilProbability(storm::expressions::Expression const& phi,
+                                                                                                        storm::expressions::Expression const& psi,
+                                                                                                        uint64_t stepBound) const {
+    // The simulators keep the state of their current trace, so every thread needs its own. They are created upfront, as
+    // creating next-state generators concurrently is not safe.
+    uint64_t numberOfSimulators = 1;
+#ifdef STORM_HAVE_INTELTBB
+    numberOfSimulators = std::max<uint64_t>(options.numberOfThreads, 1);
+#endif
+    std::vector<std::unique_ptr<DiscreteTimePrismProgramSimulator<ValueType>>> simulators;
+    for (uint64_t simulatorIndex = 0; simulatorIndex < numberOfSimulators; ++simulatorIndex) {
+        simulators.push_back(std::make_unique<DiscreteTimePrismProgramSimulator<ValueType>>(program, generatorOptions));
+    }
+
+    return estimateProbabilityFromTraces(options, [&](uint64_t firstTrace, uint64_t endTrace) {
+        std::atomic<uint64_t> nextTrace(firstTrace);
+        std::atomic<uint64_t> numberOfSuccessfulTraces(0);
+        auto sampleWithSimulator = [&](DiscreteTimePrismProgramSimulator<ValueType>& simulator) {
+            uint64_t localNumberOfSuccessfulTraces = 0;
+            for (uint64_t chunkStart = nextTrace.fetch_add(tracesPerTask); chunkStart < endTrace; chunkStart = nextTrace.fetch_add(tracesPerTask)) {
+                for (uint64_t trace = chunkStart, chunkEnd = std::min(chunkStart + tracesPerTask, endTrace); trace < chunkEnd; ++trace) {
+                    if (sampleTrace(simulator, trace, phi, psi, stepBound)) {
+                        ++localNumberOfSuccessfulTraces;
+                    }
+                }
+            }
+            numberOfSuccessfulTraces += localNumberOfSuccessfulTraces;
+        };
+#ifdef STORM_HAVE_INTELTBB
+        if (numberOfSimulators > 1) {
+            tbb::task_arena arena(static_cast<int>(numberOfSimulators));
+            arena.execute([&] {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfSimulators, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t simulatorIndex = range.begin(); simulatorIndex < range.end(); ++simulatorIndex) {
+                        sampleWithSimulator(*simulators[simulatorIndex]);
+                    }
+                });
+            });
+            return numberOfSuccessfulTraces.load();
+        }
+#endif
+        sampleWithSimulator(*simulators.front());
+        return numberOfSuccessfulTraces.load();
+    });
+}
+
+template<typename ValueType>
+bool PrismStatisticalModelChecker<ValueType>::sampleTrace(DiscreteTimePrismProgramSimulator<ValueType>& simulator, uint64_t trace,
+                                                          storm::expressions::Expression const& phi, storm::expressions::Expression const& psi,
+                                                          uint64_t stepBound) const {
+    // The simulator samples the successors itself, so it is reseeded from the stream of the trace.
+    storm::utility::CounterBasedRandomGenerator generator(options.seed, trace);
+    simulator.setSeed(generator.random_uint(0, std::numeric_limits<uint32_t>::max()));
+    simulator.resetToInitial();
+    for (uint64_t step = 0;; ++step) {
+        if (simulator.evaluateBooleanExpressionInCurrentState(psi)) {
+            return true;
+        }
+        if (step == stepBound || !simulator.evaluateBooleanExpressionInCurrentState(phi)) {
+            return false;
+        }
+        auto const& choices = simulator.getChoices();
+        if (choices.empty()) {
+            // A deadlock state is never left.
+            return false;
+        }
+        simulator.step(choices.size() > 1 ? generator.random_uint(0, choices.size() - 1) : 0);
+    }
+}
+
+template class PrismStatisticalModelChecker<double>;
+
+}  // namespace simulator
+}  // namespace storm
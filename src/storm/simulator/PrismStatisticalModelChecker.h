@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/simulator/StatisticalModelChecking.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace simulator {
+
+template<typename ValueType>
+class DiscreteTimePrismProgramSimulator;
+
+/**
+ * This class estimates the probabilities of bounded properties of discrete-time PRISM programs by sampling traces
+ * through the DiscreteTimePrismProgramSimulator. In contrast to the SparseStatisticalModelChecker, the state space is
+ * never built, so this also works for models that are too large to be stored explicitly. The price is that every step
+ * of a trace expands the current state via the next-state generator and that traces can not be cut off as soon as
+ * the target became unreachable.
+ *
+ * Nondeterminism is resolved uniformly at random. Every trace draws its random numbers from its own stream, so the
+ * result only depends on the seed and not on the number of threads that sample the traces.
+ *
+ * @tparam ValueType
+ */
+template<typename ValueType>
+class PrismStatisticalModelChecker {
+   public:
+    /**
+     * @param program The program, which must be a DTMC or an MDP with a unique initial state and without undefined constants.
+     * @param options The options of the statistical model checker. The alias table options are not used.
+     * @param generatorOptions The options used for generating the successors of states.
+     */
+    PrismStatisticalModelChecker(storm::prism::Program const& program, StatisticalModelCheckingOptions const& options = StatisticalModelCheckingOptions(),
+                                 storm::generator::NextStateGeneratorOptions const& generatorOptions = storm::generator::NextStateGeneratorOptions());
+
+    /**
+     * Estimates the probability to satisfy phi until psi within the given number of steps.
+     *
+     * @param phi An expression over the program variables that holds in the phi states.
+     * @param psi An expression over the program variables that holds in the psi states.
+     * @param stepBound The maximal number of steps of a trace.
+     */
+    StatisticalModelCheckingResult computeBoundedUntilProbability(storm::expressions::Expression const& phi, storm::expressions::Expression const& psi,
+                                                                  uint64_t stepBound) const;
+
+   private:
+    bool sampleTrace(DiscreteTimePrismProgramSimulator<ValueType>& simulator, uint64_t trace, storm::expressions::Expression const& phi,
+                     storm::expressions::Expression const& psi, uint64_t stepBound) const;
+
+    storm::prism::Program const& program;
+    StatisticalModelCheckingOptions options;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+};
+}  // namespace simulator
+}  // namespace storm
@@ -0,0 +1,157 @@
+#include "storm/simulator/SparseStatisticalModelChecker.h"
+
+#include <atomic>
+
+#include "storm-config.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#endif
+
+namespace storm {
+namespace simulator {
+
+namespace {
+template<typename ValueType, typename RewardModelType>
+uint64_t getInitialStateOfDiscreteTimeModel(storm::models::sparse::Model<ValueType, RewardModelType> const& model) {
+    // The transition matrices of continuous-time models hold rates, which must not be sampled like probabilities.
+    STORM_LOG_THROW(model.getType() == storm::models::ModelType::Dtmc || model.getType() == storm::models::ModelType::Mdp,
+                    storm::exceptions::InvalidArgumentException,
+                    "Statistical model checking is only supported for DTMCs and MDPs, got " << model.getType() << ".");
+    STORM_LOG_THROW(!model.getInitialStates().empty(), storm::exceptions::InvalidArgumentException, "The model has no initial state.");
+    STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1,
+                        "The model has multiple initial states. The traces start from the initial state with the lowest index.");
+    return *model.getInitialStates().begin();
+}
+}  // namespace
+
+template<typename ValueType, typename RewardModelType>
+SparseStatisticalModelChecker<ValueType, RewardModelType>::SparseStatisticalModelChecker(storm::models::sparse::Model<ValueType, RewardModelType> const& model,
+                                                                                         StatisticalModelCheckingOptions const& options)
+    : model(model),
+      options(options),
+      initialState(getInitialStateOfDiscreteTimeModel(model)),
+      rowGroupIndices(model.getTransitionMatrix().getRowGroupIndices()),
+      aliasTables(model.getTransitionMatrix(), options.minimalRowLengthForAliasTables, options.maximalNumberOfAliasTableEntries) {
+    checkStatisticalModelCheckingOptions(options);
+#ifndef STORM_HAVE_INTELTBB
+    STORM_LOG_WARN_COND(options.numberOfThreads <= 1, "Storm was built without support for Intel TBB, defaulting to sequential sampling.");
+#endif
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t SparseStatisticalModelChecker<ValueType, RewardModelType>::getNumberOfTracesForChernoffHoeffdingBound(double precision, double errorProbability) {
+    return storm::simulator::getNumberOfTracesForChernoffHoeffdingBound(precision, errorProbability);
+}
+
+template<typename ValueType, typename RewardModelType>
+StatisticalModelCheckingResult SparseStatisticalModelChecker<ValueType, RewardModelType>::computeBoundedUntilProbability(
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, uint64_t stepBound) const {
+    // Traces may be stopped as soon as they reach a state from which psi is unreachable within the step bound.
+    storm::storage::BitVector relevantStates =
+        storm::utility::graph::performProbGreater0(model.getBackwardTransitions(), phiStates, psiStates, true, stepBound);
+
+    if (!relevantStates.get(initialState)) {
+        STORM_LOG_INFO("The initial state cannot reach psi, no traces are sampled.");
+        StatisticalModelCheckingResult result;
+        result.estimate = 0.0;
+        result.numberOfTraces = 0;
+        result.numberOfSuccessfulTraces = 0;
+        return result;
+    }
+
+    return estimateProbabilityFromTraces(options, [&](uint64_t firstTrace, uint64_t endTrace) {
+        return sampleTraces(firstTrace, endTrace, relevantStates, psiStates, stepBound);
+    });
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t SparseStatisticalModelChecker<ValueType, RewardModelType>::sampleTraces(uint64_t firstTrace, uint64_t endTrace,
+                                                                                 storm::storage::BitVector const& relevantStates,
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t stepBound) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (options.numberOfThreads > 1) {
+        std::atomic<uint64_t> numberOfSuccessfulTraces(0);
+        tbb::task_arena arena(static_cast<int>(options.numberOfThreads));
+        arena.execute([&] {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(firstTrace, endTrace), [&](tbb::blocked_range<uint64_t> const& range) {
+                uint64_t localNumberOfSuccessfulTraces = 0;
+                for (uint64_t trace = range.begin(); trace < range.end(); ++trace) {
+                    storm::utility::CounterBasedRandomGenerator generator(options.seed, trace);
+                    if (sampleTrace(generator, relevantStates, psiStates, stepBound)) {
+                        ++localNumberOfSuccessfulTraces;
+                    }
+                }
+                numberOfSuccessfulTraces += localNumberOfSuccessfulTraces;
+            });
+        });
+        return numberOfSuccessfulTraces.load();
+    }
+#endif
+    uint64_t numberOfSuccessfulTraces = 0;
+    for (uint64_t trace = firstTrace; trace < endTrace; ++trace) {
+        storm::utility::CounterBasedRandomGenerator generator(options.seed, trace);
+        if (sampleTrace(generator, relevantStates, psiStates, stepBound)) {
+            ++numberOfSuccessfulTraces;
+        }
+    }
+    return numberOfSuccessfulTraces;
+}
+
+template<typename ValueType, typename RewardModelType>
+bool SparseStatisticalModelChecker<ValueType, RewardModelType>::sampleTrace(storm::utility::CounterBasedRandomGenerator& generator,
+                                                                            storm::storage::BitVector const& relevantStates,
+                                                                            storm::storage::BitVector const& psiStates, uint64_t stepBound) const {
+    uint64_t state = initialState;
+    for (uint64_t step = 0;; ++step) {
+        if (psiStates.get(state)) {
+            return true;
+        }
+        if (step == stepBound || !relevantStates.get(state)) {
+            return false;
+        }
+        state = sampleSuccessor(state, generator);
+    }
+}
+
+template<typename ValueType, typename RewardModelType>
+uint64_t SparseStatisticalModelChecker<ValueType, RewardModelType>::sampleSuccessor(uint64_t state,
+                                                                                    storm::utility::CounterBasedRandomGenerator& generator) const {
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    uint64_t row = rowGroupIndices[state];
+    uint64_t numberOfChoices = rowGroupIndices[state + 1] - row;
+    if (numberOfChoices > 1) {
+        row += generator.random_uint(0, numberOfChoices - 1);
+    }
+
+    if (aliasTables.hasTable(row)) {
+        return (transitionMatrix.begin(row) + aliasTables.sample(row, generator.random()))->getColumn();
+    }
+
+    auto entries = transitionMatrix.getRow(row);
+    STORM_LOG_ASSERT(entries.begin() != entries.end(), "Row " << row << " has no successors.");
+    if (entries.getNumberOfEntries() == 1) {
+        return entries.begin()->getColumn();
+    }
+    double probability = generator.random();
+    double sum = 0.0;
+    for (auto const& entry : entries) {
+        sum += entry.getValue();
+        if (sum > probability) {
+            return entry.getColumn();
+        }
+    }
+    // Due to rounding, the probabilities may sum up to slightly less than one.
+    return (entries.end() - 1)->getColumn();
+}
+
+template class SparseStatisticalModelChecker<double>;
+
+}  // namespace simulator
+}  // namespace storm
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/AliasTables.h"
+#include "storm/simulator/StatisticalModelChecking.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+namespace simulator {
+
+/**
+ * This class estimates the probabilities of bounded properties on Discrete-Time Models stored explicitly as a
+ * SparseModel by sampling many independent traces from the (unique) initial state.
+ * Nondeterminism is resolved uniformly at random, just like DiscreteTimeSparseModelSimulator::randomStep does.
+ *
+ * Every trace draws its random numbers from its own counter-based stream, so the result only depends on the seed and
+ * not on the number of threads that sample the traces.
+ *
+ * For models that are too large to be built, see PrismStatisticalModelChecker.
+ *
+ * @tparam ValueType
+ */
+template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+class SparseStatisticalModelChecker {
+   public:
+    SparseStatisticalModelChecker(storm::models::sparse::Model<ValueType, RewardModelType> const& model,
+                                  StatisticalModelCheckingOptions const& options = StatisticalModelCheckingOptions());
+
+    /**
+     * Estimates the probability to satisfy phi until psi within the given number of steps.
+     *
+     * @param phiStates The states satisfying phi.
+     * @param psiStates The states satisfying psi.
+     * @param stepBound The maximal number of steps of a trace.
+     */
+    StatisticalModelCheckingResult computeBoundedUntilProbability(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                  uint64_t stepBound) const;
+
+    /**
+     * Retrieves the number of traces that the Chernoff-Hoeffding bound requires for the given precision and error probability.
+     */
+    static uint64_t getNumberOfTracesForChernoffHoeffdingBound(double precision, double errorProbability);
+
+   private:
+    /**
+     * Samples the traces with indices in [firstTrace, endTrace) and retrieves how many of them were successful.
+     */
+    uint64_t sampleTraces(uint64_t firstTrace, uint64_t endTrace, storm::storage::BitVector const& relevantStates, storm::storage::BitVector const& psiStates,
+                          uint64_t stepBound) const;
+
+    bool sampleTrace(storm::utility::CounterBasedRandomGenerator& generator, storm::storage::BitVector const& relevantStates,
+                     storm::storage::BitVector const& psiStates, uint64_t stepBound) const;
+
+    uint64_t sampleSuccessor(uint64_t state, storm::utility::CounterBasedRandomGenerator& generator) const;
+
+    storm::models::sparse::Model<ValueType, RewardModelType> const& model;
+    StatisticalModelCheckingOptions options;
+    uint64_t initialState;
+    /// Retrieved upfront as trivial row groupings are created lazily, which must not happen concurrently.
+    std::vector<uint64_t> const& rowGroupIndices;
+    storm::storage::AliasTables<ValueType> aliasTables;
+};
+}  // namespace simulator
+}  // namespace storm
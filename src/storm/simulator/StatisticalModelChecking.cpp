@@ -0,0 +1,83 @@
+#include "storm/simulator/StatisticalModelChecking.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/math/special_functions/beta.hpp>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace simulator {
+
+StatisticalModelCheckingOptions::StatisticalModelCheckingOptions()
+    : precision(1e-2),
+      errorProbability(1e-2),
+      stoppingRule(StoppingRule::ChernoffHoeffding),
+      batchSize(10000),
+      numberOfThreads(1),
+      seed(0),
+      minimalRowLengthForAliasTables(8),
+      maximalNumberOfAliasTableEntries(1ull << 24) {
+    // Intentionally left empty.
+}
+
+void checkStatisticalModelCheckingOptions(StatisticalModelCheckingOptions const& options) {
+    STORM_LOG_THROW(options.precision > 0.0, storm::exceptions::InvalidArgumentException, "The precision must be positive.");
+    STORM_LOG_THROW(options.errorProbability > 0.0 && options.errorProbability < 1.0, storm::exceptions::InvalidArgumentException,
+                    "The error probability must be in (0, 1).");
+    STORM_LOG_THROW(options.batchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+}
+
+uint64_t getNumberOfTracesForChernoffHoeffdingBound(double precision, double errorProbability) {
+    return static_cast<uint64_t>(std::ceil(std::log(2.0 / errorProbability) / (2.0 * precision * precision)));
+}
+
+StatisticalModelCheckingResult estimateProbabilityFromTraces(StatisticalModelCheckingOptions const& options,
+                                                             std::function<uint64_t(uint64_t firstTrace, uint64_t endTrace)> const& sampleTraces) {
+    StatisticalModelCheckingResult result;
+    result.numberOfTraces = 0;
+    result.numberOfSuccessfulTraces = 0;
+
+    uint64_t maximalNumberOfTraces = getNumberOfTracesForChernoffHoeffdingBound(options.precision, options.errorProbability);
+    double errorProbabilityPerLook = 0.0;
+    if (options.stoppingRule == StoppingRule::Sequential) {
+        // Every look at the intermediate estimate may err, so we split the error probability via the union bound: One half
+        // is spent on the Chernoff-Hoeffding bound that limits the number of traces, the other half is divided evenly
+        // among the looks before that bound is reached.
+        maximalNumberOfTraces = getNumberOfTracesForChernoffHoeffdingBound(options.precision, options.errorProbability / 2.0);
+        uint64_t numberOfLooks = (maximalNumberOfTraces + options.batchSize - 1) / options.batchSize;
+        errorProbabilityPerLook = options.errorProbability / (2.0 * static_cast<double>(numberOfLooks));
+    }
+
+    while (result.numberOfTraces < maximalNumberOfTraces) {
+        uint64_t endTrace = maximalNumberOfTraces;
+        if (options.stoppingRule == StoppingRule::Sequential) {
+            endTrace = std::min(maximalNumberOfTraces, result.numberOfTraces + options.batchSize);
+        }
+        result.numberOfSuccessfulTraces += sampleTraces(result.numberOfTraces, endTrace);
+        result.numberOfTraces = endTrace;
+
+        if (options.stoppingRule == StoppingRule::Sequential && result.numberOfTraces < maximalNumberOfTraces) {
+            // Stop as soon as the (exact) Clopper-Pearson interval lies within the precision around the estimate.
+            double n = static_cast<double>(result.numberOfTraces);
+            double successes = static_cast<double>(result.numberOfSuccessfulTraces);
+            double estimate = successes / n;
+            double lower = result.numberOfSuccessfulTraces == 0 ? 0.0 : boost::math::ibeta_inv(successes, n - successes + 1.0, errorProbabilityPerLook / 2.0);
+            double upper = result.numberOfSuccessfulTraces == result.numberOfTraces
+                               ? 1.0
+                               : boost::math::ibeta_inv(successes + 1.0, n - successes, 1.0 - errorProbabilityPerLook / 2.0);
+            STORM_LOG_TRACE("Sampled " << result.numberOfTraces << " traces, the confidence interval is [" << lower << ", " << upper << "].");
+            if (estimate - lower <= options.precision && upper - estimate <= options.precision) {
+                break;
+            }
+        }
+    }
+    result.estimate = static_cast<double>(result.numberOfSuccessfulTraces) / static_cast<double>(result.numberOfTraces);
+    STORM_LOG_INFO("Estimated probability " << result.estimate << " from " << result.numberOfTraces << " traces.");
+    return result;
+}
+
+}  // namespace simulator
+}  // namespace storm
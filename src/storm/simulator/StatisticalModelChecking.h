@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace storm {
+namespace simulator {
+
+/**
+ * The rules that decide how many traces are sampled by the statistical model checker.
+ */
+enum class StoppingRule {
+    /// Samples as many traces as the Chernoff-Hoeffding bound requires for the given precision and error probability.
+    ChernoffHoeffding,
+    /// Samples traces in batches and stops as soon as the Clopper-Pearson interval is narrow enough, but never samples
+    /// more traces than the Chernoff-Hoeffding bound for half the error probability requires. The other half of the
+    /// error probability is split among the intermediate looks, so the overall guarantee still holds.
+    Sequential
+};
+
+struct StatisticalModelCheckingOptions {
+    StatisticalModelCheckingOptions();
+
+    /// The maximal distance between the estimate and the actual value that is accepted.
+    double precision;
+    /// The probability with which the estimate may be further away from the actual value than the precision.
+    double errorProbability;
+    StoppingRule stoppingRule;
+    /// The number of traces that are sampled before the sequential stopping rule is evaluated.
+    uint64_t batchSize;
+    uint64_t numberOfThreads;
+    uint64_t seed;
+    /// Successors of rows with at least this many entries are sampled via alias tables.
+    uint64_t minimalRowLengthForAliasTables;
+    /// The maximal number of entries of all alias tables combined.
+    uint64_t maximalNumberOfAliasTableEntries;
+};
+
+struct StatisticalModelCheckingResult {
+    double estimate;
+    uint64_t numberOfTraces;
+    uint64_t numberOfSuccessfulTraces;
+};
+
+/**
+ * Checks that the given options describe a valid statistical model checking query.
+ */
+void checkStatisticalModelCheckingOptions(StatisticalModelCheckingOptions const& options);
+
+/**
+ * Retrieves the number of traces that the Chernoff-Hoeffding bound requires for the given precision and error probability.
+ */
+uint64_t getNumberOfTracesForChernoffHoeffdingBound(double precision, double errorProbability);
+
+/**
+ * Estimates the probability that a trace is successful by sampling as many traces as the stopping rule of the options requires.
+ *
+ * @param options The options that determine the stopping rule.
+ * @param sampleTraces Samples the traces with indices in [firstTrace, endTrace) and retrieves how many of them were successful.
+ */
+StatisticalModelCheckingResult estimateProbabilityFromTraces(StatisticalModelCheckingOptions const& options,
+                                                             std::function<uint64_t(uint64_t firstTrace, uint64_t endTrace)> const& sampleTraces);
+
+}  // namespace simulator
+}  // namespace storm
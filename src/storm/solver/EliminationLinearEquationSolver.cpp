@@ -89,10 +89,8 @@ bool EliminationLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
 
     // Eliminate all states.
-    while (priorityQueue->hasNext()) {
-        auto state = priorityQueue->pop();
-        eliminator.eliminateState(state, false);
-    }
+    eliminator.eliminateAll([](storm::storage::sparse::state_type const&) { return false; },
+                            storm::settings::getModule<storm::settings::modules::EliminationSettings>().getNumberOfThreads());
 
     return true;
 }
@@ -1,5 +1,8 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <atomic>
+#include <type_traits>
+
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -69,7 +72,7 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, env.solver().topological().getNumberOfThreads());
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -97,26 +100,35 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
         }
     } else {
         // Solve each SCC individually
-        storm::storage::BitVector sccAsBitVector(x.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-            } else {
-                sccAsBitVector.clear();
-                for (auto const& state : scc) {
-                    sccAsBitVector.set(state, true);
+        uint64_t numberOfThreads = env.solver().topological().getNumberOfThreads();
+        if (std::is_same<ValueType, storm::RationalFunction>::value && numberOfThreads > 1) {
+            STORM_LOG_WARN("Rational functions can not be handled concurrently. Solving the SCCs sequentially.");
+            numberOfThreads = 1;
+        }
+        if (numberOfThreads > 1) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, x, b, numberOfThreads);
+        } else {
+            storm::storage::BitVector sccAsBitVector(x.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                } else {
+                    sccAsBitVector.clear();
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, true);
+                    }
+                    returnValue = solveScc(sccSolverEnvironment, this->sccSolver, sccAsBitVector, x, b) && returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
     }
@@ -129,15 +141,56 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
 }
 
 template<typename ValueType>
-void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions()
+                      .forceTopologicalSort()
+                      .computeSccDepths(needLongestChainSize)
+                      .threads(numberOfThreads));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
 }
 
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
+                                                                       std::vector<ValueType> const& b, uint64_t numberOfThreads) const {
+    if (!this->sccTaskGraph) {
+        this->sccTaskGraph = std::make_unique<helper::SccTaskGraph<ValueType>>(*this->A, *this->sortedSccDecomposition);
+    }
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs with " << numberOfThreads << " threads, "
+                              << this->sccTaskGraph->getNumberOfIndependentSccs() << " SCC(s) can be solved immediately.");
+
+    // The row grouping of a matrix with trivial row grouping is created lazily (e.g. when taking submatrices), so we retrieve it before the SCCs
+    // are solved concurrently.
+    this->A->getRowGroupIndices();
+
+    // Each thread gets its own solver and auxiliary storage. Since different SCCs write to disjoint parts of x, no further synchronization is needed.
+    this->workerSccSolvers.resize(numberOfThreads);
+    std::vector<storm::storage::BitVector> workerSccs(numberOfThreads, storm::storage::BitVector(x.size(), false));
+    std::atomic<bool> returnValue(true);
+    bool completed = this->sccTaskGraph->process(numberOfThreads, [&](uint64_t sccIndex, uint64_t workerIndex) {
+        auto const& scc = this->sortedSccDecomposition->getBlock(sccIndex);
+        bool sccResult;
+        if (scc.size() == 1) {
+            sccResult = solveTrivialScc(*scc.begin(), x, b);
+        } else {
+            auto& sccAsBitVector = workerSccs[workerIndex];
+            sccAsBitVector.clear();
+            for (auto const& state : scc) {
+                sccAsBitVector.set(state, true);
+            }
+            sccResult = solveScc(sccSolverEnvironment, this->workerSccSolvers[workerIndex], sccAsBitVector, x, b);
+        }
+        if (!sccResult) {
+            returnValue = false;
+        }
+    });
+    STORM_LOG_WARN_COND(completed, "Topological solver aborted before analyzing all SCCs.");
+    return returnValue.load();
+}
+
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX,
                                                                  std::vector<ValueType> const& globalB) const {
@@ -188,21 +241,22 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 }
 
 template<typename ValueType>
-bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
+bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment,
+                                                          std::unique_ptr<LinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& scc,
                                                           std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -222,20 +276,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
@@ -256,6 +310,8 @@ void TopologicalLinearEquationSolver<ValueType>::clearCache() const {
     sortedSccDecomposition.reset();
     longestSccChainSize = boost::none;
     sccSolver.reset();
+    sccTaskGraph.reset();
+    workerSccSolvers.clear();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
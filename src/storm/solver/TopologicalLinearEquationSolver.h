@@ -3,6 +3,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -36,8 +37,8 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
-    // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    // Creates an SCC decomposition (using the given number of threads) and sorts the SCCs according to a topological sort.
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -45,8 +46,12 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     // ... for the case that there is just one large SCC
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB) const;
+    bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<LinearEquationSolver<ValueType>>& sccSolver,
+                  storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+
+    // Solves all SCCs, where independent SCCs are solved concurrently by the given number of threads.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                               uint64_t numberOfThreads) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -60,6 +65,8 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
     mutable std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> sccSolver;
+    mutable std::unique_ptr<helper::SccTaskGraph<ValueType>> sccTaskGraph;
+    mutable std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> workerSccSolvers;  // one solver per thread
 };
 
 template<typename ValueType>
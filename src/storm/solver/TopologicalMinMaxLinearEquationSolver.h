@@ -3,6 +3,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/helper/SccTaskGraph.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
 namespace storm {
@@ -33,8 +34,8 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
    private:
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
-    // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    // Creates an SCC decomposition (using the given number of threads) and sorts the SCCs according to a topological sort.
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -43,13 +44,24 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
                                            std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
-    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
-                  storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+    bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::unique_ptr<MinMaxLinearEquationSolver<ValueType>>& sccSolver,
+                  storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX,
+                  std::vector<ValueType> const& globalB) const;
+
+    // Sets the row groups and the (non-fixed) rows of the given SCC in the given (cleared) bit vectors.
+    void collectSccRows(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups,
+                        storm::storage::BitVector& sccRows) const;
+
+    // Solves all SCCs, where independent SCCs are solved concurrently by the given number of threads.
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x,
+                               std::vector<ValueType> const& b, uint64_t numberOfThreads) const;
 
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
     mutable boost::optional<uint64_t> longestSccChainSize;
     mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
+    mutable std::unique_ptr<helper::SccTaskGraph<ValueType>> sccTaskGraph;
+    mutable std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> workerSccSolvers;  // one solver per thread
     mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector;  // A.rowGroupCount() entries
 };
 }  // namespace solver
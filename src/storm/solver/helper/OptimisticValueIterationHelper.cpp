@@ -46,6 +46,10 @@ class GSVIBackend {
         currValue = std::move(*best);
     }
 
+    void joinChunk(GSVIBackend const& chunkBackend) {
+        isConverged &= chunkBackend.isConverged;
+    }
+
     void endOfIteration() const {
         // intentionally left empty.
     }
@@ -148,6 +152,13 @@ class OVIBackend {
         }
     }
 
+    void joinChunk(OVIBackend const& chunkBackend) {
+        isAllUp &= chunkBackend.isAllUp;
+        isAllDown &= chunkBackend.isAllDown;
+        crossed |= chunkBackend.crossed;
+        errorValue &= chunkBackend.errorValue;
+    }
+
     void endOfIteration() const {
         // intentionally left empty.
     }
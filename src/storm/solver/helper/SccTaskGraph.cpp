@@ -0,0 +1,152 @@
+#include "storm/solver/helper/SccTaskGraph.h"
+
+#include <atomic>
+#include <limits>
+#include <memory>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+#endif
+
+namespace storm::solver::helper {
+
+template<typename ValueType>
+SccTaskGraph<ValueType>::SccTaskGraph(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                      storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition) {
+    uint64_t const numberOfSccs = sccDecomposition.size();
+    std::vector<uint64_t> stateToScc(matrix.getRowGroupCount());
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+            stateToScc[state] = sccIndex;
+        }
+    }
+
+    // Collect the (distinct) dependencies of each SCC as pairs of the dependency and the depending SCC.
+    dependencyCounts.assign(numberOfSccs, 0);
+    dependentIndications.assign(numberOfSccs + 1, 0);
+    std::vector<std::pair<uint64_t, uint64_t>> dependencies;
+    std::vector<uint64_t> lastDependent(numberOfSccs, std::numeric_limits<uint64_t>::max());
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        for (auto const& state : sccDecomposition.getBlock(sccIndex)) {
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                uint64_t successorScc = stateToScc[entry.getColumn()];
+                if (successorScc != sccIndex && lastDependent[successorScc] != sccIndex) {
+                    lastDependent[successorScc] = sccIndex;
+                    ++dependencyCounts[sccIndex];
+                    ++dependentIndications[successorScc + 1];
+                    dependencies.emplace_back(successorScc, sccIndex);
+                }
+            }
+        }
+    }
+
+    // Sort the dependents by the SCC they depend on.
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        dependentIndications[sccIndex + 1] += dependentIndications[sccIndex];
+    }
+    dependents.resize(dependencies.size());
+    std::vector<uint64_t> nextPosition(dependentIndications.begin(), dependentIndications.end() - 1);
+    for (auto const& dependency : dependencies) {
+        dependents[nextPosition[dependency.first]++] = dependency.second;
+    }
+}
+
+template<typename ValueType>
+uint64_t SccTaskGraph<ValueType>::getNumberOfIndependentSccs() const {
+    uint64_t result = 0;
+    for (auto const& count : dependencyCounts) {
+        if (count == 0) {
+            ++result;
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+bool SccTaskGraph<ValueType>::process(uint64_t numberOfThreads, std::function<void(uint64_t sccIndex, uint64_t workerIndex)> const& function) const {
+    STORM_LOG_ASSERT(numberOfThreads > 0, "Expected a positive number of threads.");
+    uint64_t const numberOfSccs = dependencyCounts.size();
+#ifdef STORM_HAVE_INTELTBB
+    std::unique_ptr<std::atomic<uint64_t>[]> remainingDependencies(new std::atomic<uint64_t>[numberOfSccs]);
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        remainingDependencies[sccIndex].store(dependencyCounts[sccIndex], std::memory_order_relaxed);
+    }
+    std::atomic<bool> aborted(false);
+
+    tbb::task_arena arena(static_cast<int>(numberOfThreads));
+    tbb::task_group tasks;
+    std::function<void(uint64_t)> processFrom = [&](uint64_t sccIndex) {
+        uint64_t const noScc = std::numeric_limits<uint64_t>::max();
+        while (sccIndex != noScc && !aborted.load(std::memory_order_relaxed)) {
+            // Isolation prevents this thread from picking up another SCC while the function waits for nested parallel work.
+            tbb::this_task_arena::isolate([&function, sccIndex]() { function(sccIndex, static_cast<uint64_t>(tbb::this_task_arena::current_thread_index())); });
+            if (storm::utility::resources::isTerminate()) {
+                aborted = true;
+                return;
+            }
+
+            // Release the dependents of the SCC. We continue with the first one that becomes ready and spawn tasks for the remaining ones.
+            uint64_t nextSccIndex = noScc;
+            for (uint64_t position = dependentIndications[sccIndex]; position < dependentIndications[sccIndex + 1]; ++position) {
+                uint64_t dependent = dependents[position];
+                if (remainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    if (nextSccIndex == noScc) {
+                        nextSccIndex = dependent;
+                    } else {
+                        tasks.run([&processFrom, dependent]() { processFrom(dependent); });
+                    }
+                }
+            }
+            sccIndex = nextSccIndex;
+        }
+    };
+
+    arena.execute([&]() {
+        for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+            if (dependencyCounts[sccIndex] == 0) {
+                tasks.run([&processFrom, sccIndex]() { processFrom(sccIndex); });
+            }
+        }
+        tasks.wait();
+    });
+    return !aborted.load();
+#else
+    STORM_LOG_WARN_COND(numberOfThreads == 1, "Storm was built without support for Intel TBB, defaulting to sequential version.");
+    std::vector<uint64_t> remainingDependencies(dependencyCounts);
+    std::vector<uint64_t> readySccs;
+    for (uint64_t sccIndex = numberOfSccs; sccIndex > 0; --sccIndex) {
+        if (dependencyCounts[sccIndex - 1] == 0) {
+            readySccs.push_back(sccIndex - 1);
+        }
+    }
+    while (!readySccs.empty()) {
+        uint64_t sccIndex = readySccs.back();
+        readySccs.pop_back();
+        function(sccIndex, 0);
+        if (storm::utility::resources::isTerminate()) {
+            return false;
+        }
+        for (uint64_t position = dependentIndications[sccIndex]; position < dependentIndications[sccIndex + 1]; ++position) {
+            if (--remainingDependencies[dependents[position]] == 0) {
+                readySccs.push_back(dependents[position]);
+            }
+        }
+    }
+    return true;
+#endif
+}
+
+template class SccTaskGraph<double>;
+template class SccTaskGraph<storm::RationalNumber>;
+template class SccTaskGraph<storm::RationalFunction>;
+
+}  // namespace storm::solver::helper
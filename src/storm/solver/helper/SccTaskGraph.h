@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+namespace storage {
+template<typename ValueType>
+class SparseMatrix;
+template<typename ValueType>
+class StronglyConnectedComponentDecomposition;
+}  // namespace storage
+
+namespace solver::helper {
+
+/*!
+ * Captures which SCCs of an SCC decomposition depend on each other, i.e., which SCCs contain successors of the states of an SCC.
+ * This is used to process SCCs concurrently: An SCC becomes ready as soon as all SCCs it depends on have been processed.
+ */
+template<typename ValueType>
+class SccTaskGraph {
+   public:
+    /*!
+     * Creates the task graph for the given decomposition of the given matrix.
+     * @param matrix The (possibly non-square) matrix whose row groups correspond to the states of the SCCs.
+     * @param sccDecomposition The SCC decomposition of the matrix.
+     */
+    SccTaskGraph(storm::storage::SparseMatrix<ValueType> const& matrix,
+                 storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition);
+
+    /*!
+     * Invokes the given function once for each SCC such that the functions of all SCCs that an SCC depends on have returned before the function
+     * for that SCC is invoked. Independent SCCs are processed concurrently by a work-stealing scheduler.
+     *
+     * @param numberOfThreads The maximal number of threads to use.
+     * @param function The function to invoke. Its arguments are the index of the SCC within the decomposition and the index of the invoking
+     * worker, which is smaller than the number of threads. Calls with the same worker index never overlap.
+     * @return False iff the processing was aborted (due to a termination request), i.e., if not all SCCs have been processed.
+     */
+    bool process(uint64_t numberOfThreads, std::function<void(uint64_t sccIndex, uint64_t workerIndex)> const& function) const;
+
+    /*!
+     * Retrieves the number of SCCs that do not depend on any other SCC.
+     */
+    uint64_t getNumberOfIndependentSccs() const;
+
+   private:
+    // For each SCC, the number of other SCCs it depends on.
+    std::vector<uint64_t> dependencyCounts;
+
+    // The SCCs depending on SCC i are dependents[dependentIndications[i]], ..., dependents[dependentIndications[i + 1] - 1].
+    std::vector<uint64_t> dependentIndications;
+    std::vector<uint64_t> dependents;
+};
+
+}  // namespace solver::helper
+}  // namespace storm
@@ -36,6 +36,10 @@ class VIOperatorBackend {
         currValue = std::move(*best);
     }
 
+    void joinChunk(VIOperatorBackend const& chunkBackend) {
+        isConverged &= chunkBackend.isConverged;
+    }
+
     void endOfIteration() const {
         // intentionally left empty.
     }
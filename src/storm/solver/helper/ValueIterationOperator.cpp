@@ -53,6 +53,7 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setMatrix(storm::sto
             matrixColumns.push_back(StartOfRowIndicator);  // Indicate start of next row
         }
     }
+    computeChunks();
 }
 
 template<typename ValueType, bool TrivialRowGrouping>
@@ -116,6 +117,61 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping>::setIgnoredRows(bool
     }
 }
 
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::setParallelChunkSize(uint64_t entriesPerChunk) {
+    if (parallelChunkSize != entriesPerChunk) {
+#ifndef STORM_HAVE_INTELTBB
+        STORM_LOG_WARN_COND(entriesPerChunk == 0,
+                            "Storm was built without support for Intel TBB, chunks of the value iteration operator are processed sequentially.");
+#endif
+        parallelChunkSize = entriesPerChunk;
+        computeChunks();
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+uint64_t ValueIterationOperator<ValueType, TrivialRowGrouping>::getNumberOfChunks() const {
+    return chunks.size();
+}
+
+template<typename ValueType, bool TrivialRowGrouping>
+void ValueIterationOperator<ValueType, TrivialRowGrouping>::computeChunks() {
+    chunks.clear();
+    if (parallelChunkSize == 0 || matrixColumns.empty()) {
+        return;
+    }
+    // Indicator of a row group start. Ignored rows only modify the lower bits of indicators, so they do not affect the result.
+    IndexType const groupIndicator = TrivialRowGrouping ? StartOfRowIndicator : StartOfRowGroupIndicator;
+    // Chunks are first computed w.r.t. the processing order of row groups. The row group indices are fixed afterwards.
+    uint64_t numProcessedGroups{0}, valueOffset{0}, entriesInCurrentChunk{0};
+    Chunk currentChunk{0, 0, 0, 0};
+    for (uint64_t columnOffset = 0; columnOffset + 1 < matrixColumns.size(); ++columnOffset) {
+        IndexType const column = matrixColumns[columnOffset];
+        if ((column & groupIndicator) == groupIndicator) {
+            if (entriesInCurrentChunk >= parallelChunkSize) {
+                currentChunk.groupEnd = numProcessedGroups;
+                chunks.push_back(currentChunk);
+                currentChunk = Chunk{numProcessedGroups, numProcessedGroups, columnOffset, valueOffset};
+                entriesInCurrentChunk = 0;
+            }
+            ++numProcessedGroups;
+        } else if (column < StartOfRowIndicator) {
+            ++valueOffset;
+            ++entriesInCurrentChunk;
+        }
+    }
+    currentChunk.groupEnd = numProcessedGroups;
+    chunks.push_back(currentChunk);
+    STORM_LOG_ASSERT(valueOffset == matrixValues.size(), "Unexpected number of matrix values.");
+    if (backwards) {
+        for (auto& chunk : chunks) {
+            std::swap(chunk.groupBegin, chunk.groupEnd);
+            chunk.groupBegin = numProcessedGroups - chunk.groupBegin;
+            chunk.groupEnd = numProcessedGroups - chunk.groupEnd;
+        }
+    }
+}
+
 template<typename ValueType, bool TrivialRowGrouping>
 std::vector<typename ValueIterationOperator<ValueType, TrivialRowGrouping>::IndexType> const&
 ValueIterationOperator<ValueType, TrivialRowGrouping>::getRowGroupIndices() const {
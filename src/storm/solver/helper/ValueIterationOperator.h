@@ -1,12 +1,15 @@
 #pragma once
+#include <algorithm>
 #include <functional>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/irange.hpp>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"  // TODO
@@ -86,10 +89,23 @@ class ValueIterationOperator {
      * @param backend the backend
      * @return whatever backend.converged() returns
      *
+     * If a parallel chunk size is set (see `setParallelChunkSize`) and the backend implements
+     * * backend.joinChunk(chunkBackend); merges the status of a copy of the backend that processed a chunk of row groups into this backend
+     * the row groups are processed in parallel chunks. Each chunk is processed by a copy of the backend that is created right after
+     * backend.startNewIteration() and joined (in chunk order) before backend.abort() and backend.endOfIteration() are invoked.
+     * If operandIn and operandOut are different objects, all chunks read from operandIn (Jacobi style).
+     * Otherwise, chunks read the values of their own row groups in-place and the values of all other row groups from the state at the
+     * beginning of the iteration (chunked Gauss-Seidel style).
+     *
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
      */
     template<typename OperandType, typename OffsetType, typename BackendType>
     bool apply(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
+        if constexpr (isChunkableBackend<BackendType>::value) {
+            if (!chunks.empty()) {
+                return applyChunked(operandIn, operandOut, offsets, backend);
+            }
+        }
         if (hasSkippedRows) {
             if (backwards) {
                 return apply<OperandType, OffsetType, BackendType, true, true>(operandOut, operandIn, offsets, backend);
@@ -127,6 +143,19 @@ class ValueIterationOperator {
      */
     void unsetIgnoredRows();
 
+    /*!
+     * Sets whether (and how) the row groups are split into chunks that are processed in parallel when applying the operator.
+     * Chunks consist of consecutive row groups (w.r.t. the order in which they are processed) and contain roughly the given number of matrix entries.
+     * @param entriesPerChunk the targeted number of matrix entries per chunk. A value of zero disables the chunked (parallel) application.
+     * @note Only backends implementing `joinChunk` are applied in chunks. Chunks are only processed in parallel if Storm is built with Intel TBB.
+     */
+    void setParallelChunkSize(uint64_t entriesPerChunk);
+
+    /*!
+     * @return The number of chunks in which row groups are processed. Zero if the chunked application is disabled.
+     */
+    uint64_t getNumberOfChunks() const;
+
     /*!
      * @return The considered row group indices
      */
@@ -146,6 +175,16 @@ class ValueIterationOperator {
     void freeAuxiliaryVector();
 
    private:
+    /*!
+     * A range of consecutive row groups that are processed by a single task when the operator is applied in parallel
+     */
+    struct Chunk {
+        IndexType groupBegin;   // first row group of this chunk
+        IndexType groupEnd;     // one past the last row group of this chunk
+        uint64_t columnOffset;  // position in 'matrixColumns' where processing of this chunk starts
+        uint64_t valueOffset;   // position in 'matrixValues' where processing of this chunk starts
+    };
+
     /*!
      * Internal variant of `apply`
      * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
@@ -192,6 +231,142 @@ class ValueIterationOperator {
         return backend.converged();
     }
 
+    /*!
+     * Applies the operator by processing the chunks of row groups in parallel
+     * @note This and other apply methods are intentionally implemented in the header file as there are potentially many different BackendTypes
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType>
+    bool applyChunked(OperandType const& operandIn, OperandType& operandOut, OffsetType const& offsets, BackendType& backend) const {
+        STORM_LOG_ASSERT(getSize(operandIn) == getSize(operandOut), "Input and Output Operands have different sizes.");
+        bool const inPlace = &operandIn == &operandOut;
+        backend.startNewIteration();
+        std::vector<BackendType> chunkBackends(chunks.size(), backend);
+        OperandType const* operandOfOtherChunks = &operandIn;
+        if (inPlace) {
+            operandOfOtherChunks = &copyToSnapshot(operandIn);
+        }
+        forEachChunk([&](uint64_t chunkIndex) {
+            auto& chunkBackend = chunkBackends[chunkIndex];
+            if (inPlace) {
+                applyChunk<OperandType, OffsetType, BackendType, true>(chunks[chunkIndex], operandOut, *operandOfOtherChunks, offsets, chunkBackend);
+            } else {
+                applyChunk<OperandType, OffsetType, BackendType, false>(chunks[chunkIndex], operandOut, operandIn, offsets, chunkBackend);
+            }
+        });
+        for (auto const& chunkBackend : chunkBackends) {
+            backend.joinChunk(chunkBackend);
+        }
+        if (backend.abort()) {
+            return backend.converged();
+        }
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Processes the row groups of a single chunk. Dispatches according to the direction and whether rows are skipped.
+     * @tparam InPlace if true, the values of row groups within this chunk are read from operandOut and all other values from operandIn
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool InPlace>
+    void applyChunk(Chunk const& chunk, OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        if (hasSkippedRows) {
+            if (backwards) {
+                applyChunk<OperandType, OffsetType, BackendType, InPlace, true, true>(chunk, operandOut, operandIn, offsets, backend);
+            } else {
+                applyChunk<OperandType, OffsetType, BackendType, InPlace, false, true>(chunk, operandOut, operandIn, offsets, backend);
+            }
+        } else {
+            if (backwards) {
+                applyChunk<OperandType, OffsetType, BackendType, InPlace, true, false>(chunk, operandOut, operandIn, offsets, backend);
+            } else {
+                applyChunk<OperandType, OffsetType, BackendType, InPlace, false, false>(chunk, operandOut, operandIn, offsets, backend);
+            }
+        }
+    }
+
+    template<typename OperandType, typename OffsetType, typename BackendType, bool InPlace, bool Backward, bool SkipIgnoredRows>
+    void applyChunk(Chunk const& chunk, OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
+        auto matrixValueIt = matrixValues.cbegin() + chunk.valueOffset;
+        auto matrixColumnIt = matrixColumns.cbegin() + chunk.columnOffset;
+        auto row = [&](uint64_t offsetIndex) {
+            if constexpr (InPlace) {
+                return applyRowInChunk(matrixColumnIt, matrixValueIt, operandOut, operandIn, chunk, offsets, offsetIndex);
+            } else {
+                return applyRow(matrixColumnIt, matrixValueIt, operandIn, offsets, offsetIndex);
+            }
+        };
+        for (auto groupIndex : indexRange<Backward>(chunk.groupBegin, chunk.groupEnd)) {
+            STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+            if constexpr (TrivialRowGrouping) {
+                backend.firstRow(row(groupIndex), groupIndex, groupIndex);
+            } else {
+                IndexType rowIndex = (*rowGroupIndices)[groupIndex];
+                if constexpr (SkipIgnoredRows) {
+                    rowIndex += skipMultipleIgnoredRows(matrixColumnIt, matrixValueIt);
+                }
+                backend.firstRow(row(rowIndex), groupIndex, rowIndex);
+                while (*matrixColumnIt < StartOfRowGroupIndicator) {
+                    ++rowIndex;
+                    if (!SkipIgnoredRows || !skipIgnoredRow(matrixColumnIt, matrixValueIt)) {
+                        backend.nextRow(row(rowIndex), groupIndex, rowIndex);
+                    }
+                }
+            }
+            if constexpr (isPair<OperandType>::value) {
+                backend.applyUpdate(operandOut.first[groupIndex], operandOut.second[groupIndex], groupIndex);
+            } else {
+                backend.applyUpdate(operandOut[groupIndex], groupIndex);
+            }
+            if (backend.abort()) {
+                return;
+            }
+        }
+    }
+
+    /*!
+     * Invokes the given function for each chunk index, in parallel if possible.
+     */
+    template<typename Function>
+    void forEachChunk(Function const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, chunks.size(), 1), [&function](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t chunkIndex = range.begin(); chunkIndex < range.end(); ++chunkIndex) {
+                function(chunkIndex);
+            }
+        });
+#else
+        for (uint64_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+            function(chunkIndex);
+        }
+#endif
+    }
+
+    /*!
+     * Copies the given operand to the snapshot storage (in parallel chunks) and returns a reference to the copy.
+     */
+    template<typename OperandType>
+    OperandType const& copyToSnapshot(OperandType const& operand) const {
+        if constexpr (isPair<OperandType>::value) {
+            static_assert(std::is_same_v<OperandType, std::pair<std::vector<ValueType>, std::vector<ValueType>>>, "Unexpected operand type.");
+            snapshot.first.resize(operand.first.size());
+            snapshot.second.resize(operand.second.size());
+            forEachChunk([&](uint64_t chunkIndex) {
+                auto const& chunk = chunks[chunkIndex];
+                std::copy(operand.first.begin() + chunk.groupBegin, operand.first.begin() + chunk.groupEnd, snapshot.first.begin() + chunk.groupBegin);
+                std::copy(operand.second.begin() + chunk.groupBegin, operand.second.begin() + chunk.groupEnd, snapshot.second.begin() + chunk.groupBegin);
+            });
+            return snapshot;
+        } else {
+            static_assert(std::is_same_v<OperandType, std::vector<ValueType>>, "Unexpected operand type.");
+            snapshot.first.resize(operand.size());
+            forEachChunk([&](uint64_t chunkIndex) {
+                auto const& chunk = chunks[chunkIndex];
+                std::copy(operand.begin() + chunk.groupBegin, operand.begin() + chunk.groupEnd, snapshot.first.begin() + chunk.groupBegin);
+            });
+            return snapshot.first;
+        }
+    }
+
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
 
     template<typename OpT, typename OffT>
@@ -230,6 +405,27 @@ class ValueIterationOperator {
         return result;
     }
 
+    /*!
+     * Same as applyRow but reads the values of row groups within the given chunk from the first operand and all other values from the second operand
+     */
+    template<typename OperandType, typename OffsetType>
+    auto applyRowInChunk(std::vector<IndexType>::const_iterator& matrixColumnIt, typename std::vector<ValueType>::const_iterator& matrixValueIt,
+                         OperandType const& chunkOperand, OperandType const& otherOperand, Chunk const& chunk, OffsetType const& offsets,
+                         uint64_t offsetIndex) const {
+        STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
+        auto result{initializeRowRes(chunkOperand, offsets, offsetIndex)};
+        for (++matrixColumnIt; *matrixColumnIt < StartOfRowIndicator; ++matrixColumnIt, ++matrixValueIt) {
+            auto const& operand = (*matrixColumnIt >= chunk.groupBegin && *matrixColumnIt < chunk.groupEnd) ? chunkOperand : otherOperand;
+            if constexpr (isPair<OperandType>::value) {
+                result.first += operand.first[*matrixColumnIt] * (*matrixValueIt);
+                result.second += operand.second[*matrixColumnIt] * (*matrixValueIt);
+            } else {
+                result += operand[*matrixColumnIt] * (*matrixValueIt);
+            }
+        }
+        return result;
+    }
+
     // Auxiliary helpers used for metaprogramming
     template<bool Backward>
     auto indexRange(IndexType start, IndexType end) const {
@@ -256,6 +452,18 @@ class ValueIterationOperator {
     template<typename T1, typename T2>
     struct isPair<std::pair<T1, T2>> : std::true_type {};
 
+    template<typename, typename = void>
+    struct isChunkableBackend : std::false_type {};
+
+    template<typename BackendType>
+    struct isChunkableBackend<BackendType, std::void_t<decltype(std::declval<BackendType&>().joinChunk(std::declval<BackendType const&>()))>>
+        : std::true_type {};
+
+    /*!
+     * Computes the chunks of row groups according to the current parallel chunk size
+     */
+    void computeChunks();
+
     /*!
      * Internal variant of setIgnoredRows
      */
@@ -304,6 +512,21 @@ class ValueIterationOperator {
      */
     bool hasSkippedRows{false};
 
+    /*!
+     * The targeted number of matrix entries per chunk (zero if the operator is not applied in chunks)
+     */
+    uint64_t parallelChunkSize{0};
+
+    /*!
+     * The chunks of row groups (empty if the operator is not applied in chunks)
+     */
+    std::vector<Chunk> chunks;
+
+    /*!
+     * Storage for a copy of the operand at the beginning of a chunked in-place iteration
+     */
+    mutable std::pair<std::vector<ValueType>, std::vector<ValueType>> snapshot;
+
     /*!
      * Storage for the auxiliary vector
      */
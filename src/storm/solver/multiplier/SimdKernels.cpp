@@ -0,0 +1,217 @@
+#include "storm/solver/multiplier/SimdKernels.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+// The vectorized kernels are compiled for their target instruction set via function attributes (independent of the
+// flags of the remaining build), so they can be dispatched at runtime depending on the executing processor.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SIMD_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace storm {
+namespace solver {
+namespace simd {
+
+std::string toString(InstructionSet instructionSet) {
+    switch (instructionSet) {
+        case InstructionSet::Scalar:
+            return "scalar";
+        case InstructionSet::Avx2:
+            return "AVX2";
+        case InstructionSet::Avx512:
+            return "AVX-512";
+    }
+    return "invalid";
+}
+
+namespace {
+InstructionSet detectInstructionSet() {
+#ifdef STORM_SIMD_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return InstructionSet::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return InstructionSet::Avx2;
+    }
+#endif
+    return InstructionSet::Scalar;
+}
+
+/*!
+ * Accumulates the entries of a row one after another (exactly like the SparseMatrix does).
+ */
+struct ScalarKernel {
+    static inline double dot(uint64_t entry, uint64_t end, uint32_t const* columns, double const* values, double const* x, double value) {
+        for (; entry < end; ++entry) {
+            value += values[entry] * x[columns[entry]];
+        }
+        return value;
+    }
+};
+
+#ifdef STORM_SIMD_X86_KERNELS
+/*!
+ * Accumulates four entries at a time, gathering the corresponding entries of x.
+ */
+struct Avx2Kernel {
+    __attribute__((target("avx2,fma"))) static inline double dot(uint64_t entry, uint64_t end, uint32_t const* columns, double const* values,
+                                                                  double const* x, double value) {
+        if (end - entry >= 4) {
+            __m256d sum = _mm256_setzero_pd();
+            for (; entry + 4 <= end; entry += 4) {
+                __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+                sum = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), _mm256_i32gather_pd(x, indices, 8), sum);
+            }
+            __m128d halfSum = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+            value += _mm_cvtsd_f64(_mm_add_sd(halfSum, _mm_unpackhi_pd(halfSum, halfSum)));
+        }
+        return ScalarKernel::dot(entry, end, columns, values, x, value);
+    }
+};
+
+/*!
+ * Accumulates eight entries at a time, gathering the corresponding entries of x.
+ */
+struct Avx512Kernel {
+    __attribute__((target("avx512f"))) static inline double dot(uint64_t entry, uint64_t end, uint32_t const* columns, double const* values, double const* x,
+                                                                 double value) {
+        if (end - entry >= 8) {
+            __m512d sum = _mm512_setzero_pd();
+            for (; entry + 8 <= end; entry += 8) {
+                __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+                sum = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), _mm512_i32gather_pd(indices, x, 8), sum);
+            }
+            value += _mm512_reduce_add_pd(sum);
+        }
+        return ScalarKernel::dot(entry, end, columns, values, x, value);
+    }
+};
+#endif
+
+template<typename Kernel>
+inline void multiplyAddRows(MatrixData const& matrix, double const* x, double const* b, double* result) {
+    for (uint64_t row = 0; row < matrix.rowCount; ++row) {
+        result[row] = Kernel::dot(matrix.rowIndications[row], matrix.rowIndications[row + 1], matrix.columns, matrix.values, x, b ? b[row] : 0.0);
+    }
+}
+
+template<typename Kernel, typename Compare>
+inline void multiplyAddReduceRowGroups(MatrixData const& matrix, uint64_t rowGroupCount, uint64_t const* rowGroupIndices, double const* x, double const* b,
+                                       double* result, uint64_t* choices) {
+    Compare compare;
+    uint64_t const* rowIndications = matrix.rowIndications;
+    for (uint64_t group = 0; group < rowGroupCount; ++group) {
+        uint64_t row = rowGroupIndices[group];
+        uint64_t const rowEnd = rowGroupIndices[group + 1];
+
+        // Only multiply and reduce if there is at least one row in the group.
+        if (row == rowEnd) {
+            continue;
+        }
+
+        double currentValue = Kernel::dot(rowIndications[row], rowIndications[row + 1], matrix.columns, matrix.values, x, b ? b[row] : 0.0);
+
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        double oldSelectedChoiceValue = currentValue;
+        uint64_t selectedChoice = 0;
+
+        for (++row; row < rowEnd; ++row) {
+            double newValue = Kernel::dot(rowIndications[row], rowIndications[row + 1], matrix.columns, matrix.values, x, b ? b[row] : 0.0);
+            if (choices && row == choices[group] + rowGroupIndices[group]) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = row - rowGroupIndices[group];
+            }
+        }
+
+        result[group] = currentValue;
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            choices[group] = selectedChoice;
+        }
+    }
+}
+
+template<typename Kernel>
+inline void multiplyAddReduceRowGroups(bool minimize, MatrixData const& matrix, uint64_t rowGroupCount, uint64_t const* rowGroupIndices, double const* x,
+                                       double const* b, double* result, uint64_t* choices) {
+    if (minimize) {
+        multiplyAddReduceRowGroups<Kernel, storm::utility::ElementLess<double>>(matrix, rowGroupCount, rowGroupIndices, x, b, result, choices);
+    } else {
+        multiplyAddReduceRowGroups<Kernel, storm::utility::ElementGreater<double>>(matrix, rowGroupCount, rowGroupIndices, x, b, result, choices);
+    }
+}
+
+// The entry points of the vectorized kernels are flattened such that the row kernels are inlined into code of the right target.
+#ifdef STORM_SIMD_X86_KERNELS
+__attribute__((target("avx2,fma"), flatten)) void multiplyAddAvx2(MatrixData const& matrix, double const* x, double const* b, double* result) {
+    multiplyAddRows<Avx2Kernel>(matrix, x, b, result);
+}
+
+__attribute__((target("avx512f"), flatten)) void multiplyAddAvx512(MatrixData const& matrix, double const* x, double const* b, double* result) {
+    multiplyAddRows<Avx512Kernel>(matrix, x, b, result);
+}
+
+__attribute__((target("avx2,fma"), flatten)) void multiplyAddReduceAvx2(bool minimize, MatrixData const& matrix, uint64_t rowGroupCount,
+                                                                         uint64_t const* rowGroupIndices, double const* x, double const* b, double* result,
+                                                                         uint64_t* choices) {
+    multiplyAddReduceRowGroups<Avx2Kernel>(minimize, matrix, rowGroupCount, rowGroupIndices, x, b, result, choices);
+}
+
+__attribute__((target("avx512f"), flatten)) void multiplyAddReduceAvx512(bool minimize, MatrixData const& matrix, uint64_t rowGroupCount,
+                                                                        uint64_t const* rowGroupIndices, double const* x, double const* b, double* result,
+                                                                        uint64_t* choices) {
+    multiplyAddReduceRowGroups<Avx512Kernel>(minimize, matrix, rowGroupCount, rowGroupIndices, x, b, result, choices);
+}
+#endif
+}  // namespace
+
+InstructionSet getSupportedInstructionSet() {
+    static InstructionSet const instructionSet = detectInstructionSet();
+    return instructionSet;
+}
+
+void multiplyAdd(InstructionSet instructionSet, MatrixData const& matrix, double const* x, double const* b, double* result) {
+    STORM_LOG_ASSERT(x != result, "The input and output vectors must not be aliased.");
+    STORM_LOG_ASSERT(instructionSet == InstructionSet::Scalar || instructionSet <= getSupportedInstructionSet(),
+                     "The instruction set " << toString(instructionSet) << " is not supported.");
+    switch (instructionSet) {
+#ifdef STORM_SIMD_X86_KERNELS
+        case InstructionSet::Avx512:
+            multiplyAddAvx512(matrix, x, b, result);
+            return;
+        case InstructionSet::Avx2:
+            multiplyAddAvx2(matrix, x, b, result);
+            return;
+#endif
+        default:
+            multiplyAddRows<ScalarKernel>(matrix, x, b, result);
+    }
+}
+
+void multiplyAddReduce(InstructionSet instructionSet, bool minimize, MatrixData const& matrix, uint64_t rowGroupCount, uint64_t const* rowGroupIndices,
+                       double const* x, double const* b, double* result, uint64_t* choices) {
+    STORM_LOG_ASSERT(x != result, "The input and output vectors must not be aliased.");
+    STORM_LOG_ASSERT(instructionSet == InstructionSet::Scalar || instructionSet <= getSupportedInstructionSet(),
+                     "The instruction set " << toString(instructionSet) << " is not supported.");
+    switch (instructionSet) {
+#ifdef STORM_SIMD_X86_KERNELS
+        case InstructionSet::Avx512:
+            multiplyAddReduceAvx512(minimize, matrix, rowGroupCount, rowGroupIndices, x, b, result, choices);
+            return;
+        case InstructionSet::Avx2:
+            multiplyAddReduceAvx2(minimize, matrix, rowGroupCount, rowGroupIndices, x, b, result, choices);
+            return;
+#endif
+        default:
+            multiplyAddReduceRowGroups<ScalarKernel>(minimize, matrix, rowGroupCount, rowGroupIndices, x, b, result, choices);
+    }
+}
+
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace storm {
+namespace solver {
+namespace simd {
+
+/*!
+ * The instruction sets for which vectorized kernels are available.
+ */
+enum class InstructionSet { Scalar, Avx2, Avx512 };
+
+std::string toString(InstructionSet instructionSet);
+
+/*!
+ * Retrieves the most capable instruction set that is supported by both this build and the executing processor.
+ * The result is determined once and cached afterwards.
+ */
+InstructionSet getSupportedInstructionSet();
+
+/*!
+ * The raw data of a sparse matrix in structure-of-arrays layout (see CompactSparseMatrix).
+ */
+struct MatrixData {
+    uint64_t rowCount;
+    uint64_t const* rowIndications;
+    uint32_t const* columns;
+    double const* values;
+};
+
+/*!
+ * Computes result = A * x + b.
+ *
+ * For the scalar instruction set, the entries of each row are accumulated in the same order as in
+ * SparseMatrix::multiplyWithVector, so the results coincide bit by bit. The vectorized kernels
+ * accumulate several partial sums and may therefore differ in the last bits.
+ *
+ * @param b If not null, the summand that is added to the product.
+ * @param result Must not alias x.
+ */
+void multiplyAdd(InstructionSet instructionSet, MatrixData const& matrix, double const* x, double const* b, double* result);
+
+/*!
+ * Computes result = min/max over the rows of each row group of A * x + b and (optionally) tracks the choices in the same way
+ * as SparseMatrix::multiplyAndReduce, i.e., a choice is only changed if the new choice is strictly better than the old one.
+ *
+ * @param rowGroupCount The number of row groups.
+ * @param rowGroupIndices The indices of the first rows of the row groups (plus the number of rows at the end).
+ * @param b If not null, the summand that is added to the product.
+ * @param result Must not alias x.
+ * @param choices If not null, the choices that are to be updated.
+ */
+void multiplyAddReduce(InstructionSet instructionSet, bool minimize, MatrixData const& matrix, uint64_t rowGroupCount, uint64_t const* rowGroupIndices,
+                       double const* x, double const* b, double* result, uint64_t* choices);
+
+}  // namespace simd
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,127 @@
+#include "storm/solver/multiplier/SimdMultiplier.h"
+
+#include <limits>
+#include <type_traits>
+
+#include "storm-config.h"
+
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : NativeMultiplier<ValueType>(matrix), instructionSet(simd::getSupportedInstructionSet()) {
+    STORM_LOG_TRACE("Using " << simd::toString(instructionSet) << " kernels for matrix-vector multiplication.");
+}
+
+template<typename ValueType>
+SimdMultiplier<ValueType>::~SimdMultiplier() = default;
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::initialize() const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        // The gather instructions interpret the column indices as signed 32 bit integers.
+        if (!compactMatrix && this->matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) + 1) {
+            compactMatrix = std::make_unique<storm::storage::CompactSparseMatrix<double, uint32_t>>(this->matrix);
+        }
+    }
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::clearCache() const {
+    compactMatrix.reset();
+    NativeMultiplier<ValueType>::clearCache();
+}
+
+template<typename ValueType>
+bool SimdMultiplier<ValueType>::useKernels(Environment const& env) const {
+    // The parallel multiplication of the native multiplier is preferred if it is enabled.
+    if (this->parallelize(env)) {
+        return false;
+    }
+    initialize();
+    return compactMatrix != nullptr;
+}
+
+template<typename ValueType>
+simd::InstructionSet SimdMultiplier<ValueType>::getInstructionSet() const {
+    return instructionSet;
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::setInstructionSet(simd::InstructionSet instructionSet) {
+    STORM_LOG_ASSERT(instructionSet <= simd::getSupportedInstructionSet(),
+                     "The instruction set " << simd::toString(instructionSet) << " is not supported by this processor.");
+    this->instructionSet = instructionSet;
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                         std::vector<ValueType>& result) const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (useKernels(env)) {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            simd::MatrixData matrixData{compactMatrix->getRowCount(), compactMatrix->getRowIndications().data(), compactMatrix->getColumnIndices().data(),
+                                        compactMatrix->getValues().data()};
+            simd::multiplyAdd(instructionSet, matrixData, x.data(), b ? b->data() : nullptr, target->data());
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+            return;
+        }
+    }
+    NativeMultiplier<ValueType>::multiply(env, x, b, result);
+}
+
+template<typename ValueType>
+void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                                  std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                                  std::vector<uint_fast64_t>* choices) const {
+    if constexpr (std::is_same<ValueType, double>::value) {
+        if (useKernels(env)) {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            simd::MatrixData matrixData{compactMatrix->getRowCount(), compactMatrix->getRowIndications().data(), compactMatrix->getColumnIndices().data(),
+                                        compactMatrix->getValues().data()};
+            simd::multiplyAddReduce(instructionSet, minimize(dir), matrixData, rowGroupIndices.size() - 1, rowGroupIndices.data(), x.data(),
+                                    b ? b->data() : nullptr, target->data(), choices ? choices->data() : nullptr);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+            return;
+        }
+    }
+    NativeMultiplier<ValueType>::multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+}
+
+template class SimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+template class SimdMultiplier<storm::RationalNumber>;
+template class SimdMultiplier<storm::RationalFunction>;
+#endif
+
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+
+#include "storm/solver/multiplier/NativeMultiplier.h"
+#include "storm/solver/multiplier/SimdKernels.h"
+
+namespace storm {
+namespace storage {
+template<typename ValueType, typename ColumnIndexType>
+class CompactSparseMatrix;
+}
+
+namespace solver {
+
+/*!
+ * A multiplier that uses vectorized (AVX2 or AVX-512) kernels for multiplications with double matrices. The kernels are selected
+ * at runtime depending on the capabilities of the processor. To this end, the matrix is converted into a compact
+ * structure-of-arrays representation. For all other value types (or if no vectorized kernel is available), this behaves like the
+ * NativeMultiplier.
+ */
+template<typename ValueType>
+class SimdMultiplier : public NativeMultiplier<ValueType> {
+   public:
+    SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+    virtual ~SimdMultiplier();
+
+    virtual void clearCache() const override;
+
+    virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                          std::vector<ValueType>& result) const override;
+    virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices,
+                                   std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result,
+                                   std::vector<uint_fast64_t>* choices = nullptr) const override;
+
+    /*!
+     * Retrieves the instruction set that is used by this multiplier.
+     */
+    simd::InstructionSet getInstructionSet() const;
+
+    /*!
+     * Sets the instruction set that is to be used by this multiplier. It must be supported by the executing processor.
+     * Selecting the scalar instruction set yields results that coincide with the ones of the NativeMultiplier.
+     */
+    void setInstructionSet(simd::InstructionSet instructionSet);
+
+   private:
+    /*!
+     * Creates the compact representation of the matrix (if it is not yet present and the kernels are applicable).
+     */
+    void initialize() const;
+
+    /*!
+     * Retrieves whether the vectorized kernels are applicable, i.e., whether the value type is double and the compact matrix can be created.
+     */
+    bool useKernels(Environment const& env) const;
+
+    // The compact representation of the matrix (only for double matrices). It is kept in addition to the original matrix.
+    mutable std::unique_ptr<storm::storage::CompactSparseMatrix<double, uint32_t>> compactMatrix;
+
+    // The instruction set used by the kernels.
+    simd::InstructionSet instructionSet;
+};
+
+}  // namespace solver
+}  // namespace storm
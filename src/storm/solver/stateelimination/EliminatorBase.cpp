@@ -1,5 +1,7 @@
 #include "storm/solver/stateelimination/EliminatorBase.h"
 
+#include <iterator>
+
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/stateelimination.h"
@@ -21,6 +23,11 @@ EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMa
 
 template<typename ValueType, ScalingMode Mode>
 void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, bool clearRow) {
+    eliminate(row, column, clearRow, buffers);
+}
+
+template<typename ValueType, ScalingMode Mode>
+void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, bool clearRow, MergeBuffers& buffers) {
     // Start by finding the entry in the given column.
     bool hasEntryInColumn = false;
     ValueType columnValue = storm::utility::zero<ValueType>();
@@ -72,15 +79,24 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
 
     // In case we have a constrained elimination, we need to keep track of the rows that keep their value
     // in the column equal to the current row.
-    FlexibleRowType rowsKeepingEntryInColumnEqualRow;
+    FlexibleRowType& rowsKeepingEntryInColumnEqualRow = buffers.rowsKeepingEntryInColumnEqualRow;
+    rowsKeepingEntryInColumnEqualRow.clear();
 
     // For each entry in the row d, we need to build a list of other rows that will contain an element in the
     // column d.
-    std::vector<FlexibleRowType> newBackwardEntries(entriesInRow.size());
-    for (auto& backwardEntry : newBackwardEntries) {
-        backwardEntry.reserve(elementsWithEntryInColumnEqualRow.size());
+    std::vector<FlexibleRowType>& newBackwardEntries = buffers.newBackwardEntries;
+    if (newBackwardEntries.size() < entriesInRow.size()) {
+        newBackwardEntries.resize(entriesInRow.size());
+    }
+    for (uint_fast64_t index = 0; index < entriesInRow.size(); ++index) {
+        newBackwardEntries[index].clear();
+        newBackwardEntries[index].reserve(elementsWithEntryInColumnEqualRow.size());
     }
 
+    // The merged rows are first written to the buffer and then copied back to the row. This way, the storage of the
+    // row is reused whenever it is large enough.
+    FlexibleRowType& mergedRow = buffers.mergedRow;
+
     // Now go through the rows with an entry in the column corresponding to the current row and substitute
     // the elements of this row unless the elimination is filtered.
     for (auto const& predecessorEntry : elementsWithEntryInColumnEqualRow) {
@@ -123,9 +139,9 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = entriesInRow.begin();
         FlexibleRowIterator last2 = entriesInRow.end();
 
-        FlexibleRowType newSuccessors;
-        newSuccessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newSuccessors, newSuccessors.end());
+        mergedRow.clear();
+        mergedRow.reserve((last1 - first1) + (last2 - first2));
+        std::insert_iterator<FlexibleRowType> result(mergedRow, mergedRow.end());
 
         uint_fast64_t successorOffsetInNewBackwardTransitions = 0;
         // Now we merge the two successor lists. (Code taken from std::set_union and modified to suit our needs).
@@ -180,7 +196,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
 
         // Now move the new transitions in place.
-        predecessorForwardTransitions = std::move(newSuccessors);
+        predecessorForwardTransitions.assign(std::make_move_iterator(mergedRow.begin()), std::make_move_iterator(mergedRow.end()));
         STORM_LOG_TRACE("Fixed new next-state probabilities of predecessor state " << predecessor << ".");
 
         updatePredecessor(predecessor, multiplyFactor, row);
@@ -217,9 +233,9 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         FlexibleRowIterator first2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].begin();
         FlexibleRowIterator last2 = newBackwardEntries[successorOffsetInNewBackwardTransitions].end();
 
-        FlexibleRowType newPredecessors;
-        newPredecessors.reserve((last1 - first1) + (last2 - first2));
-        std::insert_iterator<FlexibleRowType> result(newPredecessors, newPredecessors.end());
+        mergedRow.clear();
+        mergedRow.reserve((last1 - first1) + (last2 - first2));
+        std::insert_iterator<FlexibleRowType> result(mergedRow, mergedRow.end());
 
         for (; first1 != last1; ++result) {
             if (first2 == last2) {
@@ -258,7 +274,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                          });
         }
         // Now move the new predecessors in place.
-        successorBackwardTransitions = std::move(newPredecessors);
+        successorBackwardTransitions.assign(std::make_move_iterator(mergedRow.begin()), std::make_move_iterator(mergedRow.end()));
         ++successorOffsetInNewBackwardTransitions;
     }
     STORM_LOG_TRACE("Fixed predecessor lists of successor states.");
@@ -271,7 +287,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
 
     // If the substitution was filtered, we need to store the new rows that have an entry in column equal to this row.
     if (isFilterPredecessor()) {
-        elementsWithEntryInColumnEqualRow = std::move(rowsKeepingEntryInColumnEqualRow);
+        elementsWithEntryInColumnEqualRow.assign(rowsKeepingEntryInColumnEqualRow.begin(), rowsKeepingEntryInColumnEqualRow.end());
     } else {
         elementsWithEntryInColumnEqualRow.clear();
         elementsWithEntryInColumnEqualRow.shrink_to_fit();
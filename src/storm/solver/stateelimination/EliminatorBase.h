@@ -16,11 +16,26 @@ class EliminatorBase {
     typedef typename storm::storage::FlexibleSparseMatrix<ValueType>::row_type FlexibleRowType;
     typedef typename FlexibleRowType::iterator FlexibleRowIterator;
 
+    // Buffers into which the rows affected by an elimination are merged. They are kept across eliminations, so
+    // that merging the rows does not need to allocate memory every time.
+    struct MergeBuffers {
+        FlexibleRowType mergedRow;
+        FlexibleRowType rowsKeepingEntryInColumnEqualRow;
+        std::vector<FlexibleRowType> newBackwardEntries;
+    };
+
     EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix, storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix);
     virtual ~EliminatorBase() = default;
 
     void eliminate(uint64_t row, uint64_t column, bool clearRow);
 
+    /*!
+     * Performs the elimination using the given buffers. Eliminations that do not share any rows or columns (that is
+     * the eliminated states neither have common predecessors or successors nor are predecessors or successors of
+     * each other) may be performed concurrently with separate buffers.
+     */
+    void eliminate(uint64_t row, uint64_t column, bool clearRow, MergeBuffers& buffers);
+
     void eliminateLoop(uint64_t row);
 
     // Provide virtual methods that can be customized by subclasses to govern side-effect of the elimination.
@@ -34,6 +49,9 @@ class EliminatorBase {
    protected:
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+   private:
+    MergeBuffers buffers;
 };
 
 }  // namespace stateelimination
@@ -1,12 +1,25 @@
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 
+#include <type_traits>
+
+#include "storm-config.h"
+
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
+#include "storm/storage/BitVector.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 #include "StaticStatePriorityQueue.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#endif
+
 namespace storm {
 namespace solver {
 namespace stateelimination {
@@ -43,13 +56,107 @@ void PrioritizedStateEliminator<ValueType>::updatePriority(storm::storage::spars
 
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::eliminateAll(bool removeForwardTransitions) {
-    while (priorityQueue->hasNext()) {
-        storm::storage::sparse::state_type state = priorityQueue->pop();
-        this->eliminateState(state, removeForwardTransitions);
-        if (removeForwardTransitions) {
-            clearStateValues(state);
+    eliminateAll([removeForwardTransitions](storm::storage::sparse::state_type) { return removeForwardTransitions; }, 1);
+}
+
+template<typename ValueType>
+void PrioritizedStateEliminator<ValueType>::eliminateAll(std::function<bool(storm::storage::sparse::state_type)> const& removeForwardTransitions,
+                                                         uint64_t numberOfThreads) {
+    bool eliminateInBatches = numberOfThreads > 1 && priorityQueue->hasStaticOrder() && this->matrix.hasTrivialRowGrouping();
+#ifndef STORM_HAVE_INTELTBB
+    if (eliminateInBatches) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential state elimination.");
+        eliminateInBatches = false;
+    }
+#endif
+    if (std::is_same<ValueType, storm::RationalFunction>::value && eliminateInBatches) {
+        STORM_LOG_INFO("The states of parametric models are eliminated sequentially.");
+        eliminateInBatches = false;
+    }
+
+    if (eliminateInBatches) {
+        eliminateAllInBatches(removeForwardTransitions, numberOfThreads);
+    } else {
+        while (priorityQueue->hasNext()) {
+            storm::storage::sparse::state_type state = priorityQueue->pop();
+            bool removeForwardTransitionsOfState = removeForwardTransitions(state);
+            this->eliminateState(state, removeForwardTransitionsOfState);
+            if (removeForwardTransitionsOfState) {
+                clearStateValues(state);
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+void PrioritizedStateEliminator<ValueType>::eliminateAllInBatches(std::function<bool(storm::storage::sparse::state_type)> const& removeForwardTransitions,
+                                                                  uint64_t numberOfThreads) {
+#ifdef STORM_HAVE_INTELTBB
+    // The states that are affected by the elimination of a state are the state itself, its predecessors and its
+    // successors. A state can join the current batch if none of these states is affected by another state of the batch.
+    storm::storage::BitVector affectedStates(this->matrix.getRowCount());
+    auto forEachAffectedState = [this](storm::storage::sparse::state_type state, auto const& function) {
+        function(state);
+        for (auto const& entry : this->matrix.getRow(state)) {
+            function(entry.getColumn());
+        }
+        for (auto const& entry : this->transposedMatrix.getRow(state)) {
+            function(entry.getColumn());
+        }
+    };
+
+    tbb::task_arena arena(static_cast<int>(numberOfThreads));
+    tbb::enumerable_thread_specific<typename StateEliminator<ValueType>::MergeBuffers> threadBuffers;
+    std::vector<std::pair<storm::storage::sparse::state_type, bool>> batch;
+    bool hasPendingState = false;
+    storm::storage::sparse::state_type pendingState = 0;
+    uint64_t numberOfBatches = 0;
+    while (hasPendingState || priorityQueue->hasNext()) {
+        // Collect the longest prefix of the remaining states whose eliminations are independent of each other.
+        batch.clear();
+        while (hasPendingState || priorityQueue->hasNext()) {
+            storm::storage::sparse::state_type state = hasPendingState ? pendingState : priorityQueue->pop();
+            hasPendingState = false;
+
+            bool independent = true;
+            forEachAffectedState(state, [&](uint64_t affectedState) { independent &= !affectedStates.get(affectedState); });
+            if (!independent) {
+                hasPendingState = true;
+                pendingState = state;
+                break;
+            }
+            forEachAffectedState(state, [&](uint64_t affectedState) { affectedStates.set(affectedState); });
+            batch.emplace_back(state, removeForwardTransitions(state));
+        }
+        for (auto const& stateRemovePair : batch) {
+            forEachAffectedState(stateRemovePair.first, [&](uint64_t affectedState) { affectedStates.set(affectedState, false); });
+        }
+        ++numberOfBatches;
+
+        auto eliminateBatchState = [&](std::pair<storm::storage::sparse::state_type, bool> const& stateRemovePair,
+                                       typename StateEliminator<ValueType>::MergeBuffers& buffers) {
+            STORM_LOG_TRACE("Eliminating state " << stateRemovePair.first << ".");
+            this->eliminate(stateRemovePair.first, stateRemovePair.first, stateRemovePair.second, buffers);
+            if (stateRemovePair.second) {
+                clearStateValues(stateRemovePair.first);
+            }
+        };
+        if (batch.size() == 1) {
+            eliminateBatchState(batch.front(), threadBuffers.local());
+        } else {
+            arena.execute([&]() {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batch.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        eliminateBatchState(batch[index], threadBuffers.local());
+                    }
+                });
+            });
         }
     }
+    STORM_LOG_DEBUG("Eliminated states in " << numberOfBatches << " batches.");
+#else
+    STORM_LOG_THROW(false, storm::exceptions::IllegalFunctionCallException, "Eliminating states in batches requires Intel TBB.");
+#endif
 }
 
 template<typename ValueType>
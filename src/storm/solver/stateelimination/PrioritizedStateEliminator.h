@@ -1,6 +1,8 @@
 #ifndef STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 #define STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 
+#include <functional>
+
 #include "storm/solver/stateelimination/StateEliminator.h"
 
 namespace storm {
@@ -28,11 +30,30 @@ class PrioritizedStateEliminator : public StateEliminator<ValueType> {
     virtual void updatePriority(storm::storage::sparse::state_type const& state) override;
 
     virtual void eliminateAll(bool eliminateForwardTransitions = true);
+
+    /*!
+     * Eliminates all states in the priority queue. If more than one thread is to be used and the order of the queue
+     * is static, consecutive states that neither are adjacent nor have a common predecessor or successor are
+     * eliminated concurrently. As these eliminations do not affect each other, the result is the same as the one of
+     * eliminating the states one after another.
+     *
+     * @param removeForwardTransitions A function that determines for each state whether its forward transitions are
+     * to be removed.
+     * @param numberOfThreads The number of threads that eliminate states concurrently.
+     */
+    void eliminateAll(std::function<bool(storm::storage::sparse::state_type)> const& removeForwardTransitions, uint64_t numberOfThreads);
+
     virtual void clearStateValues(storm::storage::sparse::state_type const& state);
 
    protected:
     PriorityQueuePointer priorityQueue;
     std::vector<ValueType>& stateValues;
+
+   private:
+    /*!
+     * Eliminates all states in the (static) priority queue in batches of independent states.
+     */
+    void eliminateAllInBatches(std::function<bool(storm::storage::sparse::state_type)> const& removeForwardTransitions, uint64_t numberOfThreads);
 };
 
 }  // namespace stateelimination
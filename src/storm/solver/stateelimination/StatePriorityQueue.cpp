@@ -8,6 +8,10 @@ void StatePriorityQueue::update(storm::storage::sparse::state_type) {
     // Intentionally left empty.
 }
 
+bool StatePriorityQueue::hasStaticOrder() const {
+    return false;
+}
+
 }  // namespace stateelimination
 }  // namespace solver
 }  // namespace storm
@@ -16,6 +16,11 @@ class StatePriorityQueue {
     virtual storm::storage::sparse::state_type pop() = 0;
     virtual void update(storm::storage::sparse::state_type state);
     virtual std::size_t size() const = 0;
+
+    /*!
+     * Retrieves whether the order of the states is fixed, i.e. whether it is not affected by updates.
+     */
+    virtual bool hasStaticOrder() const;
 };
 
 }  // namespace stateelimination
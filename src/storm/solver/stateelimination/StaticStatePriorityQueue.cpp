@@ -24,6 +24,10 @@ std::size_t StaticStatePriorityQueue::size() const {
     return sortedStates.size() - currentPosition;
 }
 
+bool StaticStatePriorityQueue::hasStaticOrder() const {
+    return true;
+}
+
 }  // namespace stateelimination
 }  // namespace solver
 }  // namespace storm
@@ -15,6 +15,7 @@ class StaticStatePriorityQueue : public StatePriorityQueue {
     virtual bool hasNext() const override;
     virtual storm::storage::sparse::state_type pop() override;
     virtual std::size_t size() const override;
+    virtual bool hasStaticOrder() const override;
 
    private:
     std::vector<uint_fast64_t> sortedStates;
@@ -0,0 +1,108 @@
+#include "storm/storage/AliasTables.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType>
+AliasTables<ValueType>::AliasTables(SparseMatrix<ValueType> const& matrix, uint64_t minimalRowLength, uint64_t maximalNumberOfEntries)
+    : tableIndications(matrix.getRowCount() + 1, 0), numberOfTables(0) {
+    // Select the longest rows whose tables fit into the memory bound.
+    std::vector<uint64_t> candidateRows;
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        if (matrix.getRow(row).getNumberOfEntries() >= std::max<uint64_t>(minimalRowLength, 2)) {
+            candidateRows.push_back(row);
+        }
+    }
+    std::stable_sort(candidateRows.begin(), candidateRows.end(), [&matrix](uint64_t first, uint64_t second) {
+        return matrix.getRow(first).getNumberOfEntries() > matrix.getRow(second).getNumberOfEntries();
+    });
+    std::vector<bool> selectedRows(matrix.getRowCount(), false);
+    uint64_t numberOfEntries = 0;
+    for (auto row : candidateRows) {
+        uint64_t rowLength = matrix.getRow(row).getNumberOfEntries();
+        if (rowLength <= maximalNumberOfEntries - numberOfEntries) {
+            numberOfEntries += rowLength;
+            selectedRows[row] = true;
+            ++numberOfTables;
+        }
+    }
+    STORM_LOG_INFO("Building alias tables for " << numberOfTables << " of " << candidateRows.size() << " rows with at least " << minimalRowLength
+                                                << " entries.");
+
+    // Build the tables using Vose's method.
+    entries.resize(numberOfEntries);
+    std::vector<double> scaledProbabilities;
+    std::vector<uint64_t> small;
+    std::vector<uint64_t> large;
+    uint64_t currentEntry = 0;
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        tableIndications[row] = currentEntry;
+        if (!selectedRows[row]) {
+            continue;
+        }
+
+        auto const& rowEntries = matrix.getRow(row);
+        uint64_t rowLength = rowEntries.getNumberOfEntries();
+        scaledProbabilities.clear();
+        double rowSum = 0.0;
+        for (auto const& entry : rowEntries) {
+            scaledProbabilities.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+            rowSum += scaledProbabilities.back();
+        }
+        STORM_LOG_ASSERT(rowSum > 0.0, "Row " << row << " has no positive entries.");
+
+        small.clear();
+        large.clear();
+        for (uint64_t offset = 0; offset < rowLength; ++offset) {
+            // Normalizing by the actual row sum compensates for rounding errors in the matrix.
+            scaledProbabilities[offset] *= static_cast<double>(rowLength) / rowSum;
+            if (scaledProbabilities[offset] < 1.0) {
+                small.push_back(offset);
+            } else {
+                large.push_back(offset);
+            }
+        }
+        while (!small.empty() && !large.empty()) {
+            uint64_t smallOffset = small.back();
+            small.pop_back();
+            uint64_t largeOffset = large.back();
+            entries[currentEntry + smallOffset] = {scaledProbabilities[smallOffset], largeOffset};
+            scaledProbabilities[largeOffset] -= 1.0 - scaledProbabilities[smallOffset];
+            if (scaledProbabilities[largeOffset] < 1.0) {
+                large.pop_back();
+                small.push_back(largeOffset);
+            }
+        }
+        // The remaining entries are (up to rounding) hit with probability one.
+        for (auto offset : small) {
+            entries[currentEntry + offset] = {1.0, offset};
+        }
+        for (auto offset : large) {
+            entries[currentEntry + offset] = {1.0, offset};
+        }
+        currentEntry += rowLength;
+    }
+    tableIndications.back() = currentEntry;
+}
+
+template<typename ValueType>
+uint64_t AliasTables<ValueType>::getNumberOfTables() const {
+    return numberOfTables;
+}
+
+template<typename ValueType>
+uint64_t AliasTables<ValueType>::getSizeInMemory() const {
+    return tableIndications.size() * sizeof(uint64_t) + entries.size() * sizeof(TableEntry);
+}
+
+template class AliasTables<double>;
+template class AliasTables<storm::RationalNumber>;
+
+}  // namespace storage
+}  // namespace storm
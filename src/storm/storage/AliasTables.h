@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Walker/Vose alias tables for (some of) the rows of a sparse matrix whose rows are probability distributions.
+ * Given a single number drawn uniformly from [0, 1), an alias table selects an entry of its row with probability
+ * proportional to the entry's value in constant time, whereas scanning the row takes time linear in its length.
+ *
+ * As scanning is cheap for short rows, tables are only built for rows with a minimal number of entries. To bound
+ * the memory consumption, the tables of the longest rows are built first until the given maximal number of table
+ * entries is reached. Tables always store probabilities as doubles.
+ *
+ * @tparam ValueType The type of the matrix entries.
+ */
+template<typename ValueType>
+class AliasTables {
+   public:
+    /*!
+     * Builds the alias tables for the given matrix.
+     *
+     * @param matrix The matrix for whose rows to build the tables.
+     * @param minimalRowLength Tables are only built for rows that have at least this many entries.
+     * @param maximalNumberOfEntries The maximal number of entries of all tables combined.
+     */
+    AliasTables(SparseMatrix<ValueType> const& matrix, uint64_t minimalRowLength = 8,
+                uint64_t maximalNumberOfEntries = std::numeric_limits<uint64_t>::max());
+
+    /*!
+     * Retrieves whether a table was built for the given row.
+     */
+    bool hasTable(uint64_t row) const {
+        return tableIndications[row + 1] != tableIndications[row];
+    }
+
+    /*!
+     * Selects an entry of the given row, which needs to have a table.
+     *
+     * @param row The row from which to select the entry.
+     * @param probability A number drawn uniformly from [0, 1).
+     * @return The offset of the selected entry relative to the first entry of the row.
+     */
+    uint64_t sample(uint64_t row, double probability) const {
+        uint64_t const numberOfEntries = tableIndications[row + 1] - tableIndications[row];
+        double const scaled = probability * static_cast<double>(numberOfEntries);
+        uint64_t offset = std::min(static_cast<uint64_t>(scaled), numberOfEntries - 1);
+        TableEntry const& entry = entries[tableIndications[row] + offset];
+        return (scaled - static_cast<double>(offset)) < entry.threshold ? offset : entry.alias;
+    }
+
+    /*!
+     * Retrieves the number of rows for which a table was built.
+     */
+    uint64_t getNumberOfTables() const;
+
+    /*!
+     * Retrieves the (approximate) size of the tables in bytes.
+     */
+    uint64_t getSizeInMemory() const;
+
+   private:
+    struct TableEntry {
+        // The probability with which the entry itself (instead of its alias) is chosen once the entry was hit.
+        double threshold;
+        uint64_t alias;
+    };
+
+    // Marks for every row the start of its table in the entry vector. Rows without table have an empty range.
+    std::vector<uint64_t> tableIndications;
+
+    std::vector<TableEntry> entries;
+
+    uint64_t numberOfTables;
+};
+
+}  // namespace storage
+}  // namespace storm
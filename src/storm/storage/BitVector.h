@@ -554,6 +554,8 @@ class BitVector {
     template<typename StateType>
     friend struct Murmur3BitVectorHash;
 
+    friend class BitVectorArena;
+
    private:
     /*!
      * Creates an empty bit vector with the given number of buckets.
@@ -0,0 +1,86 @@
+#include "storm/storage/BitVectorArena.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+BitVectorArena::BitVectorArena(uint64_t bitsPerEntry, uint64_t entriesPerSlab)
+    : bitsPerEntry(bitsPerEntry), bucketsPerEntry((bitsPerEntry + 63) >> 6), entriesPerSlab(entriesPerSlab), nextOffset(0), numberOfUnreleasedEntries(0) {
+    STORM_LOG_THROW(entriesPerSlab > 0, storm::exceptions::InvalidArgumentException, "A slab must hold at least one bit vector.");
+}
+
+uint64_t BitVectorArena::add(BitVector const& bitVector) {
+    STORM_LOG_ASSERT(bitVector.size() == bitsPerEntry,
+                     "Bit vector of length " << bitVector.size() << " does not fit into arena for length " << bitsPerEntry << ".");
+    uint64_t offset;
+    if (releasedOffsets.empty()) {
+        offset = nextOffset++;
+        if (offset / entriesPerSlab == slabs.size()) {
+            if (freeSlabs.empty()) {
+                slabs.emplace_back(new uint64_t[entriesPerSlab * bucketsPerEntry]);
+            } else {
+                slabs.push_back(std::move(freeSlabs.back()));
+                freeSlabs.pop_back();
+            }
+        }
+    } else {
+        offset = releasedOffsets.back();
+        releasedOffsets.pop_back();
+    }
+    std::copy_n(bitVector.buckets, bucketsPerEntry, getBuckets(offset));
+    ++numberOfUnreleasedEntries;
+    return offset;
+}
+
+void BitVectorArena::get(uint64_t offset, BitVector& result) const {
+    if (result.size() != bitsPerEntry) {
+        result = BitVector(bitsPerEntry);
+    }
+    std::copy_n(getBuckets(offset), bucketsPerEntry, result.buckets);
+}
+
+BitVector BitVectorArena::get(uint64_t offset) const {
+    BitVector result(bitsPerEntry);
+    get(offset, result);
+    return result;
+}
+
+void BitVectorArena::release(uint64_t offset) {
+    STORM_LOG_ASSERT(offset < nextOffset, "Invalid offset " << offset << ".");
+    STORM_LOG_ASSERT(numberOfUnreleasedEntries > 0, "Released bit vector with offset " << offset << " more than once.");
+    releasedOffsets.push_back(offset);
+    --numberOfUnreleasedEntries;
+}
+
+void BitVectorArena::clear() {
+    for (auto& slab : slabs) {
+        freeSlabs.push_back(std::move(slab));
+    }
+    slabs.clear();
+    releasedOffsets.clear();
+    nextOffset = 0;
+    numberOfUnreleasedEntries = 0;
+}
+
+uint64_t BitVectorArena::size() const {
+    return nextOffset;
+}
+
+uint64_t BitVectorArena::getNumberOfUnreleasedEntries() const {
+    return numberOfUnreleasedEntries;
+}
+
+uint64_t BitVectorArena::getNumberOfAllocatedSlabs() const {
+    return slabs.size() + freeSlabs.size();
+}
+
+uint64_t* BitVectorArena::getBuckets(uint64_t offset) const {
+    return slabs[offset / entriesPerSlab].get() + (offset % entriesPerSlab) * bucketsPerEntry;
+}
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents an arena for bit vectors of a fixed length. The bit vectors are stored contiguously in slabs
+ * of 64-bit buckets and are referred to by their offset. As long as no bit vector is released, the offset of a bit
+ * vector is the number of bit vectors that were added to the arena before it. The offsets of released bit vectors are
+ * kept in a free list and handed out again to subsequently added bit vectors, so the arena only grows if more bit
+ * vectors are unreleased at the same time than ever before, independently of the order in which they are released.
+ *
+ * Retrieving a bit vector concurrently from several threads is safe as long as no bit vector is added or released
+ * at the same time.
+ */
+class BitVectorArena {
+   public:
+    /*!
+     * Creates an empty arena for bit vectors of the given length.
+     *
+     * @param bitsPerEntry The length of the bit vectors stored in this arena.
+     * @param entriesPerSlab The number of bit vectors that are stored in a single slab.
+     */
+    BitVectorArena(uint64_t bitsPerEntry, uint64_t entriesPerSlab = 4096);
+
+    BitVectorArena(BitVectorArena&& other) = default;
+    BitVectorArena& operator=(BitVectorArena&& other) = default;
+
+    /*!
+     * Adds the given bit vector to the arena.
+     *
+     * @param bitVector The bit vector to add. Its length must match the length of the bit vectors of this arena.
+     * @return The offset under which the bit vector can be retrieved.
+     */
+    uint64_t add(BitVector const& bitVector);
+
+    /*!
+     * Copies the bit vector with the given offset into the given bit vector. If the length of the target matches the
+     * length of the bit vectors of this arena, its storage is reused.
+     *
+     * @param offset The offset of the (unreleased) bit vector to retrieve.
+     * @param result The bit vector that is overwritten with the retrieved bit vector.
+     */
+    void get(uint64_t offset, BitVector& result) const;
+
+    /*!
+     * Retrieves the bit vector with the given offset.
+     *
+     * @param offset The offset of the (unreleased) bit vector to retrieve.
+     * @return A copy of the bit vector.
+     */
+    BitVector get(uint64_t offset) const;
+
+    /*!
+     * Releases the bit vector with the given offset. The offset is reused for the next bit vector that is added.
+     * Each bit vector must be released at most once.
+     *
+     * @param offset The offset of the bit vector to release.
+     */
+    void release(uint64_t offset);
+
+    /*!
+     * Releases all bit vectors of this arena. The slabs are kept for reuse and subsequently added bit vectors are
+     * again assigned offsets starting at zero.
+     */
+    void clear();
+
+    /*!
+     * Retrieves the number of offsets that were handed out (since the last time the arena was cleared). As offsets of
+     * released bit vectors are reused, this is one more than the largest offset handed out.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of bit vectors that were added to the arena but not yet released.
+     */
+    uint64_t getNumberOfUnreleasedEntries() const;
+
+    /*!
+     * Retrieves the number of slabs that are currently allocated (including the ones kept for reuse after clearing).
+     */
+    uint64_t getNumberOfAllocatedSlabs() const;
+
+   private:
+    /*!
+     * Retrieves a pointer to the first bucket of the bit vector with the given offset.
+     */
+    uint64_t* getBuckets(uint64_t offset) const;
+
+    // The length of the stored bit vectors.
+    uint64_t bitsPerEntry;
+
+    // The number of 64-bit buckets occupied by each bit vector.
+    uint64_t bucketsPerEntry;
+
+    // The number of bit vectors per slab.
+    uint64_t entriesPerSlab;
+
+    // The slab with index i holds the bit vectors with offsets i * entriesPerSlab, ..., (i + 1) * entriesPerSlab - 1.
+    std::vector<std::unique_ptr<uint64_t[]>> slabs;
+
+    // Slabs that were in use before the arena was last cleared and can be reused.
+    std::vector<std::unique_ptr<uint64_t[]>> freeSlabs;
+
+    // The offsets of released bit vectors that are reused before handing out new offsets.
+    std::vector<uint64_t> releasedOffsets;
+
+    // The offset that is handed out next if there are no released offsets.
+    uint64_t nextOffset;
+
+    // The number of bit vectors that were added but not yet released.
+    uint64_t numberOfUnreleasedEntries;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -138,6 +138,15 @@ ValueType BitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
     return values[bucket];
 }
 
+template<class ValueType, class Hash>
+std::pair<bool, ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+    if (flagBucketPair.first) {
+        return std::make_pair(true, values[flagBucketPair.second]);
+    }
+    return std::make_pair(false, ValueType());
+}
+
 template<class ValueType, class Hash>
 bool BitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
     return findBucket(key).first;
@@ -109,6 +109,16 @@ class BitVectorHashMap {
      */
     ValueType getValue(uint64_t bucket) const;
 
+    /*!
+     * Searches for the given key in the map without inserting it. As the map is not modified, this may be called
+     * concurrently by several threads as long as no thread modifies the map at the same time.
+     *
+     * @param key The key to search.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose second
+     * component is the value associated with the key (if it is contained).
+     */
+    std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
     /*!
      * Checks if the given key is already contained in the map.
      *
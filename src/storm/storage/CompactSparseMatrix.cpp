@@ -0,0 +1,289 @@
+#include "storm/storage/CompactSparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<typename ValueType, typename ColumnIndexType>
+CompactSparseMatrix<ValueType, ColumnIndexType>::const_entry::const_entry(ColumnIndexType const* column, ValueType const* value)
+    : column(column), value(value) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::const_entry::getColumn() const {
+    return *column;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+ValueType const& CompactSparseMatrix<ValueType, ColumnIndexType>::const_entry::getValue() const {
+    return *value;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator::const_iterator(ColumnIndexType const* column, ValueType const* value)
+    : column(column), value(value) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::const_entry CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator*() const {
+    return const_entry(column, value);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator& CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator++() {
+    ++column;
+    ++value;
+    return *this;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator++(int) {
+    const_iterator result = *this;
+    ++(*this);
+    return result;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator==(const_iterator const& other) const {
+    return column == other.column;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator::operator!=(const_iterator const& other) const {
+    return column != other.column;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+CompactSparseMatrix<ValueType, ColumnIndexType>::const_rows::const_rows(const_iterator begin, const_iterator end, index_type entryCount)
+    : beginIterator(begin), endIterator(end), entryCount(entryCount) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator CompactSparseMatrix<ValueType, ColumnIndexType>::const_rows::begin() const {
+    return beginIterator;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::const_iterator CompactSparseMatrix<ValueType, ColumnIndexType>::const_rows::end() const {
+    return endIterator;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::const_rows::getNumberOfEntries() const {
+    return entryCount;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+CompactSparseMatrix<ValueType, ColumnIndexType>::CompactSparseMatrix(SparseMatrix<ValueType> const& matrix)
+    : columnCount(matrix.getColumnCount()), trivialRowGrouping(matrix.hasTrivialRowGrouping()) {
+    STORM_LOG_THROW(canRepresent(matrix), storm::exceptions::InvalidArgumentException,
+                    "The column count " << matrix.getColumnCount() << " exceeds the range of the column index type.");
+    columns.reserve(matrix.getEntryCount());
+    values.reserve(matrix.getEntryCount());
+    rowIndications.reserve(matrix.getRowCount() + 1);
+    rowIndications.push_back(0);
+    for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            columns.push_back(static_cast<ColumnIndexType>(entry.getColumn()));
+            values.push_back(entry.getValue());
+        }
+        rowIndications.push_back(columns.size());
+    }
+    rowGroupIndices = matrix.getRowGroupIndices();
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool CompactSparseMatrix<ValueType, ColumnIndexType>::canRepresent(SparseMatrix<ValueType> const& matrix) {
+    // The largest column index is one less than the column count.
+    return matrix.getColumnCount() == 0 || matrix.getColumnCount() - 1 <= static_cast<uint64_t>(std::numeric_limits<ColumnIndexType>::max());
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getRowCount() const {
+    return rowIndications.empty() ? 0 : rowIndications.size() - 1;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getColumnCount() const {
+    return columnCount;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getEntryCount() const {
+    return values.size();
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getRowGroupCount() const {
+    return rowGroupIndices.empty() ? 0 : rowGroupIndices.size() - 1;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type CompactSparseMatrix<ValueType, ColumnIndexType>::getRowGroupSize(index_type group) const {
+    return rowGroupIndices[group + 1] - rowGroupIndices[group];
+}
+
+template<typename ValueType, typename ColumnIndexType>
+bool CompactSparseMatrix<ValueType, ColumnIndexType>::hasTrivialRowGrouping() const {
+    return trivialRowGrouping;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type> const& CompactSparseMatrix<ValueType, ColumnIndexType>::getRowGroupIndices()
+    const {
+    return rowGroupIndices;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::const_rows CompactSparseMatrix<ValueType, ColumnIndexType>::getRows(index_type startRow,
+                                                                                                                              index_type endRow) const {
+    index_type const beginEntry = rowIndications[startRow];
+    index_type const endEntry = rowIndications[endRow];
+    return const_rows(const_iterator(columns.data() + beginEntry, values.data() + beginEntry),
+                      const_iterator(columns.data() + endEntry, values.data() + endEntry), endEntry - beginEntry);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::const_rows CompactSparseMatrix<ValueType, ColumnIndexType>::getRow(index_type row) const {
+    return getRows(row, row + 1);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+typename CompactSparseMatrix<ValueType, ColumnIndexType>::const_rows CompactSparseMatrix<ValueType, ColumnIndexType>::getRowGroup(index_type rowGroup) const {
+    return getRows(rowGroupIndices[rowGroup], rowGroupIndices[rowGroup + 1]);
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
+                                                                         std::vector<ValueType> const* summand) const {
+    // If the vector and the result are aliases, we need a temporary vector.
+    std::vector<ValueType> temporary;
+    std::vector<ValueType>& target = (&vector == &result) ? temporary : result;
+    if (&vector == &result) {
+        STORM_LOG_WARN("Vectors are aliased. Using temporary, which is potentially slow.");
+        temporary.resize(result.size());
+    }
+
+    ColumnIndexType const* columnIt = columns.data();
+    ValueType const* valueIt = values.data();
+    auto rowIt = rowIndications.begin();
+    for (index_type row = 0, rowCount = getRowCount(); row < rowCount; ++row, ++rowIt) {
+        ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (ColumnIndexType const* columnIte = columns.data() + *(rowIt + 1); columnIt != columnIte; ++columnIt, ++valueIt) {
+            newValue += *valueIt * vector[*columnIt];
+        }
+        target[row] = newValue;
+    }
+
+    if (&target == &temporary) {
+        std::swap(result, temporary);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir,
+                                                                        std::vector<uint64_t> const& groupIndices, std::vector<ValueType> const& vector,
+                                                                        std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                        std::vector<uint64_t>* choices) const {
+    // If the vector and the result are aliases, we need a temporary vector.
+    std::vector<ValueType> temporary;
+    std::vector<ValueType>& target = (&vector == &result) ? temporary : result;
+    if (&vector == &result) {
+        STORM_LOG_WARN("Vectors are aliased but are not allowed to be. Using temporary, which is potentially slow.");
+        temporary.resize(result.size());
+    }
+
+    if (dir == storm::solver::OptimizationDirection::Minimize) {
+        multiplyAndReduce<storm::utility::ElementLess<ValueType>>(groupIndices, vector, summand, target, choices);
+    } else {
+        multiplyAndReduce<storm::utility::ElementGreater<ValueType>>(groupIndices, vector, summand, target, choices);
+    }
+
+    if (&target == &temporary) {
+        std::swap(result, temporary);
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+template<typename Compare>
+void CompactSparseMatrix<ValueType, ColumnIndexType>::multiplyAndReduce(std::vector<uint64_t> const& groupIndices, std::vector<ValueType> const& vector,
+                                                                        std::vector<ValueType> const* summand, std::vector<ValueType>& result,
+                                                                        std::vector<uint64_t>* choices) const {
+    Compare compare;
+    ColumnIndexType const* columnIt = columns.data();
+    ValueType const* valueIt = values.data();
+
+    auto multiplyRow = [&](index_type row) {
+        ValueType rowValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+        for (ColumnIndexType const* columnIte = columns.data() + rowIndications[row + 1]; columnIt != columnIte; ++columnIt, ++valueIt) {
+            rowValue += *valueIt * vector[*columnIt];
+        }
+        return rowValue;
+    };
+
+    for (uint64_t group = 0, groupCount = result.size(); group < groupCount; ++group) {
+        uint64_t const groupStart = groupIndices[group];
+        uint64_t const groupEnd = groupIndices[group + 1];
+        // Only multiply and reduce if there is at least one row in the group.
+        if (groupStart == groupEnd) {
+            continue;
+        }
+
+        ValueType currentValue = multiplyRow(groupStart);
+        // Variables for correctly tracking choices (only update if new choice is strictly better).
+        uint64_t selectedChoice = 0;
+        ValueType oldSelectedChoiceValue = currentValue;
+        for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+            ValueType newValue = multiplyRow(row);
+            if (choices && row == (*choices)[group] + groupStart) {
+                oldSelectedChoiceValue = newValue;
+            }
+            if (compare(newValue, currentValue)) {
+                currentValue = newValue;
+                selectedChoice = row - groupStart;
+            }
+        }
+
+        // Finally write value to target vector.
+        result[group] = currentValue;
+        if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+            (*choices)[group] = selectedChoice;
+        }
+    }
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<ColumnIndexType> const& CompactSparseMatrix<ValueType, ColumnIndexType>::getColumnIndices() const {
+    return columns;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<ValueType> const& CompactSparseMatrix<ValueType, ColumnIndexType>::getValues() const {
+    return values;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+std::vector<typename CompactSparseMatrix<ValueType, ColumnIndexType>::index_type> const& CompactSparseMatrix<ValueType, ColumnIndexType>::getRowIndications()
+    const {
+    return rowIndications;
+}
+
+template<typename ValueType, typename ColumnIndexType>
+uint64_t CompactSparseMatrix<ValueType, ColumnIndexType>::getSizeInMemory() const {
+    return columns.size() * sizeof(ColumnIndexType) + values.size() * sizeof(ValueType) + (rowIndications.size() + rowGroupIndices.size()) * sizeof(index_type);
+}
+
+template class CompactSparseMatrix<double, uint32_t>;
+template class CompactSparseMatrix<double, uint64_t>;
+template class CompactSparseMatrix<storm::RationalNumber, uint32_t>;
+template class CompactSparseMatrix<storm::RationalNumber, uint64_t>;
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * A read-only sparse matrix that stores its entries in a structure-of-arrays layout, i.e., the column indices
+ * and the values of the entries are kept in two separate arrays. Column indices are stored with the (possibly
+ * narrower) given index type. This allows for contiguous loads of values and column indices, e.g., in vectorized kernels.
+ *
+ * The matrix is created as a copy of a SparseMatrix. As long as the original matrix is kept alive, it therefore
+ * adds to the memory consumption instead of reducing it.
+ *
+ * The rows are accessible via the same kind of interface as the rows of a SparseMatrix, so algorithms that
+ * only read entries via getColumn() and getValue() can operate on both representations.
+ *
+ * @tparam ValueType The type of the matrix entries.
+ * @tparam ColumnIndexType The type used to store column indices. Must be able to represent the column count.
+ */
+template<typename ValueType, typename ColumnIndexType = uint32_t>
+class CompactSparseMatrix {
+   public:
+    typedef SparseMatrixIndexType index_type;
+    typedef ValueType value_type;
+    typedef ColumnIndexType column_index_type;
+
+    /*!
+     * A reference to a single entry of the matrix.
+     */
+    class const_entry {
+       public:
+        const_entry(ColumnIndexType const* column, ValueType const* value);
+
+        /*!
+         * Retrieves the column of the entry.
+         */
+        index_type getColumn() const;
+
+        /*!
+         * Retrieves the value of the entry.
+         */
+        ValueType const& getValue() const;
+
+       private:
+        ColumnIndexType const* column;
+        ValueType const* value;
+    };
+
+    /*!
+     * An iterator over (consecutive) entries of the matrix.
+     */
+    class const_iterator {
+       public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef const_entry value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const_entry const* pointer;
+        typedef const_entry reference;
+
+        const_iterator(ColumnIndexType const* column, ValueType const* value);
+
+        const_entry operator*() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const_iterator const& other) const;
+        bool operator!=(const_iterator const& other) const;
+
+       private:
+        ColumnIndexType const* column;
+        ValueType const* value;
+    };
+
+    /*!
+     * This class represents a number of consecutive rows of the matrix.
+     */
+    class const_rows {
+       public:
+        const_rows(const_iterator begin, const_iterator end, index_type entryCount);
+
+        /*!
+         * Retrieves an iterator that points to the beginning of the rows.
+         */
+        const_iterator begin() const;
+
+        /*!
+         * Retrieves an iterator that points past the last entry of the rows.
+         */
+        const_iterator end() const;
+
+        /*!
+         * Retrieves the number of entries in the rows.
+         */
+        index_type getNumberOfEntries() const;
+
+       private:
+        const_iterator beginIterator;
+        const_iterator endIterator;
+        index_type entryCount;
+    };
+
+    /*!
+     * Constructs an empty matrix.
+     */
+    CompactSparseMatrix() = default;
+
+    /*!
+     * Constructs a compact copy of the given matrix.
+     *
+     * @param matrix The matrix to copy. Its column count must be representable by the column index type.
+     */
+    explicit CompactSparseMatrix(SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Retrieves whether the columns of the given matrix can be represented with the column index type.
+     */
+    static bool canRepresent(SparseMatrix<ValueType> const& matrix);
+
+    index_type getRowCount() const;
+    index_type getColumnCount() const;
+    index_type getEntryCount() const;
+    index_type getRowGroupCount() const;
+    index_type getRowGroupSize(index_type group) const;
+    bool hasTrivialRowGrouping() const;
+
+    /*!
+     * Returns the indices of the first row of each row group (plus the total number of rows at the end).
+     * If the matrix has a trivial row grouping, the trivial row group indices are returned.
+     */
+    std::vector<index_type> const& getRowGroupIndices() const;
+
+    /*!
+     * Returns an object representing the given row.
+     */
+    const_rows getRow(index_type row) const;
+
+    /*!
+     * Returns an object representing the consecutive rows given by the parameters.
+     *
+     * @param startRow The starting row.
+     * @param endRow The ending row (which is *not* included).
+     */
+    const_rows getRows(index_type startRow, index_type endRow) const;
+
+    /*!
+     * Returns an object representing the given row group.
+     */
+    const_rows getRowGroup(index_type rowGroup) const;
+
+    /*!
+     * Multiplies the matrix with the given vector and writes the result to the given result vector.
+     *
+     * @param vector The vector with which to multiply the matrix.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param summand If given, this summand will be added to the result of the multiplication.
+     */
+    void multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand = nullptr) const;
+
+    /*!
+     * Multiplies the matrix with the given vector, reduces it according to the given direction and writes the
+     * result to the given result vector. The semantics coincide with SparseMatrix::multiplyAndReduce.
+     *
+     * @param dir The optimization direction for the reduction.
+     * @param groupIndices The row groups for the reduction
+     * @param vector The vector with which to multiply the matrix.
+     * @param summand If given, this summand will be added to the result of the multiplication.
+     * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+     * @param choices If given, the choices made in the reduction process will be written to this vector.
+     */
+    void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& groupIndices, std::vector<ValueType> const& vector,
+                           std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    /*!
+     * Provides raw access to the column indices of all entries, e.g., for vectorized kernels.
+     */
+    std::vector<ColumnIndexType> const& getColumnIndices() const;
+
+    /*!
+     * Provides raw access to the values of all entries, e.g., for vectorized kernels.
+     */
+    std::vector<ValueType> const& getValues() const;
+
+    /*!
+     * Provides raw access to the positions at which the rows start (plus the total number of entries at the end).
+     */
+    std::vector<index_type> const& getRowIndications() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by the entries and the row indications of this matrix.
+     */
+    uint64_t getSizeInMemory() const;
+
+   private:
+    template<typename Compare>
+    void multiplyAndReduce(std::vector<uint64_t> const& groupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand,
+                           std::vector<ValueType>& result, std::vector<uint64_t>* choices) const;
+
+    // The number of columns of the matrix.
+    index_type columnCount = 0;
+
+    // The column indices of all entries.
+    std::vector<ColumnIndexType> columns;
+
+    // The values of all entries.
+    std::vector<ValueType> values;
+
+    // The positions in 'columns' and 'values' at which the rows start (plus the total number of entries at the end).
+    std::vector<index_type> rowIndications;
+
+    // The indices of the first rows of the row groups (plus the number of rows at the end).
+    std::vector<index_type> rowGroupIndices;
+
+    // Whether the row grouping is trivial.
+    bool trivialRowGrouping = true;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,189 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <mutex>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::Segment::Segment(uint64_t bucketSize, uint64_t initialSize) : currentSize(1), numberOfElements(0) {
+    while (initialSize > 0) {
+        ++currentSize;
+        initialSize >>= 1;
+    }
+
+    // Create the underlying containers.
+    buckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
+    occupied = storm::storage::BitVector(1ull << currentSize);
+    values = std::vector<ValueType>(1ull << currentSize);
+}
+
+template<class ValueType, class Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, uint64_t numberOfSegments,
+                                                                        double loadFactor)
+    : loadFactor(loadFactor), bucketSize(bucketSize), hashWidth(sizeof(decltype(hasher(storm::storage::BitVector()))) * 8) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+
+    uint64_t actualNumberOfSegments = 1;
+    while (actualNumberOfSegments < numberOfSegments) {
+        actualNumberOfSegments <<= 1;
+    }
+
+    uint64_t initialSegmentSize = (initialSize + actualNumberOfSegments - 1) / actualNumberOfSegments;
+    segments.reserve(actualNumberOfSegments);
+    for (uint64_t segmentIndex = 0; segmentIndex < actualNumberOfSegments; ++segmentIndex) {
+        segments.push_back(std::make_unique<Segment>(bucketSize, initialSegmentSize));
+    }
+}
+
+template<class ValueType, class Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::Segment& ConcurrentBitVectorHashMap<ValueType, Hash>::getSegment(uint64_t hash) const {
+    // The low-order bits select the segment, the high-order bits select the bucket within the segment.
+    return *segments[hash & (segments.size() - 1)];
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findBucket(Segment const& segment, storm::storage::BitVector const& key,
+                                                                                 uint64_t hash) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+    uint64_t const numberOfBuckets = 1ull << segment.currentSize;
+    uint64_t bucket = hash >> (hashWidth - segment.currentSize);
+
+    while (segment.occupied.get(bucket)) {
+        if (segment.buckets.matches(bucket * bucketSize, key)) {
+            return std::make_pair(true, bucket);
+        }
+        ++bucket;
+        if (bucket == numberOfBuckets) {
+            bucket = 0;
+        }
+    }
+
+    return std::make_pair(false, bucket);
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::insert(Segment& segment, storm::storage::BitVector const& key, uint64_t hash, ValueType const& value) {
+    // If the load of the segment is too high, we increase its size.
+    if (segment.numberOfElements >= loadFactor * (1ull << segment.currentSize)) {
+        increaseSize(segment);
+    }
+
+    std::pair<bool, uint64_t> flagAndBucket = findBucket(segment, key, hash);
+    STORM_LOG_ASSERT(!flagAndBucket.first, "Key is already contained in the map.");
+    segment.buckets.set(flagAndBucket.second * bucketSize, key);
+    segment.occupied.set(flagAndBucket.second);
+    segment.values[flagAndBucket.second] = value;
+    ++segment.numberOfElements;
+}
+
+template<class ValueType, class Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::increaseSize(Segment& segment) {
+    ++segment.currentSize;
+    STORM_LOG_TRACE("Increasing size of hash map segment from " << (1ull << (segment.currentSize - 1)) << " to " << (1ull << segment.currentSize) << ".");
+
+    // Create new containers and swap them with the old ones.
+    storm::storage::BitVector oldBuckets(bucketSize * (1ull << segment.currentSize));
+    std::swap(oldBuckets, segment.buckets);
+    storm::storage::BitVector oldOccupied(1ull << segment.currentSize);
+    std::swap(oldOccupied, segment.occupied);
+    std::vector<ValueType> oldValues(1ull << segment.currentSize);
+    std::swap(oldValues, segment.values);
+
+    // Now iterate through the elements and reinsert them in the new storage.
+    for (auto bucketIndex : oldOccupied) {
+        storm::storage::BitVector key = oldBuckets.get(bucketIndex * bucketSize, bucketSize);
+        std::pair<bool, uint64_t> flagAndBucket = findBucket(segment, key, hasher(key));
+        segment.buckets.set(flagAndBucket.second * bucketSize, key);
+        segment.occupied.set(flagAndBucket.second);
+        segment.values[flagAndBucket.second] = oldValues[bucketIndex];
+    }
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrAddWith(key, [&value]() { return value; }).first;
+}
+
+template<class ValueType, class Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddWith(storm::storage::BitVector const& key,
+                                                                                     std::function<ValueType()> const& valueGenerator) {
+    uint64_t hash = hasher(key);
+    Segment& segment = getSegment(hash);
+
+    // Most requests concern keys that are already contained, so we first search with a shared lock.
+    {
+        std::shared_lock<std::shared_mutex> lock(segment.mutex);
+        std::pair<bool, uint64_t> flagAndBucket = findBucket(segment, key, hash);
+        if (flagAndBucket.first) {
+            return std::make_pair(segment.values[flagAndBucket.second], false);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(segment.mutex);
+    // Another thread may have inserted the key in the meantime.
+    std::pair<bool, uint64_t> flagAndBucket = findBucket(segment, key, hash);
+    if (flagAndBucket.first) {
+        return std::make_pair(segment.values[flagAndBucket.second], false);
+    }
+    ValueType value = valueGenerator();
+    insert(segment, key, hash, value);
+    return std::make_pair(value, true);
+}
+
+template<class ValueType, class Hash>
+std::pair<bool, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    uint64_t hash = hasher(key);
+    Segment const& segment = getSegment(hash);
+    std::shared_lock<std::shared_mutex> lock(segment.mutex);
+    std::pair<bool, uint64_t> flagAndBucket = findBucket(segment, key, hash);
+    if (flagAndBucket.first) {
+        return std::make_pair(true, segment.values[flagAndBucket.second]);
+    }
+    return std::make_pair(false, ValueType());
+}
+
+template<class ValueType, class Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    return find(key).first;
+}
+
+template<class ValueType, class Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    std::pair<bool, ValueType> flagValuePair = find(key);
+    STORM_LOG_ASSERT(flagValuePair.first, "Unknown key.");
+    return flagValuePair.second;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    uint64_t result = 0;
+    for (auto const& segment : segments) {
+        std::shared_lock<std::shared_mutex> lock(segment->mutex);
+        result += segment->numberOfElements;
+    }
+    return result;
+}
+
+template<class ValueType, class Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getNumberOfSegments() const {
+    return segments.size();
+}
+
+template<class ValueType, class Hash>
+BitVectorHashMap<ValueType, Hash> ConcurrentBitVectorHashMap<ValueType, Hash>::toBitVectorHashMap() const {
+    BitVectorHashMap<ValueType, Hash> result(bucketSize, size());
+    for (auto const& segment : segments) {
+        for (auto bucketIndex : segment->occupied) {
+            result.findOrAdd(segment->buckets.get(bucketIndex * bucketSize, bucketSize), segment->values[bucketIndex]);
+        }
+    }
+    return result;
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+}  // namespace storage
+}  // namespace storm
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * This class represents a hash-map whose keys are bit vectors and that can be queried and extended by several
+ * threads concurrently. Just as for the BitVectorHashMap, only queries and insertions are supported and the keys
+ * must be bit vectors with a length that is a multiple of 64.
+ *
+ * The map is split into a number of segments, each of which stores its keys in the same fixed-width bucket layout
+ * as the BitVectorHashMap and is guarded by its own reader-writer lock. The segment of a key is determined by the
+ * low-order bits of its hash value and its bucket within the segment by the high-order bits. Segments grow
+ * independently of each other, so rehashing is incremental in the sense that it only blocks accesses to a single
+ * segment at a time.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+class ConcurrentBitVectorHashMap {
+   public:
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of buckets that is initially available (in total over all segments).
+     * @param numberOfSegments The number of independently locked segments. This is rounded up to a power of two.
+     * @param loadFactor The load factor that determines at which point the size of a segment is increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, uint64_t numberOfSegments = 64, double loadFactor = 0.75);
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+     * key is inserted with the given value.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is not found, the key is inserted with the value obtained from
+     * the given generator. The generator is invoked at most once and only while the segment of the key is locked.
+     * Hence, it can, for example, be used to hand out consecutive indices to new keys.
+     *
+     * @param key The key to search or insert.
+     * @param valueGenerator A function that yields the value of the key if it needs to be inserted.
+     * @return A pair whose first component is the value associated with the key and whose second component
+     * indicates whether the key was inserted by this call.
+     */
+    std::pair<ValueType, bool> findOrAddWith(storm::storage::BitVector const& key, std::function<ValueType()> const& valueGenerator);
+
+    /*!
+     * Searches for the given key in the map without inserting it.
+     *
+     * @param key The key to search.
+     * @return A pair whose first component indicates whether the key is contained in the map and whose second
+     * component is the value associated with the key (if it is contained).
+     */
+    std::pair<bool, ValueType> find(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     *
+     * @param key The key to search
+     * @return True if the key is already contained in the map
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+     * undefined.
+     *
+     * @return The value associated with the given key (if any).
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the size of the map in terms of the number of key-value pairs it stores. If other threads
+     * concurrently insert keys, the result is only a snapshot.
+     *
+     * @return The size of the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of segments of this map.
+     *
+     * @return The number of segments.
+     */
+    uint64_t getNumberOfSegments() const;
+
+    /*!
+     * Copies all key-value pairs into a (sequential) BitVectorHashMap. This must not be called while other
+     * threads modify the map.
+     *
+     * @return The resulting map.
+     */
+    BitVectorHashMap<ValueType, Hash> toBitVectorHashMap() const;
+
+   private:
+    /*!
+     * A part of the map that is guarded by a single lock.
+     */
+    struct Segment {
+        Segment(uint64_t bucketSize, uint64_t initialSize);
+
+        // The lock guarding the segment. Queries acquire it in shared mode, insertions in exclusive mode.
+        mutable std::shared_mutex mutex;
+
+        // The number of buckets is 2^currentSize.
+        uint64_t currentSize;
+
+        // The buckets that hold the elements of the segment.
+        storm::storage::BitVector buckets;
+
+        // A bit vector that stores which buckets actually hold a value.
+        storm::storage::BitVector occupied;
+
+        // A vector of the mapped-to values. The entry at position i is the "target" of the key in bucket i.
+        std::vector<ValueType> values;
+
+        // The number of elements in this segment.
+        uint64_t numberOfElements;
+    };
+
+    /*!
+     * Retrieves the segment that is responsible for keys with the given hash value.
+     */
+    Segment& getSegment(uint64_t hash) const;
+
+    /*!
+     * Searches for the bucket with the given key in the given segment. The caller must hold the lock of the segment.
+     *
+     * @return A pair whose first component indicates whether the key is already contained in the segment and whose
+     * second component indicates in which bucket the key is stored (or can be inserted).
+     */
+    std::pair<bool, uint64_t> findBucket(Segment const& segment, storm::storage::BitVector const& key, uint64_t hash) const;
+
+    /*!
+     * Inserts the given key into the given segment, increasing the size of the segment if necessary. The caller must
+     * hold the lock of the segment exclusively and the key must not be contained in the segment.
+     */
+    void insert(Segment& segment, storm::storage::BitVector const& key, uint64_t hash, ValueType const& value);
+
+    /*!
+     * Increases the size of the given segment and performs the necessary rehashing of its entries. The caller must
+     * hold the lock of the segment exclusively.
+     */
+    void increaseSize(Segment& segment);
+
+    // The load factor determining when the size of a segment is increased.
+    double loadFactor;
+
+    // The size of one bucket.
+    uint64_t bucketSize;
+
+    // The number of bits of a hash value.
+    uint64_t hashWidth;
+
+    // The segments of this map. The number of segments is always a power of two.
+    std::vector<std::unique_ptr<Segment>> segments;
+
+    // Functor object that are used to perform the actual hashing.
+    Hash hasher;
+};
+
+}  // namespace storage
+}  // namespace storm
@@ -1,12 +1,25 @@
+#include <algorithm>
+#include <limits>
 #include <list>
 #include <numeric>
 #include <queue>
+#include <type_traits>
 
+#include "storm-config.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#endif
 
 namespace storm {
 namespace storage {
@@ -234,6 +247,303 @@ void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDeco
     STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
 }
 
+template<typename ValueType>
+void MaximalEndComponentDecomposition<ValueType>::refine(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                         storm::storage::BitVector const& removedStates, storm::storage::BitVector const& removedChoices,
+                                                         uint64_t numberOfThreads) {
+    STORM_LOG_THROW(removedStates.size() == transitionMatrix.getRowGroupCount(), storm::exceptions::InvalidArgumentException,
+                    "The number of removed states does not match the number of states of the model.");
+    STORM_LOG_THROW(removedChoices.size() == transitionMatrix.getRowCount(), storm::exceptions::InvalidArgumentException,
+                    "The number of removed choices does not match the number of choices of the model.");
+
+    // Every MEC of the new subsystem is contained in a MEC of the old one. Hence, the MECs that neither lose a state
+    // nor a choice remain maximal and only the others need to be decomposed.
+    auto isRemovedChoice = [&removedChoices](uint64_t choice) { return removedChoices.get(choice); };
+    std::vector<uint64_t> affectedMecs;
+    for (uint64_t mecIndex = 0; mecIndex < this->blocks.size(); ++mecIndex) {
+        for (auto const& stateChoices : this->blocks[mecIndex]) {
+            if (removedStates.get(stateChoices.first) || std::any_of(stateChoices.second.begin(), stateChoices.second.end(), isRemovedChoice)) {
+                affectedMecs.push_back(mecIndex);
+                break;
+            }
+        }
+    }
+    if (affectedMecs.empty()) {
+        return;
+    }
+
+    // The affected MECs are independent of each other, so they can be decomposed concurrently.
+    std::vector<std::vector<MaximalEndComponent>> refinedMecs(affectedMecs.size());
+    auto refineAffectedMecs = [&](uint64_t begin, uint64_t end) {
+        for (uint64_t index = begin; index < end; ++index) {
+            refinedMecs[index] = refineMaximalEndComponent(transitionMatrix, this->blocks[affectedMecs[index]], removedStates, removedChoices);
+        }
+    };
+    bool performInParallel = numberOfThreads > 1 && affectedMecs.size() > 1;
+#ifndef STORM_HAVE_INTELTBB
+    if (performInParallel) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential MEC refinement.");
+        performInParallel = false;
+    }
+#endif
+    if (std::is_same<ValueType, storm::RationalFunction>::value && performInParallel) {
+        STORM_LOG_INFO("MEC decompositions of parametric models are refined sequentially.");
+        performInParallel = false;
+    }
+    if (performInParallel) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::task_arena arena(static_cast<int>(numberOfThreads));
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, affectedMecs.size(), 1),
+                              [&refineAffectedMecs](tbb::blocked_range<uint64_t> const& range) { refineAffectedMecs(range.begin(), range.end()); });
+        });
+#endif
+    } else {
+        refineAffectedMecs(0, affectedMecs.size());
+    }
+
+    // Replace each affected MEC by the MECs it contains.
+    std::vector<MaximalEndComponent> newBlocks;
+    newBlocks.reserve(this->blocks.size());
+    auto affectedMecIt = affectedMecs.begin();
+    for (uint64_t mecIndex = 0; mecIndex < this->blocks.size(); ++mecIndex) {
+        if (affectedMecIt != affectedMecs.end() && *affectedMecIt == mecIndex) {
+            auto& refinement = refinedMecs[affectedMecIt - affectedMecs.begin()];
+            std::move(refinement.begin(), refinement.end(), std::back_inserter(newBlocks));
+            ++affectedMecIt;
+        } else {
+            newBlocks.push_back(std::move(this->blocks[mecIndex]));
+        }
+    }
+    this->blocks = std::move(newBlocks);
+
+    STORM_LOG_DEBUG("Refined " << affectedMecs.size() << " MEC(s), the decomposition now has " << this->size() << " MEC(s).");
+}
+
+template<typename ValueType>
+std::vector<MaximalEndComponent> MaximalEndComponentDecomposition<ValueType>::refineMaximalEndComponent(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, MaximalEndComponent const& mec, storm::storage::BitVector const& removedStates,
+    storm::storage::BitVector const& removedChoices) {
+    uint64_t const noIndex = std::numeric_limits<uint64_t>::max();
+
+    // The states of the MEC are identified by their position in the (sorted) state set.
+    MaximalEndComponent::set_type const mecStates = mec.getStateSet();
+    uint64_t const numberOfStates = mecStates.size();
+
+    // Collect the remaining choices of the states together with their successors. Choices that lead to a removed
+    // state can never be part of a MEC and are dropped right away.
+    std::vector<uint64_t> choiceIndications = {0};
+    std::vector<uint64_t> choices;
+    std::vector<uint64_t> choiceSources;
+    std::vector<uint64_t> successorIndications = {0};
+    std::vector<uint64_t> successors;
+    uint64_t localState = 0;
+    for (auto state : mecStates) {
+        if (!removedStates.get(state)) {
+            for (auto choice : mec.getChoicesForState(state)) {
+                if (removedChoices.get(choice)) {
+                    continue;
+                }
+                uint64_t const numberOfSuccessors = successors.size();
+                bool choiceStaysInMec = true;
+                for (auto const& entry : transitionMatrix.getRow(choice)) {
+                    if (storm::utility::isZero(entry.getValue())) {
+                        continue;
+                    }
+                    auto successorIt = mecStates.find(entry.getColumn());
+                    STORM_LOG_ASSERT(successorIt != mecStates.end(), "The choices of a MEC must not leave the MEC.");
+                    if (successorIt == mecStates.end() || removedStates.get(entry.getColumn())) {
+                        choiceStaysInMec = false;
+                        break;
+                    }
+                    successors.push_back(successorIt - mecStates.begin());
+                }
+                if (choiceStaysInMec) {
+                    choices.push_back(choice);
+                    choiceSources.push_back(localState);
+                    successorIndications.push_back(successors.size());
+                } else {
+                    successors.resize(numberOfSuccessors);
+                }
+            }
+        }
+        choiceIndications.push_back(choices.size());
+        ++localState;
+    }
+
+    // Store for every state the choices that lead to it.
+    std::vector<uint64_t> predecessorIndications(numberOfStates + 1, 0);
+    for (auto successor : successors) {
+        ++predecessorIndications[successor + 1];
+    }
+    std::partial_sum(predecessorIndications.begin(), predecessorIndications.end(), predecessorIndications.begin());
+    std::vector<uint64_t> predecessorChoices(successors.size());
+    std::vector<uint64_t> insertPositions(predecessorIndications.begin(), predecessorIndications.end() - 1);
+    for (uint64_t localChoice = 0; localChoice < choices.size(); ++localChoice) {
+        for (uint64_t successorIndex = successorIndications[localChoice]; successorIndex < successorIndications[localChoice + 1]; ++successorIndex) {
+            predecessorChoices[insertPositions[successors[successorIndex]]++] = localChoice;
+        }
+    }
+
+    // The sets of states that may still contain MECs. Every candidate gets a unique index and the states that are
+    // still part of the current candidate are marked with its index.
+    std::vector<std::vector<uint64_t>> candidates(1);
+    for (localState = 0; localState < numberOfStates; ++localState) {
+        if (choiceIndications[localState] < choiceIndications[localState + 1]) {
+            candidates.front().push_back(localState);
+        }
+    }
+    std::vector<uint64_t> candidateOfState(numberOfStates, noIndex);
+    uint64_t nextCandidateIndex = 0;
+    std::vector<bool> choiceEnabled(choices.size(), true);
+    std::vector<uint64_t> enabledChoiceCounts(numberOfStates, 0);
+
+    // The data of the SCC search. Preorder numbers are never reset, so a state is unvisited in the current search
+    // iff its preorder number is smaller than the first number assigned in this search.
+    struct SearchFrame {
+        uint64_t state;
+        uint64_t choice;
+        uint64_t successorIndex;
+    };
+    std::vector<uint64_t> preorderNumbers(numberOfStates, 0);
+    std::vector<uint64_t> lowlinks(numberOfStates, 0);
+    std::vector<bool> onSccStack(numberOfStates, false);
+    uint64_t nextPreorderNumber = 1;
+    std::vector<uint64_t> sccStack;
+    std::vector<SearchFrame> searchStack;
+    std::vector<uint64_t> removalStack;
+
+    std::vector<MaximalEndComponent> result;
+    while (!candidates.empty()) {
+        std::vector<uint64_t> candidate = std::move(candidates.back());
+        candidates.pop_back();
+        uint64_t const candidateIndex = nextCandidateIndex++;
+        for (auto state : candidate) {
+            candidateOfState[state] = candidateIndex;
+        }
+
+        // Disable the choices that leave the candidate and remove the states without enabled choice until a
+        // fixpoint is reached.
+        for (auto state : candidate) {
+            uint64_t enabledChoiceCount = 0;
+            for (uint64_t localChoice = choiceIndications[state]; localChoice < choiceIndications[state + 1]; ++localChoice) {
+                if (!choiceEnabled[localChoice]) {
+                    continue;
+                }
+                bool choiceStaysInCandidate =
+                    std::all_of(successors.begin() + successorIndications[localChoice], successors.begin() + successorIndications[localChoice + 1],
+                                [&](uint64_t successor) { return candidateOfState[successor] == candidateIndex; });
+                if (choiceStaysInCandidate) {
+                    ++enabledChoiceCount;
+                } else {
+                    choiceEnabled[localChoice] = false;
+                }
+            }
+            enabledChoiceCounts[state] = enabledChoiceCount;
+            if (enabledChoiceCount == 0) {
+                candidateOfState[state] = noIndex;
+                removalStack.push_back(state);
+            }
+        }
+        while (!removalStack.empty()) {
+            uint64_t state = removalStack.back();
+            removalStack.pop_back();
+            for (uint64_t predecessorIndex = predecessorIndications[state]; predecessorIndex < predecessorIndications[state + 1]; ++predecessorIndex) {
+                uint64_t localChoice = predecessorChoices[predecessorIndex];
+                uint64_t source = choiceSources[localChoice];
+                if (choiceEnabled[localChoice] && candidateOfState[source] == candidateIndex) {
+                    choiceEnabled[localChoice] = false;
+                    if (--enabledChoiceCounts[source] == 0) {
+                        candidateOfState[source] = noIndex;
+                        removalStack.push_back(source);
+                    }
+                }
+            }
+        }
+        candidate.erase(std::remove_if(candidate.begin(), candidate.end(), [&](uint64_t state) { return candidateOfState[state] != candidateIndex; }),
+                        candidate.end());
+
+        // Decompose the remaining states into SCCs (w.r.t. the enabled choices) with Tarjan's algorithm.
+        std::vector<std::vector<uint64_t>> sccs;
+        uint64_t const firstPreorderNumber = nextPreorderNumber;
+        auto visit = [&](uint64_t state) {
+            preorderNumbers[state] = lowlinks[state] = nextPreorderNumber++;
+            sccStack.push_back(state);
+            onSccStack[state] = true;
+            searchStack.push_back({state, choiceIndications[state], successorIndications[choiceIndications[state]]});
+        };
+        for (auto root : candidate) {
+            if (preorderNumbers[root] >= firstPreorderNumber) {
+                continue;
+            }
+            visit(root);
+            while (!searchStack.empty()) {
+                SearchFrame& frame = searchStack.back();
+                uint64_t const state = frame.state;
+                bool descended = false;
+                while (frame.choice < choiceIndications[state + 1]) {
+                    if (!choiceEnabled[frame.choice] || frame.successorIndex == successorIndications[frame.choice + 1]) {
+                        ++frame.choice;
+                        frame.successorIndex = successorIndications[frame.choice];
+                        continue;
+                    }
+                    uint64_t successor = successors[frame.successorIndex++];
+                    if (preorderNumbers[successor] < firstPreorderNumber) {
+                        // Note that this invalidates the reference to the current frame.
+                        visit(successor);
+                        descended = true;
+                        break;
+                    } else if (onSccStack[successor]) {
+                        lowlinks[state] = std::min(lowlinks[state], preorderNumbers[successor]);
+                    }
+                }
+                if (descended) {
+                    continue;
+                }
+
+                searchStack.pop_back();
+                if (!searchStack.empty()) {
+                    uint64_t parent = searchStack.back().state;
+                    lowlinks[parent] = std::min(lowlinks[parent], lowlinks[state]);
+                }
+                if (lowlinks[state] == preorderNumbers[state]) {
+                    std::vector<uint64_t> scc;
+                    uint64_t sccState;
+                    do {
+                        sccState = sccStack.back();
+                        sccStack.pop_back();
+                        onSccStack[sccState] = false;
+                        scc.push_back(sccState);
+                    } while (sccState != state);
+                    sccs.push_back(std::move(scc));
+                }
+            }
+        }
+
+        if (sccs.size() == 1) {
+            // Every state has a choice that stays in the candidate and the candidate is strongly connected, so it
+            // is an end component. As all states outside of it were excluded for a reason, it is maximal.
+            MaximalEndComponent newMec;
+            for (auto state : sccs.front()) {
+                MaximalEndComponent::set_type containedChoices;
+                for (uint64_t localChoice = choiceIndications[state]; localChoice < choiceIndications[state + 1]; ++localChoice) {
+                    if (choiceEnabled[localChoice]) {
+                        containedChoices.insert(choices[localChoice]);
+                    }
+                }
+                newMec.addState(*(mecStates.begin() + state), std::move(containedChoices));
+            }
+            result.push_back(std::move(newMec));
+        } else {
+            // Choices between different SCCs can not be part of a MEC, so each SCC is considered separately.
+            for (auto& scc : sccs) {
+                candidates.push_back(std::move(scc));
+            }
+        }
+    }
+    return result;
+}
+
 // Explicitly instantiate the MEC decomposition.
 template class MaximalEndComponentDecomposition<double>;
 template MaximalEndComponentDecomposition<double>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<double> const& model);
@@ -94,6 +94,19 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
      */
     MaximalEndComponentDecomposition& operator=(MaximalEndComponentDecomposition&& other);
 
+    /*!
+     * Refines this decomposition such that it becomes the MEC decomposition of the subsystem that is obtained by
+     * removing the given states and choices from the subsystem this decomposition was computed for. Only the MECs
+     * that contain a removed state or choice are decomposed again, all other MECs are kept as they are.
+     *
+     * @param transitionMatrix The transition matrix of the model that this decomposition was computed for.
+     * @param removedStates The states to remove from the subsystem.
+     * @param removedChoices The choices to remove from the subsystem.
+     * @param numberOfThreads If greater than one, the affected MECs are decomposed in parallel by this many threads.
+     */
+    void refine(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& removedStates,
+                storm::storage::BitVector const& removedChoices, uint64_t numberOfThreads = 1);
+
    private:
     /*!
      * Performs the actual decomposition of the given subsystem in the given model into MECs. As a side-effect
@@ -107,6 +120,20 @@ class MaximalEndComponentDecomposition : public Decomposition<MaximalEndComponen
     void performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                  storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr,
                                                  storm::storage::BitVector const* choices = nullptr);
+
+    /*!
+     * Decomposes the given MEC into the MECs that remain once the given states and choices are removed. As the
+     * resulting MECs are contained in the given one, only the states and choices of the given MEC are inspected.
+     *
+     * @param transitionMatrix The transition matrix of the model that the MEC belongs to.
+     * @param mec The MEC to decompose.
+     * @param removedStates The states to remove.
+     * @param removedChoices The choices to remove.
+     * @return The MECs contained in the given MEC.
+     */
+    static std::vector<MaximalEndComponent> refineMaximalEndComponent(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                      MaximalEndComponent const& mec, storm::storage::BitVector const& removedStates,
+                                                                      storm::storage::BitVector const& removedChoices);
 };
 }  // namespace storage
 }  // namespace storm
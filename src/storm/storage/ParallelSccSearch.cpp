@@ -0,0 +1,616 @@
+#include "storm/storage/ParallelSccSearch.h"
+
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+
+#include "storm-config.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_invoke.h"
+#include "tbb/parallel_sort.h"
+#include "tbb/task_arena.h"
+#endif
+
+namespace storm {
+namespace storage {
+
+// The color of the states that were assigned to an SCC or that are not considered at all.
+uint64_t const assignedColor = 0;
+
+// The color of all considered states at the beginning.
+uint64_t const initialColor = 1;
+
+// Sets of at most this many states are decomposed sequentially.
+uint64_t const sequentialDecompositionSize = 4096;
+
+// Frontiers with at least this many items are expanded in parallel.
+uint64_t const parallelFrontierSize = 1024;
+
+// The number of buckets of 64 states that a thread processes at once.
+uint64_t const bucketsPerTask = 16;
+
+template<typename ValueType>
+ParallelSccSearch<ValueType>::ParallelSccSearch(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem,
+                                                storm::storage::BitVector const* choices, uint64_t numberOfThreads)
+    : transitionMatrix(transitionMatrix),
+      subsystem(subsystem),
+      choices(choices),
+      numberOfStates(transitionMatrix.getRowGroupCount()),
+      numberOfThreads(std::max<uint64_t>(numberOfThreads, 1)),
+      nextColor(initialColor + 1),
+      sccCount(0) {
+    STORM_LOG_ASSERT(!subsystem || subsystem->size() == numberOfStates, "Unexpected size of the subsystem.");
+}
+
+template<typename ValueType>
+uint64_t ParallelSccSearch<ValueType>::decompose(std::vector<uint64_t>& stateToSccMapping, storm::storage::BitVector& nonTrivialStates,
+                                                 std::vector<uint64_t>* sccDepths) {
+    auto performSearch = [&]() {
+        buildGraph();
+
+        colors.reset(new std::atomic<uint64_t>[numberOfStates]);
+        parents.reset(new std::atomic<uint64_t>[numberOfStates]);
+        preorderNumbers.resize(numberOfStates);
+        stateToScc.resize(numberOfStates);
+        forEachStateRange([this](uint64_t begin, uint64_t end) {
+            for (uint64_t state = begin; state < end; ++state) {
+                colors[state].store(consideredStates.get(state) ? initialColor : assignedColor, std::memory_order_relaxed);
+            }
+        });
+
+        decompose(trim(), initialColor);
+        sortSccs(stateToSccMapping, nonTrivialStates, sccDepths);
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    tbb::task_arena arena(static_cast<int>(numberOfThreads));
+    arena.execute(performSearch);
+#else
+    performSearch();
+#endif
+
+    // Free the auxiliary memory.
+    colors.reset();
+    parents.reset();
+    preorderNumbers = std::vector<uint64_t>();
+    stateToScc = std::vector<uint64_t>();
+    return sccCount.load();
+}
+
+template<typename ValueType>
+void ParallelSccSearch<ValueType>::buildGraph() {
+    consideredStates = subsystem ? *subsystem : storm::storage::BitVector(numberOfStates, true);
+    selfLoops = storm::storage::BitVector(numberOfStates);
+
+    // The row grouping of a matrix with trivial row grouping is created lazily, so we retrieve it before any of the parallel loops.
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+
+    // Invokes the given function for every successor of the given state in the subsystem.
+    auto forEachSuccessor = [this, &rowGroupIndices](uint64_t state, auto const& function) {
+        for (uint64_t row = rowGroupIndices[state], rowEnd = rowGroupIndices[state + 1]; row != rowEnd; ++row) {
+            if (choices && !choices->get(row)) {
+                continue;
+            }
+            for (auto const& successor : transitionMatrix.getRow(row)) {
+                if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                    function(successor.getColumn());
+                }
+            }
+        }
+    };
+
+    // First count the transitions of each state, then store them.
+    successorIndications.assign(numberOfStates + 1, 0);
+    forEachStateRange([&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = consideredStates.getNextSetIndex(begin); state < end; state = consideredStates.getNextSetIndex(state + 1)) {
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (successor == state) {
+                    selfLoops.set(state);
+                } else {
+                    ++successorIndications[state + 1];
+                }
+            });
+        }
+    });
+    std::partial_sum(successorIndications.begin(), successorIndications.end(), successorIndications.begin());
+    successors.resize(successorIndications.back());
+    std::unique_ptr<std::atomic<uint64_t>[]> predecessorCounts(new std::atomic<uint64_t>[numberOfStates]());
+    forEachStateRange([&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = consideredStates.getNextSetIndex(begin); state < end; state = consideredStates.getNextSetIndex(state + 1)) {
+            uint64_t position = successorIndications[state];
+            forEachSuccessor(state, [&](uint64_t successor) {
+                if (successor != state) {
+                    successors[position++] = successor;
+                    predecessorCounts[successor].fetch_add(1, std::memory_order_relaxed);
+                }
+            });
+        }
+    });
+
+    // Reverse the transitions. The counts are reused as the positions at which the next predecessor is stored.
+    predecessorIndications.resize(numberOfStates + 1);
+    predecessorIndications[0] = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        predecessorIndications[state + 1] = predecessorIndications[state] + predecessorCounts[state].load(std::memory_order_relaxed);
+        predecessorCounts[state].store(predecessorIndications[state], std::memory_order_relaxed);
+    }
+    predecessors.resize(predecessorIndications.back());
+    forEachStateRange([&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = consideredStates.getNextSetIndex(begin); state < end; state = consideredStates.getNextSetIndex(state + 1)) {
+            for (uint64_t position = successorIndications[state]; position < successorIndications[state + 1]; ++position) {
+                predecessors[predecessorCounts[successors[position]].fetch_add(1, std::memory_order_relaxed)] = state;
+            }
+        }
+    });
+}
+
+template<typename ValueType>
+std::vector<uint64_t> ParallelSccSearch<ValueType>::trim() {
+    // A state without incoming or outgoing transitions (to states that were not removed yet) can not lie on a cycle.
+    std::unique_ptr<std::atomic<uint64_t>[]> inDegrees(new std::atomic<uint64_t>[numberOfStates]);
+    std::unique_ptr<std::atomic<uint64_t>[]> outDegrees(new std::atomic<uint64_t>[numberOfStates]);
+    std::mutex frontierMutex;
+    std::vector<uint64_t> frontier;
+    forEachStateRange([&](uint64_t begin, uint64_t end) {
+        std::vector<uint64_t> removedStates;
+        for (uint64_t state = begin; state < end; ++state) {
+            inDegrees[state].store(predecessorIndications[state + 1] - predecessorIndications[state], std::memory_order_relaxed);
+            outDegrees[state].store(successorIndications[state + 1] - successorIndications[state], std::memory_order_relaxed);
+            if (consideredStates.get(state) && (predecessorIndications[state + 1] == predecessorIndications[state] ||
+                                                successorIndications[state + 1] == successorIndications[state])) {
+                removedStates.push_back(state);
+            }
+        }
+        if (!removedStates.empty()) {
+            std::lock_guard<std::mutex> lock(frontierMutex);
+            frontier.insert(frontier.end(), removedStates.begin(), removedStates.end());
+        }
+    });
+    for (auto state : frontier) {
+        changeColor(state, initialColor, assignedColor);
+    }
+
+    while (!frontier.empty()) {
+        for (auto state : frontier) {
+            assignToScc(state, sccCount.fetch_add(1, std::memory_order_relaxed));
+        }
+        frontier = expandFrontier(frontier, [this, &inDegrees, &outDegrees](uint64_t state, std::vector<uint64_t>& removedStates) {
+            for (uint64_t position = successorIndications[state]; position < successorIndications[state + 1]; ++position) {
+                uint64_t successor = successors[position];
+                if (inDegrees[successor].fetch_sub(1, std::memory_order_relaxed) == 1 && changeColor(successor, initialColor, assignedColor)) {
+                    removedStates.push_back(successor);
+                }
+            }
+            for (uint64_t position = predecessorIndications[state]; position < predecessorIndications[state + 1]; ++position) {
+                uint64_t predecessor = predecessors[position];
+                if (outDegrees[predecessor].fetch_sub(1, std::memory_order_relaxed) == 1 && changeColor(predecessor, initialColor, assignedColor)) {
+                    removedStates.push_back(predecessor);
+                }
+            }
+        });
+    }
+
+    std::vector<uint64_t> remainingStates;
+    for (auto state : consideredStates) {
+        if (colors[state].load(std::memory_order_relaxed) == initialColor) {
+            remainingStates.push_back(state);
+        }
+    }
+    uint64_t const numberOfConsideredStates = consideredStates.getNumberOfSetBits();
+    STORM_LOG_TRACE("Trimming removed " << (numberOfConsideredStates - remainingStates.size()) << " of " << numberOfConsideredStates << " states.");
+    return remainingStates;
+}
+
+template<typename ValueType>
+void ParallelSccSearch<ValueType>::decompose(std::vector<uint64_t>&& states, uint64_t color) {
+    if (states.size() <= sequentialDecompositionSize) {
+        decomposeSequentially(states);
+        return;
+    }
+
+    std::vector<std::vector<uint64_t>> components = splitIntoWeaklyConnectedComponents(states, color);
+    if (components.size() == 1) {
+        decomposeConnected(std::move(states), color);
+        return;
+    }
+
+    // Large components are decomposed further, small ones are gathered and decomposed sequentially.
+    std::vector<std::vector<uint64_t>> largeComponents;
+    std::vector<std::vector<uint64_t>> smallComponentBatches(1);
+    for (auto& component : components) {
+        if (component.size() > sequentialDecompositionSize) {
+            largeComponents.push_back(std::move(component));
+        } else {
+            if (smallComponentBatches.back().size() + component.size() > sequentialDecompositionSize) {
+                smallComponentBatches.emplace_back();
+            }
+            smallComponentBatches.back().insert(smallComponentBatches.back().end(), component.begin(), component.end());
+        }
+    }
+    components.clear();
+    states.clear();
+    states.shrink_to_fit();
+
+    uint64_t const numberOfTasks = largeComponents.size() + smallComponentBatches.size();
+    auto processTask = [&](uint64_t task) {
+        if (task < largeComponents.size()) {
+            decomposeConnected(std::move(largeComponents[task]), color);
+        } else {
+            decomposeSequentially(smallComponentBatches[task - largeComponents.size()]);
+        }
+    };
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfTasks, 1), [&processTask](tbb::blocked_range<uint64_t> const& range) {
+        for (uint64_t task = range.begin(); task < range.end(); ++task) {
+            processTask(task);
+        }
+    });
+#else
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        processTask(task);
+    }
+#endif
+}
+
+template<typename ValueType>
+void ParallelSccSearch<ValueType>::decomposeConnected(std::vector<uint64_t>&& states, uint64_t color) {
+    // The states reachable from the pivot get the forward color. Afterwards, the states reaching the pivot get the
+    // backward color if they are not forward reachable and the SCC color otherwise. Taking the pivot from the middle
+    // splits chains of SCCs evenly if the states are numbered along the chains.
+    uint64_t const forwardColor = nextColor.fetch_add(3, std::memory_order_relaxed);
+    uint64_t const backwardColor = forwardColor + 1;
+    uint64_t const sccColor = forwardColor + 2;
+    uint64_t const pivot = states[states.size() / 2];
+    recolorReachableStates(pivot, color, forwardColor, color, forwardColor, true);
+    recolorReachableStates(pivot, color, backwardColor, forwardColor, sccColor, false);
+
+    std::vector<uint64_t> forwardStates;
+    std::vector<uint64_t> backwardStates;
+    std::vector<uint64_t> remainingStates;
+    uint64_t const sccIndex = sccCount.fetch_add(1, std::memory_order_relaxed);
+    for (auto state : states) {
+        uint64_t const stateColor = colors[state].load(std::memory_order_relaxed);
+        if (stateColor == sccColor) {
+            assignToScc(state, sccIndex);
+        } else if (stateColor == forwardColor) {
+            forwardStates.push_back(state);
+        } else if (stateColor == backwardColor) {
+            backwardStates.push_back(state);
+        } else {
+            STORM_LOG_ASSERT(stateColor == color, "Unexpected color.");
+            remainingStates.push_back(state);
+        }
+    }
+    states.clear();
+    states.shrink_to_fit();
+
+    // The three sets are only connected via the SCC of the pivot (or in the direction from the backward reachable
+    // states to the other ones), so they can be decomposed independently.
+    auto decomposeForwardStates = [&]() { decompose(std::move(forwardStates), forwardColor); };
+    auto decomposeBackwardStates = [&]() { decompose(std::move(backwardStates), backwardColor); };
+    auto decomposeRemainingStates = [&]() { decompose(std::move(remainingStates), color); };
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_invoke(decomposeForwardStates, decomposeBackwardStates, decomposeRemainingStates);
+#else
+    decomposeForwardStates();
+    decomposeBackwardStates();
+    decomposeRemainingStates();
+#endif
+}
+
+template<typename ValueType>
+void ParallelSccSearch<ValueType>::decomposeSequentially(std::vector<uint64_t> const& states) {
+    // States on the stack of the algorithm get a color that is not used anywhere else.
+    uint64_t const visitedColor = nextColor.fetch_add(1, std::memory_order_relaxed);
+    uint64_t currentIndex = 0;
+    std::vector<uint64_t> recursionStateStack;
+    std::vector<uint64_t> s;
+    std::vector<uint64_t> p;
+
+    for (auto startState : states) {
+        uint64_t const color = colors[startState].load(std::memory_order_relaxed);
+        if (color == assignedColor || color == visitedColor) {
+            continue;
+        }
+
+        recursionStateStack.push_back(startState);
+        while (!recursionStateStack.empty()) {
+            uint64_t currentState = recursionStateStack.back();
+
+            if (colors[currentState].load(std::memory_order_relaxed) == color) {
+                // The state is visited for the first time.
+                colors[currentState].store(visitedColor, std::memory_order_relaxed);
+                preorderNumbers[currentState] = currentIndex++;
+                s.push_back(currentState);
+                p.push_back(currentState);
+
+                for (uint64_t position = successorIndications[currentState]; position < successorIndications[currentState + 1]; ++position) {
+                    uint64_t successor = successors[position];
+                    uint64_t const successorColor = colors[successor].load(std::memory_order_relaxed);
+                    if (successorColor == color) {
+                        recursionStateStack.push_back(successor);
+                    } else if (successorColor == visitedColor) {
+                        while (preorderNumbers[p.back()] > preorderNumbers[successor]) {
+                            p.pop_back();
+                        }
+                    }
+                }
+            } else {
+                // All successors of the state were searched.
+                if (currentState == p.back()) {
+                    p.pop_back();
+                    uint64_t const sccIndex = sccCount.fetch_add(1, std::memory_order_relaxed);
+                    uint64_t poppedState = 0;
+                    do {
+                        poppedState = s.back();
+                        s.pop_back();
+                        assignToScc(poppedState, sccIndex);
+                    } while (poppedState != currentState);
+                }
+                recursionStateStack.pop_back();
+            }
+        }
+    }
+}
+
+template<typename ValueType>
+std::vector<std::vector<uint64_t>> ParallelSccSearch<ValueType>::splitIntoWeaklyConnectedComponents(std::vector<uint64_t> const& states, uint64_t color) {
+    // Unite the states with their successors in a union-find structure in which the larger root is always linked to
+    // the smaller one. The root of a component is thus its smallest state.
+    auto forEachIndex = [&states](auto const& function) {
+#ifdef STORM_HAVE_INTELTBB
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, states.size(), 1024), [&function](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                function(index);
+            }
+        });
+#else
+        for (uint64_t index = 0; index < states.size(); ++index) {
+            function(index);
+        }
+#endif
+    };
+    forEachIndex([&](uint64_t index) { parents[states[index]].store(states[index], std::memory_order_relaxed); });
+    forEachIndex([&](uint64_t index) {
+        uint64_t const state = states[index];
+        for (uint64_t position = successorIndications[state]; position < successorIndications[state + 1]; ++position) {
+            uint64_t successor = successors[position];
+            if (colors[successor].load(std::memory_order_relaxed) != color) {
+                continue;
+            }
+            uint64_t first = state;
+            uint64_t second = successor;
+            while (true) {
+                first = findRoot(first);
+                second = findRoot(second);
+                if (first == second) {
+                    break;
+                }
+                if (first < second) {
+                    std::swap(first, second);
+                }
+                uint64_t expected = first;
+                if (parents[first].compare_exchange_strong(expected, second)) {
+                    break;
+                }
+            }
+        }
+    });
+    std::vector<uint64_t> roots(states.size());
+    forEachIndex([&](uint64_t index) { roots[index] = findRoot(states[index]); });
+
+    // Number the components. As the roots do not need their preorder numbers now, they store the index of their component.
+    uint64_t numberOfComponents = 0;
+    for (uint64_t index = 0; index < states.size(); ++index) {
+        if (roots[index] == states[index]) {
+            preorderNumbers[states[index]] = numberOfComponents++;
+        }
+    }
+    std::vector<std::vector<uint64_t>> components(numberOfComponents);
+    if (numberOfComponents == 1) {
+        // Avoid copying the states, the caller keeps using them.
+        return components;
+    }
+    for (uint64_t index = 0; index < states.size(); ++index) {
+        components[preorderNumbers[roots[index]]].push_back(states[index]);
+    }
+    return components;
+}
+
+template<typename ValueType>
+void ParallelSccSearch<ValueType>::recolorReachableStates(uint64_t initialState, uint64_t firstColor, uint64_t firstNewColor, uint64_t secondColor,
+                                                          uint64_t secondNewColor, bool forward) {
+    auto recolor = [this, firstColor, firstNewColor, secondColor, secondNewColor](uint64_t state) {
+        uint64_t const stateColor = colors[state].load(std::memory_order_relaxed);
+        if (stateColor == firstColor) {
+            return changeColor(state, firstColor, firstNewColor);
+        } else if (stateColor == secondColor) {
+            return changeColor(state, secondColor, secondNewColor);
+        }
+        return false;
+    };
+
+    std::vector<uint64_t> const& indications = forward ? successorIndications : predecessorIndications;
+    std::vector<uint64_t> const& transitions = forward ? successors : predecessors;
+    std::vector<uint64_t> frontier;
+    if (recolor(initialState)) {
+        frontier.push_back(initialState);
+    }
+    while (!frontier.empty()) {
+        frontier = expandFrontier(frontier, [&](uint64_t state, std::vector<uint64_t>& recoloredStates) {
+            for (uint64_t position = indications[state]; position < indications[state + 1]; ++position) {
+                if (recolor(transitions[position])) {
+                    recoloredStates.push_back(transitions[position]);
+                }
+            }
+        });
+    }
+}
+
+template<typename ValueType>
+bool ParallelSccSearch<ValueType>::changeColor(uint64_t state, uint64_t fromColor, uint64_t toColor) {
+    return colors[state].compare_exchange_strong(fromColor, toColor, std::memory_order_relaxed);
+}
+
+template<typename ValueType>
+void ParallelSccSearch<ValueType>::assignToScc(uint64_t state, uint64_t sccIndex) {
+    stateToScc[state] = sccIndex;
+    colors[state].store(assignedColor, std::memory_order_relaxed);
+}
+
+template<typename ValueType>
+uint64_t ParallelSccSearch<ValueType>::findRoot(uint64_t state) {
+    while (true) {
+        uint64_t parent = parents[state].load(std::memory_order_relaxed);
+        if (parent == state) {
+            return state;
+        }
+        // Halve the path. This is safe, as parents are only replaced by states further up in the tree.
+        uint64_t grandParent = parents[parent].load(std::memory_order_relaxed);
+        if (grandParent != parent) {
+            parents[state].compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);
+        }
+        state = grandParent;
+    }
+}
+
+template<typename ValueType>
+void ParallelSccSearch<ValueType>::sortSccs(std::vector<uint64_t>& stateToSccMapping, storm::storage::BitVector& nonTrivialStates,
+                                            std::vector<uint64_t>* sccDepths) {
+    uint64_t const numberOfSccs = sccCount.load();
+
+    // Gather the states of each SCC (in ascending order).
+    std::vector<uint64_t> sccIndications(numberOfSccs + 1, 0);
+    for (auto state : consideredStates) {
+        ++sccIndications[stateToScc[state] + 1];
+    }
+    std::partial_sum(sccIndications.begin(), sccIndications.end(), sccIndications.begin());
+    std::vector<uint64_t> sccStates(sccIndications.back());
+    {
+        std::vector<uint64_t> nextPositions(sccIndications.begin(), sccIndications.end() - 1);
+        for (auto state : consideredStates) {
+            sccStates[nextPositions[stateToScc[state]]++] = state;
+        }
+    }
+
+    // Compute the depths of the SCCs level by level, starting from the bottom SCCs. An SCC is reached once all
+    // transitions leaving it have been traversed backwards, so it is reached from its deepest successor SCC.
+    std::unique_ptr<std::atomic<uint64_t>[]> remainingLeavingTransitions(new std::atomic<uint64_t>[numberOfSccs]());
+    forEachStateRange([&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = consideredStates.getNextSetIndex(begin); state < end; state = consideredStates.getNextSetIndex(state + 1)) {
+            for (uint64_t position = successorIndications[state]; position < successorIndications[state + 1]; ++position) {
+                if (stateToScc[successors[position]] != stateToScc[state]) {
+                    remainingLeavingTransitions[stateToScc[state]].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    });
+    std::vector<uint64_t> depths(numberOfSccs);
+    std::vector<uint64_t> frontier;
+    for (uint64_t sccIndex = 0; sccIndex < numberOfSccs; ++sccIndex) {
+        if (remainingLeavingTransitions[sccIndex].load(std::memory_order_relaxed) == 0) {
+            frontier.push_back(sccIndex);
+        }
+    }
+    for (uint64_t depth = 0; !frontier.empty(); ++depth) {
+        for (auto sccIndex : frontier) {
+            depths[sccIndex] = depth;
+        }
+        frontier = expandFrontier(frontier, [&](uint64_t sccIndex, std::vector<uint64_t>& reachedSccs) {
+            for (uint64_t statePosition = sccIndications[sccIndex]; statePosition < sccIndications[sccIndex + 1]; ++statePosition) {
+                uint64_t state = sccStates[statePosition];
+                for (uint64_t position = predecessorIndications[state]; position < predecessorIndications[state + 1]; ++position) {
+                    uint64_t predecessorScc = stateToScc[predecessors[position]];
+                    if (predecessorScc != sccIndex && remainingLeavingTransitions[predecessorScc].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                        reachedSccs.push_back(predecessorScc);
+                    }
+                }
+            }
+        });
+    }
+
+    // Sort the SCCs by their depth and their smallest state.
+    std::vector<uint64_t> sortedSccs(numberOfSccs);
+    std::iota(sortedSccs.begin(), sortedSccs.end(), 0);
+    auto sccLess = [&](uint64_t first, uint64_t second) {
+        return std::tie(depths[first], sccStates[sccIndications[first]]) < std::tie(depths[second], sccStates[sccIndications[second]]);
+    };
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_sort(sortedSccs.begin(), sortedSccs.end(), sccLess);
+#else
+    std::sort(sortedSccs.begin(), sortedSccs.end(), sccLess);
+#endif
+    std::vector<uint64_t> newSccIndices(numberOfSccs);
+    for (uint64_t newSccIndex = 0; newSccIndex < numberOfSccs; ++newSccIndex) {
+        newSccIndices[sortedSccs[newSccIndex]] = newSccIndex;
+    }
+
+    forEachStateRange([&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = consideredStates.getNextSetIndex(begin); state < end; state = consideredStates.getNextSetIndex(state + 1)) {
+            uint64_t const sccIndex = stateToScc[state];
+            stateToSccMapping[state] = newSccIndices[sccIndex];
+            if (selfLoops.get(state) || sccIndications[sccIndex + 1] - sccIndications[sccIndex] > 1) {
+                nonTrivialStates.set(state);
+            }
+        }
+    });
+    if (sccDepths) {
+        sccDepths->resize(numberOfSccs);
+        for (uint64_t newSccIndex = 0; newSccIndex < numberOfSccs; ++newSccIndex) {
+            (*sccDepths)[newSccIndex] = depths[sortedSccs[newSccIndex]];
+        }
+    }
+}
+
+template<typename ValueType>
+template<typename Function>
+void ParallelSccSearch<ValueType>::forEachStateRange(Function const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+    uint64_t const numberOfBuckets = (numberOfStates + 63) / 64;
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBuckets, bucketsPerTask), [this, &function](tbb::blocked_range<uint64_t> const& range) {
+        function(range.begin() * 64, std::min(range.end() * 64, numberOfStates));
+    });
+#else
+    function(0, numberOfStates);
+#endif
+}
+
+template<typename ValueType>
+template<typename Function>
+std::vector<uint64_t> ParallelSccSearch<ValueType>::expandFrontier(std::vector<uint64_t> const& frontier, Function const& function) const {
+    std::vector<uint64_t> nextFrontier;
+#ifdef STORM_HAVE_INTELTBB
+    if (frontier.size() >= parallelFrontierSize) {
+        std::mutex nextFrontierMutex;
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, frontier.size(), parallelFrontierSize / 4), [&](tbb::blocked_range<uint64_t> const& range) {
+            std::vector<uint64_t> foundItems;
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                function(frontier[index], foundItems);
+            }
+            if (!foundItems.empty()) {
+                std::lock_guard<std::mutex> lock(nextFrontierMutex);
+                nextFrontier.insert(nextFrontier.end(), foundItems.begin(), foundItems.end());
+            }
+        });
+        return nextFrontier;
+    }
+#endif
+    for (auto item : frontier) {
+        function(item, nextFrontier);
+    }
+    return nextFrontier;
+}
+
+template class ParallelSccSearch<double>;
+template class ParallelSccSearch<storm::RationalNumber>;
+template class ParallelSccSearch<storm::RationalFunction>;
+
+}  // namespace storage
+}  // namespace storm
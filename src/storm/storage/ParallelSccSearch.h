@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+
+/*!
+ * Decomposes the (sub)system given by a transition matrix into its strongly connected components using multiple
+ * threads.
+ *
+ * The search first repeatedly removes (trims) states without incoming or outgoing transitions, as these form trivial
+ * SCCs. The remaining states are split into their weakly connected components, which are decomposed independently.
+ * Large components are decomposed with the forward-backward algorithm: the states that are both forward and backward
+ * reachable from a pivot state form its SCC, and the states that are only forward reachable, only backward reachable or
+ * neither are again decomposed independently. Small sets of states are decomposed sequentially with the path-based
+ * algorithm. Finally, the SCCs are sorted by their depth (and their smallest state), which yields a topological order
+ * and makes the result independent of the scheduling of the threads.
+ */
+template<typename ValueType>
+class ParallelSccSearch {
+   public:
+    /*!
+     * Prepares the search on the given system.
+     *
+     * @param transitionMatrix The transition matrix of the system.
+     * @param subsystem If given, only the states of this subsystem are considered.
+     * @param choices If given, only the choices selected by this bit vector are considered.
+     * @param numberOfThreads The number of threads that perform the search.
+     */
+    ParallelSccSearch(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem,
+                      storm::storage::BitVector const* choices, uint64_t numberOfThreads);
+
+    /*!
+     * Performs the decomposition.
+     *
+     * @param stateToSccMapping Is filled with the index of the SCC of every considered state. Every SCC only reaches
+     * itself and SCCs with a smaller index.
+     * @param nonTrivialStates Is set for all states that either have a self-loop or whose SCC is not a singleton.
+     * @param sccDepths If given, the depths of the SCCs (in the order of their indices) are stored here.
+     * @return The number of SCCs.
+     */
+    uint64_t decompose(std::vector<uint64_t>& stateToSccMapping, storm::storage::BitVector& nonTrivialStates, std::vector<uint64_t>* sccDepths);
+
+   private:
+    /*!
+     * Builds the forward and backward transitions of the considered subsystem.
+     */
+    void buildGraph();
+
+    /*!
+     * Removes all states that can not lie on a cycle and assigns each of them its own SCC.
+     *
+     * @return The states that were not removed.
+     */
+    std::vector<uint64_t> trim();
+
+    /*!
+     * Decomposes the given states (which all have the given color) into SCCs. There must not be transitions between
+     * the given states and other states of this color.
+     */
+    void decompose(std::vector<uint64_t>&& states, uint64_t color);
+
+    /*!
+     * Decomposes the given weakly connected states (which all have the given color) with a forward-backward step.
+     */
+    void decomposeConnected(std::vector<uint64_t>&& states, uint64_t color);
+
+    /*!
+     * Decomposes the given states with the path-based algorithm. A search started in a state only visits states with
+     * the same color.
+     */
+    void decomposeSequentially(std::vector<uint64_t> const& states);
+
+    /*!
+     * Splits the given states (which all have the given color) into their weakly connected components.
+     */
+    std::vector<std::vector<uint64_t>> splitIntoWeaklyConnectedComponents(std::vector<uint64_t> const& states, uint64_t color);
+
+    /*!
+     * Changes the color of all states that are reachable from the given state via states of the first or second
+     * color. States of the first color get the first new color and states of the second color get the second new
+     * color.
+     *
+     * @param forward If true, the successors are searched, otherwise the predecessors.
+     */
+    void recolorReachableStates(uint64_t initialState, uint64_t firstColor, uint64_t firstNewColor, uint64_t secondColor, uint64_t secondNewColor,
+                                bool forward);
+
+    /*!
+     * Changes the color of the given state if it has the given color.
+     *
+     * @return True iff the color was changed by this call.
+     */
+    bool changeColor(uint64_t state, uint64_t fromColor, uint64_t toColor);
+
+    /*!
+     * Assigns the given state to the given SCC.
+     */
+    void assignToScc(uint64_t state, uint64_t sccIndex);
+
+    /*!
+     * Retrieves the root of the given state in the union-find structure, i.e. the smallest state that is known to be
+     * weakly connected to it.
+     */
+    uint64_t findRoot(uint64_t state);
+
+    /*!
+     * Sorts the SCCs topologically and stores the results of the decomposition in the given arguments.
+     */
+    void sortSccs(std::vector<uint64_t>& stateToSccMapping, storm::storage::BitVector& nonTrivialStates, std::vector<uint64_t>* sccDepths);
+
+    /*!
+     * Invokes the given function for disjoint ranges of states that together cover all states. Every range starts at
+     * a multiple of 64, so the functions may concurrently set bits of (different) states in the same bit vector.
+     */
+    template<typename Function>
+    void forEachStateRange(Function const& function) const;
+
+    /*!
+     * Invokes the given function for all items of the given frontier and collects the items that the function adds
+     * to the vector it is given.
+     */
+    template<typename Function>
+    std::vector<uint64_t> expandFrontier(std::vector<uint64_t> const& frontier, Function const& function) const;
+
+    // The transition matrix of the system.
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+
+    // The considered subsystem and choices (or null if all states and choices are considered).
+    storm::storage::BitVector const* subsystem;
+    storm::storage::BitVector const* choices;
+
+    // The number of states of the system.
+    uint64_t numberOfStates;
+
+    // The number of threads that perform the search.
+    uint64_t numberOfThreads;
+
+    // The forward and backward transitions of the considered subsystem. Self-loops are not stored as transitions.
+    std::vector<uint64_t> successorIndications;
+    std::vector<uint64_t> successors;
+    std::vector<uint64_t> predecessorIndications;
+    std::vector<uint64_t> predecessors;
+
+    // The considered states and those of them that have a self-loop.
+    storm::storage::BitVector consideredStates;
+    storm::storage::BitVector selfLoops;
+
+    // The color of each state. The states that still need to be decomposed are partitioned by their color.
+    std::unique_ptr<std::atomic<uint64_t>[]> colors;
+
+    // The next unused color.
+    std::atomic<uint64_t> nextColor;
+
+    // The parents of the states in the union-find structure that is used to find weakly connected components.
+    std::unique_ptr<std::atomic<uint64_t>[]> parents;
+
+    // The preorder numbers of the states in the path-based algorithm.
+    std::vector<uint64_t> preorderNumbers;
+
+    // The (preliminary) SCC of each state and the number of SCCs found so far.
+    std::vector<uint64_t> stateToScc;
+    std::atomic<uint64_t> sccCount;
+};
+
+}  // namespace storage
+}  // namespace storm
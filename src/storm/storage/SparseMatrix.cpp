@@ -1726,6 +1726,27 @@ void SparseMatrix<ValueType>::multiplyWithVectorForward(std::vector<ValueType> c
     }
 }
 
+template<typename ValueType>
+void SparseMatrix<ValueType>::multiplyWithVectors(std::vector<ValueType> const& vectors, std::vector<ValueType>& result, uint64_t numberOfVectors,
+                                                  std::vector<value_type> const* summand) const {
+    STORM_LOG_ASSERT(&vectors != &result, "The vectors must not be aliased.");
+    STORM_LOG_ASSERT(result.size() == this->getRowCount() * numberOfVectors, "The result has an unexpected size.");
+    STORM_LOG_ASSERT(vectors.size() == this->getColumnCount() * numberOfVectors, "The vectors have an unexpected size.");
+
+    auto resultIterator = result.begin();
+    for (index_type row = 0; row < this->getRowCount(); ++row) {
+        auto resultIteratorEnd = resultIterator + numberOfVectors;
+        std::fill(resultIterator, resultIteratorEnd, summand ? (*summand)[row] : storm::utility::zero<ValueType>());
+        for (auto const& entry : this->getRow(row)) {
+            auto vectorIterator = vectors.begin() + entry.getColumn() * numberOfVectors;
+            for (auto it = resultIterator; it != resultIteratorEnd; ++it, ++vectorIterator) {
+                *it += entry.getValue() * *vectorIterator;
+            }
+        }
+        resultIterator = resultIteratorEnd;
+    }
+}
+
 template<typename ValueType>
 void SparseMatrix<ValueType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result,
                                                          std::vector<value_type> const* summand) const {
@@ -914,6 +914,20 @@ class SparseMatrix {
                                     std::vector<value_type> const* summand = nullptr) const;
 #endif
 
+    /*!
+     * Multiplies the matrix with several vectors at once and writes the results to the given result vector. The
+     * vectors are stored interleaved, i.e. the entries of all vectors for one column (or row, respectively) are
+     * stored consecutively. This way, every entry of the matrix is only loaded once for all vectors.
+     *
+     * @param vectors The interleaved vectors with which to multiply the matrix.
+     * @param result The interleaved vectors that are supposed to hold the results of the multiplication after the
+     * operation. This must not be the same object as the vectors.
+     * @param numberOfVectors The number of interleaved vectors.
+     * @param summand If given, this summand (with one entry per row) will be added to the result of every vector.
+     */
+    void multiplyWithVectors(std::vector<value_type> const& vectors, std::vector<value_type>& result, uint64_t numberOfVectors,
+                             std::vector<value_type> const* summand = nullptr) const;
+
     /*!
      * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
      * the result to the given result vector.
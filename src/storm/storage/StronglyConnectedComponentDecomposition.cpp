@@ -1,8 +1,11 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 #include <storm/utility/vector.h>
+#include <type_traits>
+#include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/ParallelSccSearch.h"
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/macros.h"
 
@@ -179,7 +182,25 @@ void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition
 
     // Obtain a mapping from states to the SCC it belongs to
     std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
-    {
+    bool performInParallel = options.numberOfThreads > 1;
+#ifndef STORM_HAVE_INTELTBB
+    if (performInParallel) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential SCC decomposition.");
+        performInParallel = false;
+    }
+#endif
+    if (std::is_same<ValueType, storm::RationalFunction>::value && performInParallel) {
+        STORM_LOG_INFO("SCC decompositions of parametric models are computed sequentially.");
+        performInParallel = false;
+    }
+    if (performInParallel) {
+        sccDepths = boost::none;
+        if (options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered) {
+            sccDepths = std::vector<uint_fast64_t>();
+        }
+        ParallelSccSearch<ValueType> search(transitionMatrix, options.subsystemPtr, options.choicesPtr, options.numberOfThreads);
+        sccCount = search.decompose(stateToSccMapping, nonTrivialStates, sccDepths ? &sccDepths.get() : nullptr);
+    } else {
         // Set up the environment of the algorithm.
         // Start with the two stacks it maintains.
         // This is to reduce memory (re-)allocations
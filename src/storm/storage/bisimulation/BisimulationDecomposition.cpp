@@ -1,6 +1,9 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
 #include <chrono>
+#include <type_traits>
+
+#include "storm-config.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
@@ -26,6 +29,12 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#endif
+
 namespace storm {
 namespace storage {
 
@@ -60,6 +69,7 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      numberOfThreads(1),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false) {
@@ -256,6 +266,26 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
 
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+    bool useSignatures = options.numberOfThreads > 1;
+#ifndef STORM_HAVE_INTELTBB
+    if (useSignatures) {
+        STORM_LOG_WARN("Storm was built without support for Intel TBB, defaulting to sequential partition refinement.");
+        useSignatures = false;
+    }
+#endif
+    if (std::is_same<ValueType, storm::RationalFunction>::value && useSignatures) {
+        STORM_LOG_INFO("The bisimulation of parametric models is computed sequentially.");
+        useSignatures = false;
+    }
+    if (useSignatures && !this->supportsSignatureBasedRefinement()) {
+        STORM_LOG_INFO("Signature-based partition refinement is not supported for this kind of bisimulation, defaulting to sequential refinement.");
+        useSignatures = false;
+    }
+    if (useSignatures) {
+        this->performSignatureBasedPartitionRefinement();
+        return;
+    }
+
     // Insert all blocks into the splitter queue as a (potential) splitter.
     std::vector<Block<BlockDataType>*> splitterQueue;
     std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&](std::unique_ptr<Block<BlockDataType>> const& block) {
@@ -288,6 +318,66 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedPartitionRefinement() {
+#ifdef STORM_HAVE_INTELTBB
+    uint64_t const numberOfStates = model.getNumberOfStates();
+    auto const needsRefinement = [](Block<BlockDataType> const& block) { return block.getNumberOfStates() > 1 && !block.data().absorbing(); };
+
+    uint_fast64_t iterations = 0;
+    bool partitionChanged = true;
+    tbb::task_arena arena(static_cast<int>(options.numberOfThreads));
+    while (partitionChanged) {
+        ++iterations;
+
+        // Compute the signatures of all states and sort the states of each block according to them. As the
+        // blocks occupy disjoint ranges of the partition, they can be sorted concurrently.
+        std::vector<Block<BlockDataType>*> blocksToRefine;
+        for (auto const& block : partition.getBlocks()) {
+            if (needsRefinement(*block)) {
+                blocksToRefine.push_back(block.get());
+            }
+        }
+        arena.execute([&]() {
+            tbb::parallel_for(tbb::blocked_range<storm::storage::sparse::state_type>(0, numberOfStates, 1024),
+                              [this](tbb::blocked_range<storm::storage::sparse::state_type> const& range) { computeSignatures(range.begin(), range.end()); });
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, blocksToRefine.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                    partition.sortBlock(*blocksToRefine[index], [this](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                        return signatureLess(state1, state2);
+                    });
+                }
+            });
+        });
+
+        // Now split the blocks at the positions where the signature changes. The new blocks are created in front
+        // of the remaining part of the block.
+        partitionChanged = false;
+        for (auto block : blocksToRefine) {
+            std::vector<storm::storage::sparse::state_type> splitPositions;
+            for (auto position = block->getBeginIndex() + 1; position < block->getEndIndex(); ++position) {
+                if (signatureLess(partition.getState(position - 1), partition.getState(position))) {
+                    splitPositions.push_back(position);
+                }
+            }
+            for (auto position : splitPositions) {
+                partition.splitBlock(*block, position);
+            }
+            partitionChanged |= !splitPositions.empty();
+        }
+        STORM_LOG_TRACE("Signature-based refinement round " << iterations << " resulted in " << partition.size() << " blocks.");
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " iterations of partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+        }
+    }
+    STORM_LOG_DEBUG("Signature-based partition refinement took " << iterations << " rounds.");
+#else
+    STORM_LOG_THROW(false, storm::exceptions::IllegalFunctionCallException, "Signature-based partition refinement requires Intel TBB.");
+#endif
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
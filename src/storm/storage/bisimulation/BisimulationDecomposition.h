@@ -126,6 +126,10 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// The number of threads used for the partition refinement. If this is larger than one (and supported for
+        /// the model), the partition is refined in rounds based on the signatures of all states.
+        uint64_t numberOfThreads;
+
        private:
         boost::optional<OptimizationDirection> optimalityType;
 
@@ -208,6 +212,32 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement in rounds. In each round, the signatures of all states wrt. the current
+     * partition are computed and every block is split into the sets of states with equal signatures. The rounds
+     * are repeated until no block is split anymore.
+     */
+    void performSignatureBasedPartitionRefinement();
+
+    /*!
+     * Retrieves whether the partition can be refined based on signatures.
+     */
+    virtual bool supportsSignatureBasedRefinement() const = 0;
+
+    /*!
+     * Computes the signatures of the given states wrt. the current partition. States in absorbing blocks may be
+     * skipped. This function may be called concurrently for disjoint ranges of states.
+     *
+     * @param firstState The first state whose signature to compute.
+     * @param endState The state after the last state whose signature to compute.
+     */
+    virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type endState) = 0;
+
+    /*!
+     * Retrieves whether the (previously computed) signature of the first state is less than the one of the second.
+     */
+    virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const = 0;
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -155,6 +155,75 @@ void DeterministicModelBisimulationDecomposition<ModelType>::initializeLabelBase
     postProcessInitialPartition();
 }
 
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::initialize() {
+    if (this->options.numberOfThreads > 1 && this->supportsSignatureBasedRefinement()) {
+        signatures.resize(this->model.getTransitionMatrix().getEntryCount());
+        signatureSizes.resize(this->model.getNumberOfStates());
+    }
+}
+
+template<typename ModelType>
+bool DeterministicModelBisimulationDecomposition<ModelType>::supportsSignatureBasedRefinement() const {
+    return this->options.getType() == BisimulationType::Strong;
+}
+
+template<typename ModelType>
+void DeterministicModelBisimulationDecomposition<ModelType>::computeSignatures(storm::storage::sparse::state_type firstState,
+                                                                               storm::storage::sparse::state_type endState) {
+    auto const& transitionMatrix = this->model.getTransitionMatrix();
+    for (storm::storage::sparse::state_type state = firstState; state < endState; ++state) {
+        signatureSizes[state] = 0;
+        if (this->partition.getBlock(state).data().absorbing()) {
+            continue;
+        }
+
+        auto signatureBegin = signatures.begin() + std::distance(transitionMatrix.begin(), transitionMatrix.begin(state));
+        auto signatureEnd = signatureBegin;
+        for (auto const& entry : transitionMatrix.getRow(state)) {
+            if (!this->comparator.isZero(entry.getValue())) {
+                *signatureEnd = std::make_pair(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                ++signatureEnd;
+            }
+        }
+        std::sort(signatureBegin, signatureEnd, [](auto const& first, auto const& second) { return first.first < second.first; });
+
+        // Sum up the probabilities of going to the same block.
+        if (signatureBegin != signatureEnd) {
+            auto lastIt = signatureBegin;
+            for (auto it = std::next(signatureBegin); it != signatureEnd; ++it) {
+                if (it->first == lastIt->first) {
+                    lastIt->second += it->second;
+                } else {
+                    *(++lastIt) = std::move(*it);
+                }
+            }
+            signatureSizes[state] = std::distance(signatureBegin, lastIt) + 1;
+        }
+    }
+}
+
+template<typename ModelType>
+bool DeterministicModelBisimulationDecomposition<ModelType>::signatureLess(storm::storage::sparse::state_type state1,
+                                                                           storm::storage::sparse::state_type state2) const {
+    auto const& transitionMatrix = this->model.getTransitionMatrix();
+    auto firstIt = signatures.begin() + std::distance(transitionMatrix.begin(), transitionMatrix.begin(state1));
+    auto firstIte = firstIt + signatureSizes[state1];
+    auto secondIt = signatures.begin() + std::distance(transitionMatrix.begin(), transitionMatrix.begin(state2));
+    auto secondIte = secondIt + signatureSizes[state2];
+    for (; firstIt != firstIte && secondIt != secondIte; ++firstIt, ++secondIt) {
+        if (firstIt->first != secondIt->first) {
+            return firstIt->first < secondIt->first;
+        }
+        if (this->comparator.isLess(firstIt->second, secondIt->second)) {
+            return true;
+        } else if (this->comparator.isLess(secondIt->second, firstIt->second)) {
+            return false;
+        }
+    }
+    return firstIt == firstIte && secondIt != secondIte;
+}
+
 template<typename ModelType>
 typename DeterministicModelBisimulationDecomposition<ModelType>::ValueType const&
 DeterministicModelBisimulationDecomposition<ModelType>::getProbabilityToSplitter(storm::storage::sparse::state_type const& state) const {
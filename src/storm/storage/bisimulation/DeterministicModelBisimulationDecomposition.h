@@ -39,6 +39,14 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
     virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter,
                                                 std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
 
+    virtual void initialize() override;
+
+    virtual bool supportsSignatureBasedRefinement() const override;
+
+    virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type endState) override;
+
+    virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const override;
+
    private:
     // Post-processes the initial partition to properly initialize it.
     void postProcessInitialPartition();
@@ -133,6 +141,14 @@ class DeterministicModelBisimulationDecomposition : public BisimulationDecomposi
 
     // A vector mapping each state to its silent probability.
     std::vector<ValueType> silentProbabilities;
+
+    // The signatures of the states used by the signature-based refinement. The signature of a state holds the
+    // probabilities of going to the blocks (ordered by their IDs) and is stored at the beginning of the range
+    // that the transitions of the state occupy in the transition matrix.
+    std::vector<std::pair<storm::storage::sparse::state_type, ValueType>> signatures;
+
+    // The number of entries of the signature of each state.
+    std::vector<uint_fast64_t> signatureSizes;
 };
 }  // namespace storage
 }  // namespace storm
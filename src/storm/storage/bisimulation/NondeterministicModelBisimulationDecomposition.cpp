@@ -74,17 +74,7 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::initializeQuotie
             // Otherwise, we compute the probabilities from the transition matrix.
             for (auto stateIt = this->partition.begin(*block), stateIte = this->partition.end(*block); stateIt != stateIte; ++stateIt) {
                 for (uint_fast64_t choice = nondeterministicChoiceIndices[*stateIt]; choice < nondeterministicChoiceIndices[*stateIt + 1]; ++choice) {
-                    if (this->options.getKeepRewards() && this->model.hasRewardModel()) {
-                        auto const& rewardModel = this->model.getUniqueRewardModel();
-                        if (rewardModel.hasStateActionRewards()) {
-                            this->quotientDistributions[choice].setReward(rewardModel.getStateActionReward(choice));
-                        }
-                    }
-                    for (auto entry : this->model.getTransitionMatrix().getRow(choice)) {
-                        if (!this->comparator.isZero(entry.getValue())) {
-                            this->quotientDistributions[choice].addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
-                        }
-                    }
+                    computeQuotientDistribution(choice);
                     orderedQuotientDistributions[choice] = &this->quotientDistributions[choice];
                 }
             }
@@ -96,9 +86,25 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::initializeQuotie
     }
 }
 
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::computeQuotientDistribution(uint_fast64_t choice) {
+    this->quotientDistributions[choice] = storm::storage::DistributionWithReward<ValueType>();
+    if (this->options.getKeepRewards() && this->model.hasRewardModel()) {
+        auto const& rewardModel = this->model.getUniqueRewardModel();
+        if (rewardModel.hasStateActionRewards()) {
+            this->quotientDistributions[choice].setReward(rewardModel.getStateActionReward(choice));
+        }
+    }
+    for (auto entry : this->model.getTransitionMatrix().getRow(choice)) {
+        if (!this->comparator.isZero(entry.getValue())) {
+            this->quotientDistributions[choice].addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+        }
+    }
+}
+
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuotientDistributions(storm::storage::sparse::state_type state) {
-    std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
     std::sort(this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state],
               this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state + 1],
               [this](storm::storage::Distribution<ValueType> const* dist1, storm::storage::Distribution<ValueType> const* dist2) {
@@ -400,7 +406,7 @@ template<typename ModelType>
 bool NondeterministicModelBisimulationDecomposition<ModelType>::quotientDistributionsLess(storm::storage::sparse::state_type state1,
                                                                                           storm::storage::sparse::state_type state2) const {
     STORM_LOG_TRACE("Comparing the quotient distributions of state " << state1 << " and " << state2 << ".");
-    std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
 
     auto firstIt = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1];
     auto firstIte = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1 + 1];
@@ -443,6 +449,34 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::refinePartitionB
     splitBlockAccordingToCurrentQuotientDistributions(splitter, splitterQueue);
 }
 
+template<typename ModelType>
+bool NondeterministicModelBisimulationDecomposition<ModelType>::supportsSignatureBasedRefinement() const {
+    return true;
+}
+
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignatures(storm::storage::sparse::state_type firstState,
+                                                                                  storm::storage::sparse::state_type endState) {
+    // The signature of a state is given by its (ordered) quotient distributions. The distributions of states in
+    // absorbing blocks never change.
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+    for (storm::storage::sparse::state_type state = firstState; state < endState; ++state) {
+        if (this->partition.getBlock(state).data().absorbing()) {
+            continue;
+        }
+        for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+            computeQuotientDistribution(choice);
+        }
+        updateOrderedQuotientDistributions(state);
+    }
+}
+
+template<typename ModelType>
+bool NondeterministicModelBisimulationDecomposition<ModelType>::signatureLess(storm::storage::sparse::state_type state1,
+                                                                              storm::storage::sparse::state_type state2) const {
+    return quotientDistributionsLess(state1, state2);
+}
+
 template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>;
 
 #ifdef STORM_HAVE_CARL
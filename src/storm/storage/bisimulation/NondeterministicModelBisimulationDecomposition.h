@@ -40,6 +40,12 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
 
     virtual void initialize() override;
 
+    virtual bool supportsSignatureBasedRefinement() const override;
+
+    virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type endState) override;
+
+    virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const override;
+
    private:
     // Creates the mapping from the choice indices to the states.
     void createChoiceToStateMapping();
@@ -47,6 +53,9 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
     // Initializes the quotient distributions wrt. to the current partition.
     void initializeQuotientDistributions();
 
+    // Computes the quotient distribution of the given choice (of a state in a non-absorbing block) wrt. the current partition.
+    void computeQuotientDistribution(uint_fast64_t choice);
+
     // Retrieves whether the given block possibly needs refinement.
     bool possiblyNeedsRefinement(bisimulation::Block<BlockDataType> const& block) const;
 
@@ -1,6 +1,7 @@
 #include "storm/storage/dd/Add.h"
 
 #include <cstdint>
+#include <numeric>
 
 #include <boost/algorithm/string/join.hpp>
 
@@ -685,21 +686,17 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
     }
     std::sort(ddColumnVariableIndices.begin(), ddColumnVariableIndices.end());
 
-    // Prepare the vectors that represent the matrix.
-    std::vector<uint_fast64_t> rowIndications(rowOdd.getTotalOffset() + 1);
-    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(this->getNonZeroCount());
+    // Count the number of elements in the rows. This is done symbolically, so the entries can afterwards be written
+    // directly to their final position.
+    std::vector<uint_fast64_t> rowIndications = this->notZero().template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
+    rowIndications.emplace_back();
 
     // Create a trivial row grouping.
     std::vector<uint_fast64_t> trivialRowGroupIndices(rowIndications.size());
-    uint_fast64_t i = 0;
-    for (auto& entry : trivialRowGroupIndices) {
-        entry = i;
-        ++i;
-    }
+    std::iota(trivialRowGroupIndices.begin(), trivialRowGroupIndices.end(), 0);
 
-    // Count the number of elements in the rows.
-    rowIndications = this->notZero().template toAdd<uint_fast64_t>().sumAbstract(columnMetaVariables).toVector(rowOdd);
-    rowIndications.emplace_back();
+    // Prepare the vector that holds the entries of the matrix.
+    std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>> columnsAndValues(this->getNonZeroCount());
 
     // Now that we computed the number of entries in each row, compute the corresponding offsets in the entry vector.
     uint_fast64_t tmp = 0;
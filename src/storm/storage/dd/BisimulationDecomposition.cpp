@@ -11,6 +11,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 
 #include "storm/exceptions/InvalidOperationException.h"
@@ -78,6 +79,8 @@ void BisimulationDecomposition<DdType, ValueType, ExportValueType>::initialize()
     auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     verboseProgress = generalSettings.isVerboseSet();
     showProgressDelay = generalSettings.getShowProgressDelay();
+    showStatistics = storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet();
+    refiner->setCollectNodeCounts(showStatistics);
 
     auto start = std::chrono::high_resolution_clock::now();
     this->refineWrtRewardModels();
@@ -117,6 +120,9 @@ void BisimulationDecomposition<DdType, ValueType, ExportValueType>::compute(bisi
                    << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms (" << iterations
                    << " iterations, signature: " << std::chrono::duration_cast<std::chrono::milliseconds>(refiner->getTotalSignatureTime()).count()
                    << "ms, refinement: " << std::chrono::duration_cast<std::chrono::milliseconds>(refiner->getTotalRefinementTime()).count() << "ms).");
+    if (showStatistics) {
+        printRefinementStatistics();
+    }
 }
 
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
@@ -144,9 +150,25 @@ bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::compute(uint
         }
     }
 
+    if (!refined && showStatistics) {
+        printRefinementStatistics();
+    }
     return !refined;
 }
 
+template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
+void BisimulationDecomposition<DdType, ValueType, ExportValueType>::printRefinementStatistics() const {
+    STORM_PRINT_AND_LOG("Partition refinement statistics:\n");
+    STORM_PRINT_AND_LOG("refinement, signature time (ms), refinement time (ms), signature nodes, partition nodes, blocks\n");
+    for (auto const& statistics : refiner->getRefinementStatistics()) {
+        STORM_PRINT_AND_LOG(statistics.refinement << ", " << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.signatureTime).count() << ", "
+                                                  << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.refinementTime).count() << ", "
+                                                  << statistics.signatureNodeCount << ", " << statistics.partitionNodeCount << ", "
+                                                  << statistics.numberOfBlocks << '\n');
+    }
+    STORM_PRINT_AND_LOG('\n');
+}
+
 template<storm::dd::DdType DdType, typename ValueType, typename ExportValueType>
 bool BisimulationDecomposition<DdType, ValueType, ExportValueType>::getReachedFixedPoint() const {
     return this->refiner->getStatus() == Status::FixedPoint;
@@ -75,6 +75,7 @@ class BisimulationDecomposition {
    private:
     void initialize();
     void refineWrtRewardModels();
+    void printRefinementStatistics() const;
 
     // The model for which to compute the bisimulation decomposition.
     storm::models::symbolic::Model<DdType, ValueType> const& model;
@@ -93,6 +94,9 @@ class BisimulationDecomposition {
 
     // The delay between progress reports.
     uint64_t showProgressDelay;
+
+    // A flag indicating whether statistics of the refinement are collected and printed.
+    bool showStatistics;
 };
 
 }  // namespace dd
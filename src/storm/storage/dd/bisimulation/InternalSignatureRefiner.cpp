@@ -20,6 +20,8 @@ InternalSignatureRefinerOptions::InternalSignatureRefinerOptions(bool shiftState
 
     storm::settings::modules::BisimulationSettings::RefinementMode refinementMode = bisimulationSettings.getRefinementMode();
     this->createChangedStates = refinementMode == storm::settings::modules::BisimulationSettings::RefinementMode::ChangedStates;
+
+    this->initialTableCapacity = bisimulationSettings.getSylvanRefinerTableCapacity();
 }
 
 ReuseWrapper::ReuseWrapper() : ReuseWrapper(false) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "storm/storage/dd/DdType.h"
 
 namespace storm {
@@ -16,6 +18,9 @@ struct InternalSignatureRefinerOptions {
     bool shiftStateVariables;
     bool reuseBlockNumbers;
     bool createChangedStates;
+
+    // The initial number of entries of the block table (only used by the Sylvan refiner).
+    uint64_t initialTableCapacity;
 };
 
 class ReuseWrapper {
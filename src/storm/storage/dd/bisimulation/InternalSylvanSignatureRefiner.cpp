@@ -1,5 +1,7 @@
 #include "storm/storage/dd/bisimulation/InternalSylvanSignatureRefiner.h"
 
+#include <algorithm>
+
 #include "storm/storage/dd/DdManager.h"
 
 #include "storm/storage/dd/sylvan/InternalSylvanBdd.h"
@@ -33,7 +35,7 @@ InternalSylvanSignatureRefinerBase::InternalSylvanSignatureRefinerBase(storm::dd
       blockCube(manager.getMetaVariable(blockVariable).getCube()),
       nextFreeBlockIndex(0),
       numberOfRefinements(0),
-      currentCapacity(1ull << 20),
+      currentCapacity(options.initialTableCapacity),
       resizeFlag(0) {
     table.resize(3 * currentCapacity, NO_ELEMENT_MARKER);
 }
@@ -57,16 +59,6 @@ Partition<storm::dd::DdType::Sylvan, ValueType> InternalSignatureRefiner<storm::
     return oldPartition.replacePartition(newPartitionDds.first, nextFreeBlockIndex, nextFreeBlockIndex, newPartitionDds.second);
 }
 
-template<typename ValueType>
-void InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::clearCaches() {
-    for (auto& e : this->table) {
-        e = NO_ELEMENT_MARKER;
-    }
-    for (auto& e : this->signatures) {
-        e = 0ull;
-    }
-}
-
 template<typename ValueType>
 std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, boost::optional<storm::dd::Bdd<storm::dd::DdType::Sylvan>>>
 InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::refine(Partition<storm::dd::DdType::Sylvan, ValueType> const& oldPartition,
@@ -133,20 +125,25 @@ VOID_TASK_3(sylvan_rehash, size_t, first, size_t, count, InternalSylvanSignature
         return;
     }
 
-    while (count--) {
+    for (; count--; first++) {
         uint64_t* old_ptr = refiner->oldTable.data() + first * 3;
         uint64_t a = old_ptr[0];
         uint64_t b = old_ptr[1];
         uint64_t c = old_ptr[2];
 
+        /* skip empty buckets of the old table */
+        if (a == NO_ELEMENT_MARKER) {
+            continue;
+        }
+
         uint64_t hash = sylvan_hash(a, b);
         uint64_t pos = hash % refiner->currentCapacity;
 
         volatile uint64_t* ptr = 0;
         for (;;) {
             ptr = refiner->table.data() + pos * 3;
-            if (*ptr == 0) {
-                if (cas(ptr, 0, a)) {
+            if (*ptr == NO_ELEMENT_MARKER) {
+                if (cas(ptr, NO_ELEMENT_MARKER, a)) {
                     ptr[1] = b;
                     ptr[2] = c;
                     break;
@@ -156,9 +153,19 @@ VOID_TASK_3(sylvan_rehash, size_t, first, size_t, count, InternalSylvanSignature
             if (pos >= refiner->currentCapacity)
                 pos = 0;
         }
+    }
+}
 
-        first++;
+/* Fills the given array with the given value in parallel. */
+VOID_TASK_3(sylvan_fill, uint64_t*, data, size_t, count, uint64_t, value) {
+    if (count > 65536) {
+        SPAWN(sylvan_fill, data, count / 2, value);
+        CALL(sylvan_fill, data + count / 2, count - count / 2, value);
+        SYNC(sylvan_fill);
+        return;
     }
+
+    std::fill(data, data + count, value);
 }
 
 VOID_TASK_1(sylvan_grow_it, InternalSylvanSignatureRefinerBase*, refiner) {
@@ -365,6 +372,14 @@ TASK_5(BDD, sylvan_refine_partition, BDD, dd, BDD, previous_partition, BDD, nond
     return result;
 }
 
+template<typename ValueType>
+void InternalSignatureRefiner<storm::dd::DdType::Sylvan, ValueType>::clearCaches() {
+    // The table is large (and grows with the number of blocks), so clearing it sequentially after every refinement
+    // would limit the speedup obtained by the parallel refinement.
+    RUN(sylvan_fill, this->table.data(), this->table.size(), NO_ELEMENT_MARKER);
+    RUN(sylvan_fill, this->signatures.data(), this->signatures.size(), 0ull);
+}
+
 #pragma GCC diagnostic pop
 #pragma clang diagnostic pop
 
@@ -21,7 +21,8 @@ PartitionRefiner<DdType, ValueType>::PartitionRefiner(storm::models::symbolic::M
       signatureRefiner(model.getManager(), statePartition.getBlockVariable(), model.getRowAndNondeterminismVariables(), model.getColumnVariables(),
                        !model.isNondeterministicModel(), model.getNondeterminismVariables()),
       totalSignatureTime(0),
-      totalRefinementTime(0) {
+      totalRefinementTime(0),
+      collectNodeCounts(false) {
     // Intentionally left empty.
 }
 
@@ -53,6 +54,8 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
         std::chrono::milliseconds::rep signatureTime = 0;
         std::chrono::milliseconds::rep refinementTime = 0;
 
+        RefinementStatistics statistics{refinements, std::chrono::high_resolution_clock::duration(0), std::chrono::high_resolution_clock::duration(0), 0, 0, 0};
+
         bool refined = false;
         uint64_t index = 0;
         Partition<DdType, ValueType> newPartition;
@@ -62,15 +65,21 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
             auto signature = signatureIterator.next();
             auto signatureEnd = std::chrono::high_resolution_clock::now();
             totalSignatureTime += (signatureEnd - signatureStart);
+            statistics.signatureTime += (signatureEnd - signatureStart);
             STORM_LOG_TRACE("Signature " << refinements << "[" << index << "] DD has " << signature.getSignatureAdd().getNodeCount() << " nodes.");
+            if (collectNodeCounts) {
+                statistics.signatureNodeCount += signature.getSignatureAdd().getNodeCount();
+            }
 
             auto refinementStart = std::chrono::high_resolution_clock::now();
             newPartition = signatureRefiner.refine(oldPartition, signature);
             auto refinementEnd = std::chrono::high_resolution_clock::now();
             totalRefinementTime += (refinementEnd - refinementStart);
+            statistics.refinementTime += (refinementEnd - refinementStart);
 
             signatureTime += std::chrono::duration_cast<std::chrono::milliseconds>(signatureEnd - signatureStart).count();
-            refinementTime = std::chrono::duration_cast<std::chrono::milliseconds>(refinementEnd - refinementStart).count();
+            refinementTime += std::chrono::duration_cast<std::chrono::milliseconds>(refinementEnd - refinementStart).count();
+            ++index;
 
             // Potentially exit early in case we have refined the partition already.
             if (newPartition.getNumberOfBlocks() > oldPartition.getNumberOfBlocks()) {
@@ -81,6 +90,7 @@ Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine
         auto totalTimeInRefinement = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
         STORM_LOG_INFO("Refinement " << refinements << " produced " << newPartition.getNumberOfBlocks() << " blocks and was completed in "
                                      << totalTimeInRefinement << "ms (signature: " << signatureTime << "ms, refinement: " << refinementTime << "ms).");
+        recordStatistics(statistics, newPartition);
         ++refinements;
         return newPartition;
     } else {
@@ -92,12 +102,18 @@ template<storm::dd::DdType DdType, typename ValueType>
 Partition<DdType, ValueType> PartitionRefiner<DdType, ValueType>::internalRefine(Signature<DdType, ValueType> const& signature,
                                                                                  SignatureRefiner<DdType, ValueType>& signatureRefiner,
                                                                                  Partition<DdType, ValueType> const& oldPartition) {
+    RefinementStatistics statistics{refinements, std::chrono::high_resolution_clock::duration(0), std::chrono::high_resolution_clock::duration(0), 0, 0, 0};
     STORM_LOG_TRACE("Signature " << refinements << " DD has " << signature.getSignatureAdd().getNodeCount() << " nodes.");
+    if (collectNodeCounts) {
+        statistics.signatureNodeCount = signature.getSignatureAdd().getNodeCount();
+    }
     auto refinementStart = std::chrono::high_resolution_clock::now();
     auto newPartition = signatureRefiner.refine(oldPartition, signature);
     auto refinementEnd = std::chrono::high_resolution_clock::now();
     totalRefinementTime += (refinementEnd - refinementStart);
+    statistics.refinementTime = refinementEnd - refinementStart;
 
+    recordStatistics(statistics, newPartition);
     ++refinements;
     return newPartition;
 }
@@ -161,6 +177,25 @@ std::chrono::high_resolution_clock::duration PartitionRefiner<DdType, ValueType>
     return totalRefinementTime;
 }
 
+template<storm::dd::DdType DdType, typename ValueType>
+void PartitionRefiner<DdType, ValueType>::setCollectNodeCounts(bool value) {
+    collectNodeCounts = value;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+std::vector<RefinementStatistics> const& PartitionRefiner<DdType, ValueType>::getRefinementStatistics() const {
+    return refinementStatistics;
+}
+
+template<storm::dd::DdType DdType, typename ValueType>
+void PartitionRefiner<DdType, ValueType>::recordStatistics(RefinementStatistics statistics, Partition<DdType, ValueType> const& newPartition) {
+    statistics.numberOfBlocks = newPartition.getNumberOfBlocks();
+    if (collectNodeCounts) {
+        statistics.partitionNodeCount = newPartition.getNodeCount();
+    }
+    refinementStatistics.push_back(statistics);
+}
+
 template class PartitionRefiner<storm::dd::DdType::CUDD, double>;
 
 template class PartitionRefiner<storm::dd::DdType::Sylvan, double>;
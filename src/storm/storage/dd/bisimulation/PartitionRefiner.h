@@ -1,5 +1,8 @@
 #pragma once
 
+#include <chrono>
+#include <vector>
+
 #include "storm/storage/dd/bisimulation/Partition.h"
 #include "storm/storage/dd/bisimulation/Status.h"
 
@@ -17,6 +20,27 @@ class Model;
 namespace dd {
 namespace bisimulation {
 
+/*!
+ * Statistics of a single refinement, i.e. of a single call to the signature refiner (or several, if the signature is
+ * computed in multiple parts).
+ */
+struct RefinementStatistics {
+    // The index of the refinement.
+    uint64_t refinement;
+
+    std::chrono::high_resolution_clock::duration signatureTime;
+    std::chrono::high_resolution_clock::duration refinementTime;
+
+    // The number of nodes of all signature DDs of the refinement. Only available if node counts are collected.
+    uint64_t signatureNodeCount;
+
+    // The number of nodes of the resulting partition DD. Only available if node counts are collected.
+    uint64_t partitionNodeCount;
+
+    // The number of blocks of the resulting partition.
+    uint64_t numberOfBlocks;
+};
+
 template<storm::dd::DdType DdType, typename ValueType>
 class PartitionRefiner {
    public:
@@ -56,6 +80,17 @@ class PartitionRefiner {
     std::chrono::high_resolution_clock::duration getTotalSignatureTime() const;
     std::chrono::high_resolution_clock::duration getTotalRefinementTime() const;
 
+    /*!
+     * Sets whether the node counts of the signature and partition DDs are collected for every refinement. As counting
+     * the nodes requires a traversal of the DDs, this is disabled by default.
+     */
+    void setCollectNodeCounts(bool value);
+
+    /*!
+     * Retrieves the statistics of all refinements performed so far.
+     */
+    std::vector<RefinementStatistics> const& getRefinementStatistics() const;
+
    protected:
     Partition<DdType, ValueType> internalRefine(SignatureComputer<DdType, ValueType>& stateSignatureComputer,
                                                 SignatureRefiner<DdType, ValueType>& signatureRefiner, Partition<DdType, ValueType> const& oldPartition,
@@ -63,6 +98,11 @@ class PartitionRefiner {
     Partition<DdType, ValueType> internalRefine(Signature<DdType, ValueType> const& signature, SignatureRefiner<DdType, ValueType>& signatureRefiner,
                                                 Partition<DdType, ValueType> const& oldPartition);
 
+    /*!
+     * Completes the given statistics with the information about the new partition and stores them.
+     */
+    void recordStatistics(RefinementStatistics statistics, Partition<DdType, ValueType> const& newPartition);
+
     virtual bool refineWrtStateRewards(storm::dd::Add<DdType, ValueType> const& stateRewards);
     virtual bool refineWrtStateActionRewards(storm::dd::Add<DdType, ValueType> const& stateActionRewards);
 
@@ -84,6 +124,10 @@ class PartitionRefiner {
     // Time measurements.
     std::chrono::high_resolution_clock::duration totalSignatureTime;
     std::chrono::high_resolution_clock::duration totalRefinementTime;
+
+    // Per-refinement statistics.
+    bool collectNodeCounts;
+    std::vector<RefinementStatistics> refinementStatistics;
 };
 
 }  // namespace bisimulation
@@ -15,6 +15,13 @@
 
 #include "storm-config.h"
 
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#endif
+
+#include <type_traits>
+
 namespace storm {
 namespace dd {
 template<typename ValueType>
@@ -1231,9 +1238,27 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponents(std::vector<uint
                                                                 std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
                                                                 Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(mtbdd_regular(this->getSylvanMtbdd().GetMTBDD()), mtbdd_hascomp(this->getSylvanMtbdd().GetMTBDD()), rowGroupIndices,
-                                 rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0,
-                                 ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    MTBDD dd = this->getSylvanMtbdd().GetMTBDD();
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+
+#ifdef STORM_HAVE_INTELTBB
+    // Rows with different assignments to the topmost row variables are disjoint, so they can be translated independently.
+    // Within each such range of rows, the entries are still produced in the order of their columns. We restrict this to
+    // arithmetic types, as copying other values (e.g. rational functions) is not necessarily thread-safe.
+    if (std::is_arithmetic<ValueType>::value && columnsAndValues.size() >= 100000 && !ddRowVariableIndices.empty()) {
+        uint_fast64_t rowPrefixLength = std::min<uint_fast64_t>(ddRowVariableIndices.size(), 8);
+        tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, 1ull << rowPrefixLength), [&](tbb::blocked_range<uint_fast64_t> const& range) {
+            for (uint_fast64_t rowPrefix = range.begin(); rowPrefix < range.end(); ++rowPrefix) {
+                toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
+                                      maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues, rowPrefix, rowPrefixLength);
+            }
+        });
+        return;
+    }
+#endif
+
+    toMatrixComponentsRec(mtbdd_regular(dd), mtbdd_hascomp(dd), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0, maxLevel, 0, 0,
+                          ddRowVariableIndices, ddColumnVariableIndices, writeValues, 0, 0);
 }
 
 template<typename ValueType>
@@ -1243,7 +1268,8 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
                                                                    Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
                                                                    uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
                                                                    uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                   std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                   uint_fast64_t rowPrefix, uint_fast64_t rowPrefixLength) const {
     // For the empty DD, we do not need to add any entries.
     if (mtbdd_isleaf(dd) && mtbdd_iszero(dd)) {
         return;
@@ -1285,23 +1311,39 @@ void InternalAdd<DdType::Sylvan, ValueType>::toMatrixComponentsRec(MTBDD dd, boo
             }
         }
 
-        // Visit else-else.
-        toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-        // Visit else-then.
-        toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset,
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-        // Visit then-else.
-        toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues);
-        // Visit then-then.
-        toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
-                              rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
-                              currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+        // If the value of the current row variable is prescribed by the row prefix, only the corresponding rows are visited.
+        bool visitElseRows = true;
+        bool visitThenRows = true;
+        if (currentRowLevel < rowPrefixLength) {
+            bool rowBit = (rowPrefix >> (rowPrefixLength - currentRowLevel - 1)) & 1;
+            visitElseRows = !rowBit;
+            visitThenRows = rowBit;
+        }
+
+        if (visitElseRows) {
+            // Visit else-else.
+            toMatrixComponentsRec(mtbdd_regular(elseElse), mtbdd_hascomp(elseElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
+                                  rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                                  currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices, generateValues, rowPrefix,
+                                  rowPrefixLength);
+            // Visit else-then.
+            toMatrixComponentsRec(mtbdd_regular(elseThen), mtbdd_hascomp(elseThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
+                                  rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                                  currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices,
+                                  generateValues, rowPrefix, rowPrefixLength);
+        }
+        if (visitThenRows) {
+            // Visit then-else.
+            toMatrixComponentsRec(mtbdd_regular(thenElse), mtbdd_hascomp(thenElse) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
+                                  rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                                  currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                                  generateValues, rowPrefix, rowPrefixLength);
+            // Visit then-then.
+            toMatrixComponentsRec(mtbdd_regular(thenThen), mtbdd_hascomp(thenThen) ^ negated, rowGroupOffsets, rowIndications, columnsAndValues,
+                                  rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(), currentRowLevel + 1, currentColumnLevel + 1, maxLevel,
+                                  currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices,
+                                  ddColumnVariableIndices, generateValues, rowPrefix, rowPrefixLength);
+        }
     }
 }
 
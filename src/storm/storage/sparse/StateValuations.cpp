@@ -1,5 +1,8 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
+#include <limits>
+
 #include <boost/algorithm/string/join.hpp>
 
 #include "storm/adapters/JsonAdapter.h"
@@ -7,28 +10,171 @@
 #include "storm/adapters/RationalNumberForward.h"
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/SimpleValuation.h"
 
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
-#include "storm/utility/vector.h"
 
 namespace storm {
 namespace storage {
 namespace sparse {
 
-StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
-                                                std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues)
-    : booleanValues(std::move(booleanValues)),
-      integerValues(std::move(integerValues)),
-      rationalValues(std::move(rationalValues)),
-      observationLabelValues(std::move(observationLabelValues)) {
-    // Intentionally left empty
+namespace {
+// Retrieves the number of bits that are needed to represent the given (unsigned) value.
+uint64_t getNumberOfBits(uint64_t value) {
+    uint64_t result = 0;
+    while (value != 0) {
+        ++result;
+        value >>= 1;
+    }
+    return result;
+}
+
+// Retrieves the largest value that can be represented with the given number of bits.
+uint64_t getLargestValue(uint64_t bitWidth) {
+    return bitWidth == 64 ? std::numeric_limits<uint64_t>::max() : (1ull << bitWidth) - 1ull;
+}
+}  // namespace
+
+StateValuations::IntegerColumn::IntegerColumn() : numberOfValues(0), offset(0), bitWidth(0), minimum(0), maximum(0), initialized(false) {
+    // Intentionally left empty.
+}
+
+StateValuations::IntegerColumn::IntegerColumn(int64_t lowerBound, int64_t upperBound)
+    : numberOfValues(0),
+      offset(lowerBound),
+      bitWidth(getNumberOfBits(static_cast<uint64_t>(upperBound) - static_cast<uint64_t>(lowerBound))),
+      minimum(lowerBound),
+      maximum(upperBound),
+      initialized(true) {
+    STORM_LOG_ASSERT(lowerBound <= upperBound, "Invalid bounds [" << lowerBound << ", " << upperBound << "].");
+}
+
+int64_t StateValuations::IntegerColumn::get(uint64_t index) const {
+    STORM_LOG_ASSERT(index < numberOfValues, "Invalid index " << index << ".");
+    if (bitWidth == 0) {
+        return offset;
+    }
+    return static_cast<int64_t>(static_cast<uint64_t>(offset) + bits.getAsInt(index * bitWidth, bitWidth));
+}
+
+void StateValuations::IntegerColumn::set(uint64_t index, int64_t value) {
+    STORM_LOG_ASSERT(index < numberOfValues, "Invalid index " << index << ".");
+    if (!initialized) {
+        offset = value;
+        minimum = value;
+        maximum = value;
+        initialized = true;
+    }
+    if (value < offset || static_cast<uint64_t>(value) - static_cast<uint64_t>(offset) > getLargestValue(bitWidth)) {
+        // The value does not fit, so we at least double the range of the column. The additional space is put on the
+        // side of the new value, such that subsequent values in the same direction are likely to fit.
+        int64_t newMinimum = std::min(minimum, value);
+        int64_t newMaximum = std::max(maximum, value);
+        uint64_t newBitWidth =
+            std::max(getNumberOfBits(static_cast<uint64_t>(newMaximum) - static_cast<uint64_t>(newMinimum)), std::min<uint64_t>(bitWidth + 1, 64));
+        int64_t newOffset = newMinimum;
+        if (newBitWidth == 64) {
+            newOffset = std::numeric_limits<int64_t>::min();
+        } else if (value < offset) {
+            uint64_t distanceToLowest = static_cast<uint64_t>(newMaximum) - static_cast<uint64_t>(std::numeric_limits<int64_t>::min());
+            if (distanceToLowest <= getLargestValue(newBitWidth)) {
+                newOffset = std::numeric_limits<int64_t>::min();
+            } else {
+                newOffset = static_cast<int64_t>(static_cast<uint64_t>(newMaximum) - getLargestValue(newBitWidth));
+            }
+        }
+        repack(newOffset, newBitWidth);
+    }
+    minimum = std::min(minimum, value);
+    maximum = std::max(maximum, value);
+    if (bitWidth > 0) {
+        bits.setFromInt(index * bitWidth, bitWidth, static_cast<uint64_t>(value) - static_cast<uint64_t>(offset));
+    }
+}
+
+void StateValuations::IntegerColumn::resize(uint64_t newSize) {
+    numberOfValues = newSize;
+    bits.resize(numberOfValues * bitWidth);
+}
+
+void StateValuations::IntegerColumn::grow(uint64_t newSize) {
+    numberOfValues = newSize;
+    bits.grow(numberOfValues * bitWidth);
+}
+
+uint64_t StateValuations::IntegerColumn::size() const {
+    return numberOfValues;
+}
+
+std::size_t StateValuations::IntegerColumn::getSizeInBytes() const {
+    return sizeof(IntegerColumn) + bits.getSizeInBytes();
+}
+
+void StateValuations::IntegerColumn::repack(int64_t newOffset, uint64_t newBitWidth) {
+    STORM_LOG_TRACE("Repacking column from " << bitWidth << " to " << newBitWidth << " bits.");
+    storm::storage::BitVector newBits(numberOfValues * newBitWidth);
+    if (newBitWidth > 0) {
+        for (uint64_t index = 0; index < numberOfValues; ++index) {
+            // Entries that have not been set yet may lie outside of the values that need to be represented.
+            int64_t value = std::min(std::max(get(index), minimum), maximum);
+            newBits.setFromInt(index * newBitWidth, newBitWidth, static_cast<uint64_t>(value) - static_cast<uint64_t>(newOffset));
+        }
+    }
+    bits = std::move(newBits);
+    offset = newOffset;
+    bitWidth = newBitWidth;
+}
+
+typename StateValuations::IntegerColumn StateValuations::IntegerColumn::select(std::vector<uint64_t> const& indices) const {
+    IntegerColumn result;
+    result.bits = storm::storage::BitVector(indices.size() * bitWidth);
+    result.numberOfValues = indices.size();
+    result.offset = offset;
+    result.bitWidth = bitWidth;
+    result.minimum = minimum;
+    result.maximum = maximum;
+    result.initialized = initialized;
+    if (bitWidth > 0) {
+        for (uint64_t newIndex = 0; newIndex < indices.size(); ++newIndex) {
+            if (indices[newIndex] < numberOfValues) {
+                result.bits.setFromInt(newIndex * bitWidth, bitWidth, bits.getAsInt(indices[newIndex] * bitWidth, bitWidth));
+            }
+        }
+    }
+    return result;
+}
+
+storm::storage::BitVector StateValuations::IntegerColumn::getIndicesInInterval(int64_t lowerBound, int64_t upperBound) const {
+    // Translate the interval to the stored (relative) values, which allows to compare them without unpacking.
+    uint64_t largestValue = getLargestValue(bitWidth);
+    if (lowerBound > upperBound || upperBound < offset || static_cast<uint64_t>(std::max(lowerBound, offset)) - static_cast<uint64_t>(offset) > largestValue) {
+        return storm::storage::BitVector(numberOfValues, false);
+    }
+    uint64_t relativeLowerBound = static_cast<uint64_t>(std::max(lowerBound, offset)) - static_cast<uint64_t>(offset);
+    uint64_t relativeUpperBound = std::min(static_cast<uint64_t>(upperBound) - static_cast<uint64_t>(offset), largestValue);
+    if (relativeLowerBound == 0 && relativeUpperBound == largestValue) {
+        return storm::storage::BitVector(numberOfValues, true);
+    }
+
+    storm::storage::BitVector result(numberOfValues, false);
+    uint64_t bitIndex = 0;
+    for (uint64_t index = 0; index < numberOfValues; ++index, bitIndex += bitWidth) {
+        uint64_t relativeValue = bits.getAsInt(bitIndex, bitWidth);
+        if (relativeLowerBound <= relativeValue && relativeValue <= relativeUpperBound) {
+            result.set(index);
+        }
+    }
+    return result;
 }
 
-typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-    STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-    STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-    return valuations[stateIndex];
+void StateValuations::assertValidState(storm::storage::sparse::state_type const& stateIndex) const {
+    STORM_LOG_ASSERT(stateIndex < getNumberOfStates(), "Invalid state index.");
+    STORM_LOG_ASSERT(statesWithValuation.get(stateIndex), "No valuation given for state " << stateIndex << ".");
 }
 
 StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -36,14 +182,16 @@ StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm:
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                                                         typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                         typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation)
+                                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd,
+                                                        StateValuations const* valuations, storm::storage::sparse::state_type state)
     : variableIt(variableIt),
       labelIt(labelIt),
       variableBegin(variableBegin),
       variableEnd(variableEnd),
       labelBegin(labelBegin),
       labelEnd(labelEnd),
-      valuation(valuation) {
+      valuations(valuations),
+      state(state) {
     // Intentionally left empty.
 }
 
@@ -83,28 +231,28 @@ std::string const& StateValuations::StateValueIterator::getName() const {
 
 bool StateValuations::StateValueIterator::getBooleanValue() const {
     STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-    return valuation->booleanValues[variableIt->second];
+    return valuations->booleanColumns[variableIt->second].get(state);
 }
 
 int64_t StateValuations::StateValueIterator::getIntegerValue() const {
     STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-    return valuation->integerValues[variableIt->second];
+    return valuations->integerColumns[variableIt->second].get(state);
 }
 
 int64_t StateValuations::StateValueIterator::getLabelValue() const {
     STORM_LOG_ASSERT(isLabelAssignment(), "Not a label assignment");
-    STORM_LOG_ASSERT(labelIt->second < valuation->observationLabelValues.size(),
-                     "Label index " << labelIt->second << " larger than number of labels " << valuation->observationLabelValues.size());
-    return valuation->observationLabelValues[labelIt->second];
+    STORM_LOG_ASSERT(labelIt->second < valuations->observationLabelColumns.size(),
+                     "Label index " << labelIt->second << " larger than number of labels " << valuations->observationLabelColumns.size());
+    return valuations->observationLabelColumns[labelIt->second].get(state);
 }
 
 storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
     STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-    return valuation->rationalValues[variableIt->second];
+    return valuations->rationalColumns[variableIt->second][state];
 }
 
 bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-    STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+    STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
     return variableIt == other.variableIt && labelIt == other.labelIt;
 }
 bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
@@ -131,42 +279,43 @@ typename StateValuations::StateValueIterator& StateValuations::StateValueIterato
 }
 
 StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap,
-                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation)
-    : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
+                                                                  std::map<std::string, uint64_t> const& labelMap, StateValuations const* valuations,
+                                                                  storm::storage::sparse::state_type state)
+    : variableMap(variableMap), labelMap(labelMap), valuations(valuations), state(state) {
     // Intentionally left empty.
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations,
+                              state);
 }
 
 StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+    return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations,
+                              state);
 }
 
 bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    assertValidState(stateIndex);
     STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-    return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+    return booleanColumns[variableToIndexMap.at(booleanVariable)].get(stateIndex);
 }
 
-int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex,
-                                                storm::expressions::Variable const& integerVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+    assertValidState(stateIndex);
     STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-    return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+    return integerColumns[variableToIndexMap.at(integerVariable)].get(stateIndex);
 }
 
 storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                                storm::expressions::Variable const& rationalVariable) const {
-    auto const& valuation = getValuation(stateIndex);
+    assertValidState(stateIndex);
     STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-    return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+    return rationalColumns[variableToIndexMap.at(rationalVariable)][stateIndex];
 }
 
 bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-    auto const& valuation = valuations[stateIndex];  // Do not use getValuations, as that is only valid after adding stuff.
-    return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
+    return stateIndex >= numberOfStates || !statesWithValuation.get(stateIndex) || (variableToIndexMap.empty() && observationLabels.empty());
 }
 
 std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty,
@@ -257,43 +406,6 @@ storm::json<JsonRationalType> StateValuations::toJson(storm::storage::sparse::st
     return result;
 }
 
-bool StateValuations::assertValuation(StateValuation const& valuation) const {
-    storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-    storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-    storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-    for (auto const& varIndex : variableToIndexMap) {
-        storm::storage::BitVector* bv;
-        if (varIndex.first.hasBooleanType()) {
-            bv = &foundBooleanValues;
-        } else if (varIndex.first.hasIntegerType()) {
-            bv = &foundIntegerValues;
-        } else if (varIndex.first.hasRationalType()) {
-            bv = &foundRationalValues;
-        } else {
-            STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-        }
-        if (varIndex.second < bv->size()) {
-            if (bv->get(varIndex.second)) {
-                STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                return false;
-            }
-            bv->set(varIndex.second, true);
-        } else {
-            STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-            return false;
-        }
-    }
-    if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-        STORM_LOG_ERROR("Valuation has too many entries.");
-    }
-    return true;
-}
-
-StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations)
-    : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-    // Intentionally left empty
-}
-
 std::string StateValuations::getStateInfo(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
     return this->toString(state);
@@ -301,40 +413,208 @@ std::string StateValuations::getStateInfo(state_type const& state) const {
 
 typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
     STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-    return StateValueIteratorRange({variableToIndexMap, observationLabels, &(valuations[state])});
+    return StateValueIteratorRange({variableToIndexMap, observationLabels, this, state});
 }
 
 uint_fast64_t StateValuations::getNumberOfStates() const {
-    return valuations.size();
+    return numberOfStates;
+}
+
+std::size_t StateValuations::getSizeInBytes() const {
+    std::size_t result = sizeof(StateValuations) + statesWithValuation.getSizeInBytes();
+    for (auto const& column : booleanColumns) {
+        result += column.getSizeInBytes();
+    }
+    for (auto const& column : integerColumns) {
+        result += column.getSizeInBytes();
+    }
+    for (auto const& column : rationalColumns) {
+        result += column.capacity() * sizeof(storm::RationalNumber);
+    }
+    for (auto const& column : observationLabelColumns) {
+        result += column.getSizeInBytes();
+    }
+    return result;
+}
+
+storm::storage::BitVector StateValuations::getStates(storm::expressions::Expression const& condition) const {
+    STORM_LOG_THROW(condition.hasBooleanType(), storm::exceptions::InvalidArgumentException, "Condition " << condition << " is not a boolean expression.");
+    for (auto const& variable : condition.getVariables()) {
+        STORM_LOG_THROW(variableToIndexMap.count(variable) > 0, storm::exceptions::InvalidArgumentException,
+                        "Variable " << variable.getName() << " is not part of the state valuations.");
+    }
+    return getStatesRec(condition) & statesWithValuation;
+}
+
+storm::storage::BitVector StateValuations::getStatesRec(storm::expressions::Expression const& condition) const {
+    if (!condition.containsVariables()) {
+        return storm::storage::BitVector(numberOfStates, condition.evaluateAsBool());
+    }
+    if (condition.isVariable()) {
+        return booleanColumns[variableToIndexMap.at(condition.getBaseExpression().asVariableExpression().getVariable())];
+    }
+    if (condition.isFunctionApplication()) {
+        switch (condition.getOperator()) {
+            case storm::expressions::OperatorType::And:
+                return getStatesRec(condition.getOperand(0)) & getStatesRec(condition.getOperand(1));
+            case storm::expressions::OperatorType::Or:
+                return getStatesRec(condition.getOperand(0)) | getStatesRec(condition.getOperand(1));
+            case storm::expressions::OperatorType::Xor:
+                return getStatesRec(condition.getOperand(0)) ^ getStatesRec(condition.getOperand(1));
+            case storm::expressions::OperatorType::Implies:
+                return ~getStatesRec(condition.getOperand(0)) | getStatesRec(condition.getOperand(1));
+            case storm::expressions::OperatorType::Iff:
+                return ~(getStatesRec(condition.getOperand(0)) ^ getStatesRec(condition.getOperand(1)));
+            case storm::expressions::OperatorType::Not:
+                return ~getStatesRec(condition.getOperand(0));
+            case storm::expressions::OperatorType::Equal:
+            case storm::expressions::OperatorType::NotEqual:
+            case storm::expressions::OperatorType::Less:
+            case storm::expressions::OperatorType::LessOrEqual:
+            case storm::expressions::OperatorType::Greater:
+            case storm::expressions::OperatorType::GreaterOrEqual: {
+                auto result = getStatesForComparison(condition);
+                if (result) {
+                    return std::move(result.get());
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return getStatesStateByState(condition);
+}
+
+boost::optional<storm::storage::BitVector> StateValuations::getStatesForComparison(storm::expressions::Expression const& condition) const {
+    // We only deal with comparisons of an integer variable with an integer constant.
+    storm::expressions::Expression variableOperand = condition.getOperand(0);
+    storm::expressions::Expression constantOperand = condition.getOperand(1);
+    storm::expressions::OperatorType relation = condition.getOperator();
+    if (!variableOperand.isVariable()) {
+        std::swap(variableOperand, constantOperand);
+        // Mirror the relation as the operands are swapped.
+        switch (relation) {
+            case storm::expressions::OperatorType::Less:
+                relation = storm::expressions::OperatorType::Greater;
+                break;
+            case storm::expressions::OperatorType::LessOrEqual:
+                relation = storm::expressions::OperatorType::GreaterOrEqual;
+                break;
+            case storm::expressions::OperatorType::Greater:
+                relation = storm::expressions::OperatorType::Less;
+                break;
+            case storm::expressions::OperatorType::GreaterOrEqual:
+                relation = storm::expressions::OperatorType::LessOrEqual;
+                break;
+            default:
+                break;
+        }
+    }
+    if (!variableOperand.isVariable() || !variableOperand.hasIntegerType() || constantOperand.containsVariables() || !constantOperand.hasIntegerType()) {
+        return boost::none;
+    }
+
+    IntegerColumn const& column = integerColumns[variableToIndexMap.at(variableOperand.getBaseExpression().asVariableExpression().getVariable())];
+    int64_t value = constantOperand.evaluateAsInt();
+    int64_t const lowest = std::numeric_limits<int64_t>::min();
+    int64_t const highest = std::numeric_limits<int64_t>::max();
+    switch (relation) {
+        case storm::expressions::OperatorType::Equal:
+            return column.getIndicesInInterval(value, value);
+        case storm::expressions::OperatorType::NotEqual:
+            return ~column.getIndicesInInterval(value, value);
+        case storm::expressions::OperatorType::Less:
+            return value == lowest ? storm::storage::BitVector(numberOfStates, false) : column.getIndicesInInterval(lowest, value - 1);
+        case storm::expressions::OperatorType::LessOrEqual:
+            return column.getIndicesInInterval(lowest, value);
+        case storm::expressions::OperatorType::Greater:
+            return value == highest ? storm::storage::BitVector(numberOfStates, false) : column.getIndicesInInterval(value + 1, highest);
+        case storm::expressions::OperatorType::GreaterOrEqual:
+            return column.getIndicesInInterval(value, highest);
+        default:
+            return boost::none;
+    }
+}
+
+storm::storage::BitVector StateValuations::getStatesStateByState(storm::expressions::Expression const& condition) const {
+    storm::expressions::SimpleValuation valuation(condition.getManager().getSharedPointer());
+    std::set<storm::expressions::Variable> variables = condition.getVariables();
+    storm::storage::BitVector result(numberOfStates, false);
+    for (auto state : statesWithValuation) {
+        for (auto const& variable : variables) {
+            uint64_t index = variableToIndexMap.at(variable);
+            if (variable.hasBooleanType()) {
+                valuation.setBooleanValue(variable, booleanColumns[index].get(state));
+            } else if (variable.hasIntegerType()) {
+                valuation.setIntegerValue(variable, integerColumns[index].get(state));
+            } else {
+                valuation.setRationalValue(variable, storm::utility::convertNumber<double>(rationalColumns[index][state]));
+            }
+        }
+        if (condition.evaluateAsBool(&valuation)) {
+            result.set(state);
+        }
+    }
+    return result;
 }
 
 std::size_t StateValuations::hash() const {
     return 0;
 }
 
-StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-    return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+StateValuations StateValuations::select(std::vector<storm::storage::sparse::state_type> const& oldStates) const {
+    StateValuations result;
+    result.variableToIndexMap = variableToIndexMap;
+    result.observationLabels = observationLabels;
+    result.numberOfStates = oldStates.size();
+    result.statesWithValuation = storm::storage::BitVector(oldStates.size(), false);
+    for (uint64_t newState = 0; newState < oldStates.size(); ++newState) {
+        if (oldStates[newState] < numberOfStates && statesWithValuation.get(oldStates[newState])) {
+            result.statesWithValuation.set(newState);
+        }
+    }
+
+    result.booleanColumns.reserve(booleanColumns.size());
+    for (auto const& column : booleanColumns) {
+        result.booleanColumns.emplace_back(oldStates.size(), false);
+        for (auto newState : result.statesWithValuation) {
+            result.booleanColumns.back().set(newState, column.get(oldStates[newState]));
+        }
+    }
+    result.integerColumns.reserve(integerColumns.size());
+    for (auto const& column : integerColumns) {
+        result.integerColumns.push_back(column.select(oldStates));
+    }
+    result.rationalColumns.reserve(rationalColumns.size());
+    for (auto const& column : rationalColumns) {
+        result.rationalColumns.emplace_back(oldStates.size(), storm::utility::zero<storm::RationalNumber>());
+        for (auto newState : result.statesWithValuation) {
+            result.rationalColumns.back()[newState] = column[oldStates[newState]];
+        }
+    }
+    result.observationLabelColumns.reserve(observationLabelColumns.size());
+    for (auto const& column : observationLabelColumns) {
+        result.observationLabelColumns.push_back(column.select(oldStates));
+    }
+    return result;
 }
 
-StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-    std::vector<StateValuation> selectedValuations;
-    selectedValuations.reserve(selectedStates.size());
+StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
+    std::vector<storm::storage::sparse::state_type> oldStates;
+    oldStates.reserve(selectedStates.getNumberOfSetBits());
     for (auto const& selectedState : selectedStates) {
-        if (selectedState < valuations.size()) {
-            selectedValuations.push_back(valuations[selectedState]);
-        } else {
-            selectedValuations.emplace_back();
-        }
+        oldStates.push_back(selectedState);
     }
-    return StateValuations(variableToIndexMap, std::move(selectedValuations));
+    return select(oldStates);
+}
+
+StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
+    return select(selectedStates);
 }
 
 StateValuations StateValuations::blowup(const std::vector<uint64_t>& mapNewToOld) const {
-    std::vector<StateValuation> newValuations;
-    for (auto const& oldState : mapNewToOld) {
-        newValuations.push_back(valuations[oldState]);
-    }
-    return StateValuations(variableToIndexMap, std::move(newValuations));
+    return select(mapNewToOld);
 }
 
 StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -342,35 +622,75 @@ StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVa
 }
 
 void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-    STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+    STORM_LOG_ASSERT(currentStateValuations.getNumberOfStates() == 0, "Tried to add a variable, although a state has already been added before.");
     STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
     if (variable.hasBooleanType()) {
         currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
+        currentStateValuations.booleanColumns.emplace_back();
     }
     if (variable.hasIntegerType()) {
         currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+        currentStateValuations.integerColumns.emplace_back();
     }
     if (variable.hasRationalType()) {
         currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+        currentStateValuations.rationalColumns.emplace_back();
     }
 }
 
+void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound) {
+    STORM_LOG_ASSERT(variable.hasIntegerType(), "Bounds can only be given for integer variables.");
+    addVariable(variable);
+    currentStateValuations.integerColumns.back() = StateValuations::IntegerColumn(lowerBound, upperBound);
+}
+
 void StateValuationsBuilder::addObservationLabel(const std::string& label) {
+    STORM_LOG_ASSERT(currentStateValuations.getNumberOfStates() == 0, "Tried to add an observation label, although a state has already been added before.");
     currentStateValuations.observationLabels[label] = labelCount++;
+    currentStateValuations.observationLabelColumns.emplace_back();
+}
+
+void StateValuationsBuilder::grow(uint64_t numberOfStates) {
+    // As the final number of states is not known in advance, the columns are enlarged geometrically and only trimmed
+    // to their actual size when building the state valuations.
+    currentStateValuations.numberOfStates = numberOfStates;
+    currentStateValuations.statesWithValuation.grow(numberOfStates);
+    for (auto& column : currentStateValuations.booleanColumns) {
+        column.grow(numberOfStates);
+    }
+    for (auto& column : currentStateValuations.integerColumns) {
+        column.grow(numberOfStates);
+    }
+    for (auto& column : currentStateValuations.rationalColumns) {
+        column.resize(numberOfStates);
+    }
+    for (auto& column : currentStateValuations.observationLabelColumns) {
+        column.grow(numberOfStates);
+    }
 }
 
 void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues,
                                       std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) {
-    if (state > currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.resize(state);
-    }
-    if (state == currentStateValuations.valuations.size()) {
-        currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues),
-                                                       std::move(observationLabelValues));
+    STORM_LOG_ASSERT(booleanValues.size() == booleanVarCount && integerValues.size() == integerVarCount && rationalValues.size() == rationalVarCount &&
+                         observationLabelValues.size() == labelCount,
+                     "Valuation does not provide exactly one value for each variable and observation label.");
+    if (state >= currentStateValuations.getNumberOfStates()) {
+        grow(state + 1);
     } else {
         STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-        currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues),
-                                                                                            std::move(rationalValues), std::move(observationLabelValues));
+    }
+    currentStateValuations.statesWithValuation.set(state);
+    for (uint64_t index = 0; index < booleanValues.size(); ++index) {
+        currentStateValuations.booleanColumns[index].set(state, booleanValues[index]);
+    }
+    for (uint64_t index = 0; index < integerValues.size(); ++index) {
+        currentStateValuations.integerColumns[index].set(state, integerValues[index]);
+    }
+    for (uint64_t index = 0; index < rationalValues.size(); ++index) {
+        currentStateValuations.rationalColumns[index][state] = std::move(rationalValues[index]);
+    }
+    for (uint64_t index = 0; index < observationLabelValues.size(); ++index) {
+        currentStateValuations.observationLabelColumns[index].set(state, observationLabelValues[index]);
     }
 }
 
@@ -386,12 +706,29 @@ uint64_t StateValuationsBuilder::getLabelCount() const {
     return labelCount;
 }
 
-StateValuations StateValuationsBuilder::build(std::size_t totalStateCount) {
-    return std::move(currentStateValuations);
+StateValuations StateValuationsBuilder::build(std::size_t) {
+    uint64_t numberOfStates = currentStateValuations.getNumberOfStates();
+    currentStateValuations.statesWithValuation.resize(numberOfStates);
+    for (auto& column : currentStateValuations.booleanColumns) {
+        column.resize(numberOfStates);
+    }
+    for (auto& column : currentStateValuations.integerColumns) {
+        column.resize(numberOfStates);
+    }
+    for (auto& column : currentStateValuations.rationalColumns) {
+        column.shrink_to_fit();
+    }
+    for (auto& column : currentStateValuations.observationLabelColumns) {
+        column.resize(numberOfStates);
+    }
+
+    StateValuations result = std::move(currentStateValuations);
+    currentStateValuations = StateValuations();
     booleanVarCount = 0;
     integerVarCount = 0;
     rationalVarCount = 0;
     labelCount = 0;
+    return result;
 }
 
 template storm::json<double> StateValuations::toJson<double>(storm::storage::sparse::state_type const&,
@@ -12,30 +12,22 @@
 #include "storm/storage/sparse/StateType.h"
 
 namespace storm {
+namespace expressions {
+class Expression;
+}
+
 namespace storage {
 namespace sparse {
 
 class StateValuationsBuilder;
 
 // A structure holding information about the reachable state space that can be retrieved from the outside.
+// The values are stored column-wise, i.e., there is one column per variable that holds the values of all states.
+// Boolean and integer columns are bit-packed, only the values of rational variables are stored as individual numbers.
 class StateValuations : public storm::models::sparse::StateAnnotation {
    public:
     friend class StateValuationsBuilder;
 
-    class StateValuation {
-       public:
-        friend class StateValuations;
-        StateValuation() = default;
-        StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues,
-                       std::vector<int64_t>&& observationLabelValues = {});
-
-       private:
-        std::vector<bool> booleanValues;
-        std::vector<int64_t> integerValues;
-        std::vector<storm::RationalNumber> rationalValues;
-        std::vector<int64_t> observationLabelValues;
-    };
-
     class StateValueIterator {
        public:
         StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -43,7 +35,8 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableBegin,
                            typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                            typename std::map<std::string, uint64_t>::const_iterator labelBegin,
-                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuation const* valuation);
+                           typename std::map<std::string, uint64_t>::const_iterator labelEnd, StateValuations const* valuations,
+                           storm::storage::sparse::state_type state);
         bool operator==(StateValueIterator const& other);
         bool operator!=(StateValueIterator const& other);
         StateValueIterator& operator++();
@@ -73,20 +66,22 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
         typename std::map<std::string, uint64_t>::const_iterator labelBegin;
         typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-        StateValuation const* const valuation;
+        StateValuations const* const valuations;
+        storm::storage::sparse::state_type const state;
     };
 
     class StateValueIteratorRange {
        public:
         StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap,
-                                StateValuation const* valuation);
+                                StateValuations const* valuations, storm::storage::sparse::state_type state);
         StateValueIterator begin() const;
         StateValueIterator end() const;
 
        private:
         std::map<storm::expressions::Variable, uint64_t> const& variableMap;
         std::map<std::string, uint64_t> const& labelMap;
-        StateValuation const* const valuation;
+        StateValuations const* const valuations;
+        storm::storage::sparse::state_type const state;
     };
 
     StateValuations() = default;
@@ -95,7 +90,7 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
 
     bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-    int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+    int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
     storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex,
                                                   storm::expressions::Variable const& rationalVariable) const;
     /// Returns true, if this valuation does not contain any value.
@@ -119,9 +114,22 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     storm::json<JsonRationalType> toJson(storm::storage::sparse::state_type const& stateIndex,
                                          boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables = boost::none) const;
 
+    /*!
+     * Retrieves the states whose valuation satisfies the given condition.
+     * Boolean connectives, boolean variables and comparisons of an integer variable with a constant are evaluated on
+     * the columns directly. All other subexpressions are evaluated state by state.
+     *
+     * @param condition A boolean expression over the variables of this object.
+     * @return The states satisfying the condition. States without a valuation are never contained.
+     */
+    storm::storage::BitVector getStates(storm::expressions::Expression const& condition) const;
+
     // Returns the (current) number of states that this object describes.
     uint_fast64_t getNumberOfStates() const;
 
+    // Returns the (approximate) number of bytes occupied by the stored values.
+    std::size_t getSizeInBytes() const;
+
     /*
      * Derive new state valuations from this by selecting the given states.
      */
@@ -138,14 +146,65 @@ class StateValuations : public storm::models::sparse::StateAnnotation {
     virtual std::size_t hash() const;
 
    private:
-    StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-    bool assertValuation(StateValuation const& valuation) const;
-    StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+    /*!
+     * A column that stores one integer value per state. The values are stored relative to an offset with as many bits
+     * as the range of the column requires. If a value does not fit, the column is repacked with a larger range.
+     */
+    class IntegerColumn {
+       public:
+        // Creates a column whose range is determined by the first value that is set.
+        IntegerColumn();
+
+        // Creates a column whose range initially covers the given bounds.
+        IntegerColumn(int64_t lowerBound, int64_t upperBound);
+
+        int64_t get(uint64_t index) const;
+        void set(uint64_t index, int64_t value);
+        void resize(uint64_t newSize);
+        // Like resize, but enlarges the underlying storage geometrically.
+        void grow(uint64_t newSize);
+        uint64_t size() const;
+        std::size_t getSizeInBytes() const;
+
+        /*!
+         * Creates a column with the same range that holds the values at the given indices. Invalid indices yield the
+         * value at the lower end of the range.
+         */
+        IntegerColumn select(std::vector<uint64_t> const& indices) const;
+
+        // Retrieves the indices whose value lies within the given (closed) interval.
+        storm::storage::BitVector getIndicesInInterval(int64_t lowerBound, int64_t upperBound) const;
+
+       private:
+        void repack(int64_t newOffset, uint64_t newBitWidth);
+
+        storm::storage::BitVector bits;
+        uint64_t numberOfValues;
+        int64_t offset;
+        uint64_t bitWidth;
+        // The smallest and largest value that the column needs to represent.
+        int64_t minimum;
+        int64_t maximum;
+        bool initialized;
+    };
+
+    // Derives new state valuations in which the i-th state has the valuation of the i-th given (old) state.
+    StateValuations select(std::vector<storm::storage::sparse::state_type> const& oldStates) const;
+    void assertValidState(storm::storage::sparse::state_type const& stateIndex) const;
+    storm::storage::BitVector getStatesRec(storm::expressions::Expression const& condition) const;
+    boost::optional<storm::storage::BitVector> getStatesForComparison(storm::expressions::Expression const& condition) const;
+    storm::storage::BitVector getStatesStateByState(storm::expressions::Expression const& condition) const;
 
     std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
     std::map<std::string, uint64_t> observationLabels;
-    // A mapping from state indices to their variable valuations.
-    std::vector<StateValuation> valuations;
+    uint64_t numberOfStates = 0;
+    // The states for which a valuation has been given.
+    storm::storage::BitVector statesWithValuation;
+    // The columns of the variables and observation labels. The index of a column is given by the maps above.
+    std::vector<storm::storage::BitVector> booleanColumns;
+    std::vector<IntegerColumn> integerColumns;
+    std::vector<std::vector<storm::RationalNumber>> rationalColumns;
+    std::vector<IntegerColumn> observationLabelColumns;
 };
 
 class StateValuationsBuilder {
@@ -157,6 +216,12 @@ class StateValuationsBuilder {
      */
     void addVariable(storm::expressions::Variable const& variable);
 
+    /*! Adds a new integer variable whose values are expected to lie within the given bounds.
+     * The values of the variable are then stored with the number of bits that are needed to represent the bounds.
+     * All variables need to be added before adding new states.
+     */
+    void addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound);
+
     void addObservationLabel(std::string const& label);
 
     /*!
@@ -178,6 +243,8 @@ class StateValuationsBuilder {
     uint64_t getLabelCount() const;
 
    private:
+    void grow(uint64_t numberOfStates);
+
     StateValuations currentStateValuations;
     uint64_t booleanVarCount;
     uint64_t integerVarCount;
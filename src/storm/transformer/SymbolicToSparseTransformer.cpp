@@ -55,7 +55,8 @@ std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmc
             transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(this->odd, this->odd);
         }
         rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
+                             storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards),
+                                                                                   std::move(transitionRewards)));
     }
     storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
 
@@ -74,7 +75,7 @@ std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> SymbolicDtmcToSparseDtmc
             labelling.addLabel(expressionLabel.first, symbolicDtmc.getStates(expressionLabel.second).toVector(this->odd));
         }
     }
-    return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(transitionMatrix, labelling, rewardModels);
+    return std::make_shared<storm::models::sparse::Dtmc<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -123,7 +124,8 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
         STORM_LOG_THROW(!rewardModelNameAndModel.second.hasTransitionRewards(), storm::exceptions::NotImplementedException,
                         "Translation of symbolic to explicit transition rewards is not yet supported.");
         rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
+                             storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards),
+                                                                                   std::move(transitionRewards)));
     }
 
     storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
@@ -144,7 +146,7 @@ std::shared_ptr<storm::models::sparse::Mdp<ValueType>> SymbolicMdpToSparseMdpTra
         }
     }
 
-    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(transitionMatrix, labelling, rewardModels);
+    return std::make_shared<storm::models::sparse::Mdp<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -167,7 +169,8 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmc
             transitionRewards = rewardModelNameAndModel.second.getTransitionRewardMatrix().toMatrix(odd, odd);
         }
         rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
+                             storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards),
+                                                                                   std::move(transitionRewards)));
     }
     storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
 
@@ -187,7 +190,7 @@ std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> SymbolicCtmcToSparseCtmc
         }
     }
 
-    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(transitionMatrix, labelling, rewardModels);
+    return std::make_shared<storm::models::sparse::Ctmc<ValueType>>(std::move(transitionMatrix), std::move(labelling), std::move(rewardModels));
 }
 
 template<storm::dd::DdType Type, typename ValueType>
@@ -230,7 +233,8 @@ std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> SymbolicMaToS
         STORM_LOG_THROW(!rewardModelNameAndModel.second.hasTransitionRewards(), storm::exceptions::NotImplementedException,
                         "Translation of symbolic to explicit transition rewards is not yet supported.");
         rewardModels.emplace(rewardModelNameAndModel.first,
-                             storm::models::sparse::StandardRewardModel<ValueType>(stateRewards, stateActionRewards, transitionRewards));
+                             storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards), std::move(stateActionRewards),
+                                                                                   std::move(transitionRewards)));
     }
 
     storm::models::sparse::StateLabeling labelling(transitionMatrix.getRowGroupCount());
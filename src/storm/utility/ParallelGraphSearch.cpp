@@ -0,0 +1,297 @@
+#include "storm/utility/ParallelGraphSearch.h"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+
+#include "storm-config.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/macros.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
+#endif
+
+namespace storm {
+namespace utility {
+namespace graph {
+
+// A level is processed bottom-up if the number of backward transitions of the frontier times this factor exceeds the
+// number of (forward) transitions of the states that were not reached yet. Bottom-up steps can stop scanning the
+// transitions of a state as soon as the condition is decided, which the factor accounts for.
+uint64_t const bottomUpFactor = 14;
+
+// The number of buckets of 64 states that a thread processes at once.
+uint64_t const bucketsPerTask = 16;
+
+// The number of frontier states whose predecessors a thread scans at once.
+uint64_t const frontierStatesPerTask = 256;
+
+template<typename T>
+ParallelGraphSearch<T>::ParallelGraphSearch(storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                            std::vector<uint_fast64_t> const* nondeterministicChoiceIndices,
+                                            storm::storage::SparseMatrix<T> const& backwardTransitions, uint64_t numberOfThreads)
+    : transitionMatrix(transitionMatrix),
+      nondeterministicChoiceIndices(nondeterministicChoiceIndices),
+      backwardTransitions(backwardTransitions),
+      numberOfStates(backwardTransitions.getRowCount()),
+      numberOfThreads(std::max<uint64_t>(numberOfThreads, 1)) {
+    STORM_LOG_ASSERT(nondeterministicChoiceIndices || transitionMatrix.getRowCount() == numberOfStates,
+                     "Expected one row per state, as no row groups were given.");
+    STORM_LOG_ASSERT(!nondeterministicChoiceIndices || nondeterministicChoiceIndices->size() == numberOfStates + 1, "Unexpected number of row groups.");
+}
+
+template<typename T>
+storm::storage::BitVector ParallelGraphSearch<T>::performProbGreater0E(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                        boost::optional<uint64_t> const& maximalSteps) const {
+    auto hasReachedSuccessor = [this](uint64_t state, storm::storage::BitVector const& reachedStates) {
+        for (auto entryIt = transitionMatrix.begin(getFirstRow(state)), entryIte = transitionMatrix.begin(getEndOfGroup(state)); entryIt != entryIte;
+             ++entryIt) {
+            if (reachedStates.get(entryIt->getColumn())) {
+                return true;
+            }
+        }
+        return false;
+    };
+    return search(phiStates, psiStates, hasReachedSuccessor, true, maximalSteps);
+}
+
+template<typename T>
+storm::storage::BitVector ParallelGraphSearch<T>::performProbGreater0A(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint) const {
+    auto allChoicesHaveReachedSuccessor = [this, &choiceConstraint](uint64_t state, storm::storage::BitVector const& reachedStates) {
+        uint_fast64_t const endOfGroup = getEndOfGroup(state);
+        // There needs to be at least one enabled choice.
+        if (choiceConstraint && choiceConstraint->getNextSetIndex(getFirstRow(state)) >= endOfGroup) {
+            return false;
+        }
+        for (uint_fast64_t row = getFirstRow(state); row < endOfGroup; ++row) {
+            if (choiceConstraint && !choiceConstraint->get(row)) {
+                continue;
+            }
+            bool hasReachedSuccessor = false;
+            for (auto const& entry : transitionMatrix.getRow(row)) {
+                if (reachedStates.get(entry.getColumn())) {
+                    hasReachedSuccessor = true;
+                    break;
+                }
+            }
+            if (!hasReachedSuccessor) {
+                return false;
+            }
+        }
+        return true;
+    };
+    return search(phiStates, psiStates, allChoicesHaveReachedSuccessor, false);
+}
+
+template<typename T>
+storm::storage::BitVector ParallelGraphSearch<T>::performProb1E(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint) const {
+    // Iteratively shrink the candidate states until they are exactly the states from which psi can be reached
+    // almost surely while staying in the candidate states.
+    storm::storage::BitVector currentStates(numberOfStates, true);
+    while (true) {
+        auto someChoiceStaysAndHasReachedSuccessor = [this, &choiceConstraint, &currentStates](uint64_t state,
+                                                                                               storm::storage::BitVector const& reachedStates) {
+            for (uint_fast64_t row = getFirstRow(state), endOfGroup = getEndOfGroup(state); row < endOfGroup; ++row) {
+                if (choiceConstraint && !choiceConstraint->get(row)) {
+                    continue;
+                }
+                bool allSuccessorsInCurrentStates = true;
+                bool hasReachedSuccessor = false;
+                for (auto const& entry : transitionMatrix.getRow(row)) {
+                    if (!currentStates.get(entry.getColumn())) {
+                        allSuccessorsInCurrentStates = false;
+                        break;
+                    }
+                    hasReachedSuccessor |= reachedStates.get(entry.getColumn());
+                }
+                if (allSuccessorsInCurrentStates && hasReachedSuccessor) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        storm::storage::BitVector nextStates = search(phiStates, psiStates, someChoiceStaysAndHasReachedSuccessor, false);
+        if (nextStates == currentStates) {
+            return currentStates;
+        }
+        currentStates = std::move(nextStates);
+    }
+}
+
+template<typename T>
+storm::storage::BitVector ParallelGraphSearch<T>::performProb1A(storm::storage::BitVector const& phiStates,
+                                                                 storm::storage::BitVector const& psiStates) const {
+    storm::storage::BitVector currentStates(numberOfStates, true);
+    while (true) {
+        auto allChoicesStayAndHaveReachedSuccessor = [this, &currentStates](uint64_t state, storm::storage::BitVector const& reachedStates) {
+            for (uint_fast64_t row = getFirstRow(state), endOfGroup = getEndOfGroup(state); row < endOfGroup; ++row) {
+                bool hasReachedSuccessor = false;
+                for (auto const& entry : transitionMatrix.getRow(row)) {
+                    if (!currentStates.get(entry.getColumn())) {
+                        return false;
+                    }
+                    hasReachedSuccessor |= reachedStates.get(entry.getColumn());
+                }
+                if (!hasReachedSuccessor) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        storm::storage::BitVector nextStates = search(phiStates, psiStates, allChoicesStayAndHaveReachedSuccessor, false);
+        if (nextStates == currentStates) {
+            return currentStates;
+        }
+        currentStates = std::move(nextStates);
+    }
+}
+
+template<typename T>
+template<typename Condition>
+storm::storage::BitVector ParallelGraphSearch<T>::search(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& initialStates,
+                                                         Condition const& condition, bool satisfiedByPredecessors,
+                                                         boost::optional<uint64_t> const& maximalLevels) const {
+    storm::storage::BitVector reachedStates = initialStates;
+    storm::storage::BitVector candidateStates = phiStates & ~initialStates;
+    uint64_t numberOfCandidates = candidateStates.getNumberOfSetBits();
+
+    // The frontier is kept as a list of states, such that top-down levels only cost time in the size of the frontier.
+    // Only bottom-up levels, which scan all candidates anyway, use a bit vector for the next frontier.
+    std::vector<uint64_t> frontier(initialStates.begin(), initialStates.end());
+    std::vector<uint64_t> nextFrontier;
+
+    auto getNumberOfTransitions = [this](uint64_t state) {
+        return static_cast<uint64_t>(std::distance(transitionMatrix.begin(getFirstRow(state)), transitionMatrix.begin(getEndOfGroup(state))));
+    };
+    uint64_t candidateTransitions = 0;
+    for (auto state : candidateStates) {
+        candidateTransitions += getNumberOfTransitions(state);
+    }
+    auto addToNextFrontier = [&](uint64_t state) {
+        // A state may be found several times within a top-down level, so we only add it if it still is a candidate.
+        if (candidateStates.get(state)) {
+            candidateStates.set(state, false);
+            reachedStates.set(state);
+            --numberOfCandidates;
+            candidateTransitions -= getNumberOfTransitions(state);
+            nextFrontier.push_back(state);
+        }
+    };
+
+    std::mutex foundStatesMutex;
+    std::vector<uint64_t> foundStates;
+    uint64_t bottomUpLevels = 0;
+    uint64_t level = 0;
+    executeInArena([&]() {
+        for (; !frontier.empty() && numberOfCandidates > 0 && (!maximalLevels || level < maximalLevels.get()); ++level) {
+            uint64_t frontierTransitions = 0;
+            for (auto state : frontier) {
+                frontierTransitions += backwardTransitions.getRow(state).getNumberOfEntries();
+            }
+
+            nextFrontier.clear();
+            if (frontierTransitions * bottomUpFactor > candidateTransitions) {
+                // Check for all candidates whether they are to be added. As the ranges of states are aligned to the
+                // buckets of the bit vector, the threads can set the bits of the found states without synchronization.
+                ++bottomUpLevels;
+                storm::storage::BitVector foundStatesBitVector(numberOfStates);
+                forEachStateRange([&](uint64_t begin, uint64_t end) {
+                    for (uint64_t state = candidateStates.getNextSetIndex(begin); state < end; state = candidateStates.getNextSetIndex(state + 1)) {
+                        if (condition(state, reachedStates)) {
+                            foundStatesBitVector.set(state);
+                        }
+                    }
+                });
+                for (auto state : foundStatesBitVector) {
+                    addToNextFrontier(state);
+                }
+            } else {
+                // Check the candidates among the predecessors of the frontier. The found states are collected per range
+                // of the frontier and added afterwards.
+                foundStates.clear();
+                forEachIndexRange(frontier.size(), [&](uint64_t begin, uint64_t end) {
+                    std::vector<uint64_t> localFoundStates;
+                    for (uint64_t index = begin; index < end; ++index) {
+                        for (auto const& entry : backwardTransitions.getRow(frontier[index])) {
+                            uint64_t predecessor = entry.getColumn();
+                            if (candidateStates.get(predecessor) && (satisfiedByPredecessors || condition(predecessor, reachedStates))) {
+                                localFoundStates.push_back(predecessor);
+                            }
+                        }
+                    }
+                    if (!localFoundStates.empty()) {
+                        std::lock_guard<std::mutex> lock(foundStatesMutex);
+                        foundStates.insert(foundStates.end(), localFoundStates.begin(), localFoundStates.end());
+                    }
+                });
+                for (auto state : foundStates) {
+                    addToNextFrontier(state);
+                }
+            }
+            std::swap(frontier, nextFrontier);
+        }
+    });
+    STORM_LOG_TRACE("Graph search finished after " << level << " levels (" << bottomUpLevels << " of them bottom-up).");
+
+    return reachedStates;
+}
+
+template<typename T>
+template<typename Function>
+void ParallelGraphSearch<T>::executeInArena(Function const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+    tbb::task_arena arena(static_cast<int>(numberOfThreads));
+    arena.execute(function);
+#else
+    function();
+#endif
+}
+
+template<typename T>
+template<typename Function>
+void ParallelGraphSearch<T>::forEachStateRange(Function const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+    uint64_t const numberOfBuckets = (numberOfStates + 63) / 64;
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfBuckets, bucketsPerTask), [this, &function](tbb::blocked_range<uint64_t> const& range) {
+        function(range.begin() * 64, std::min(range.end() * 64, numberOfStates));
+    });
+#else
+    function(0, numberOfStates);
+#endif
+}
+
+template<typename T>
+template<typename Function>
+void ParallelGraphSearch<T>::forEachIndexRange(uint64_t size, Function const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+    tbb::parallel_for(tbb::blocked_range<uint64_t>(0, size, frontierStatesPerTask),
+                      [&function](tbb::blocked_range<uint64_t> const& range) { function(range.begin(), range.end()); });
+#else
+    function(0, size);
+#endif
+}
+
+template<typename T>
+uint_fast64_t ParallelGraphSearch<T>::getFirstRow(uint64_t state) const {
+    return nondeterministicChoiceIndices ? (*nondeterministicChoiceIndices)[state] : state;
+}
+
+template<typename T>
+uint_fast64_t ParallelGraphSearch<T>::getEndOfGroup(uint64_t state) const {
+    return nondeterministicChoiceIndices ? (*nondeterministicChoiceIndices)[state + 1] : state + 1;
+}
+
+template class ParallelGraphSearch<double>;
+#ifdef STORM_HAVE_CARL
+template class ParallelGraphSearch<storm::RationalNumber>;
+template class ParallelGraphSearch<storm::RationalFunction>;
+#endif
+
+}  // namespace graph
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace utility {
+namespace graph {
+
+/*!
+ * Performs the backward searches of the qualitative analyses (prob0/prob1) of sparse models as a level-synchronous
+ * breadth-first search, where the states of each level are processed in parallel.
+ *
+ * Each level is either processed top-down, i.e. by scanning the predecessors of the frontier, or bottom-up, i.e. by
+ * scanning the successors of all states that were not reached yet. The direction is chosen per level by comparing the
+ * number of transitions that either direction needs to inspect. Whether a state is added to the next level only
+ * depends on which of its successors were reached so far, so both directions yield the same levels and the searches
+ * compute exactly the same sets of states as the sequential ones in graph.h.
+ */
+template<typename T>
+class ParallelGraphSearch {
+   public:
+    /*!
+     * Prepares the searches on the given model.
+     *
+     * @param transitionMatrix The transition matrix of the model.
+     * @param nondeterministicChoiceIndices The row groups of the transition matrix. If not given, every state is
+     * assumed to have exactly one row.
+     * @param backwardTransitions The reversed transition relation of the model.
+     * @param numberOfThreads The number of threads that process the levels of the searches.
+     */
+    ParallelGraphSearch(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const* nondeterministicChoiceIndices,
+                        storm::storage::SparseMatrix<T> const& backwardTransitions, uint64_t numberOfThreads);
+
+    /*!
+     * Computes the states that can reach a psi state via phi states under some scheduler, i.e. the states for which
+     * the maximal probability of satisfying phi until psi is greater than zero.
+     *
+     * @param maximalSteps If given, only paths of at most this many steps are considered.
+     */
+    storm::storage::BitVector performProbGreater0E(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                   boost::optional<uint64_t> const& maximalSteps = boost::none) const;
+
+    /*!
+     * Computes the states for which the minimal probability of satisfying phi until psi is greater than zero.
+     *
+     * @param choiceConstraint If given, only the choices selected by this bit vector are considered.
+     */
+    storm::storage::BitVector performProbGreater0A(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                   boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none) const;
+
+    /*!
+     * Computes the states for which the maximal probability of satisfying phi until psi is one.
+     *
+     * @param choiceConstraint If given, only the choices selected by this bit vector are considered.
+     */
+    storm::storage::BitVector performProb1E(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                            boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none) const;
+
+    /*!
+     * Computes the states for which the minimal probability of satisfying phi until psi is one.
+     */
+    storm::storage::BitVector performProb1A(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const;
+
+   private:
+    /*!
+     * Computes the least set of states that contains the initial states and every phi state that satisfies the given
+     * condition with respect to the states in the set.
+     *
+     * @param condition Decides whether the given state is added to the set, given the states that were reached so
+     * far. It may only depend on which successors of the state were reached.
+     * @param satisfiedByPredecessors If true, every predecessor of a reached state satisfies the condition.
+     * @param maximalLevels If given, the search stops after this many levels.
+     */
+    template<typename Condition>
+    storm::storage::BitVector search(storm::storage::BitVector const& phiStates, storm::storage::BitVector const& initialStates, Condition const& condition,
+                                     bool satisfiedByPredecessors, boost::optional<uint64_t> const& maximalLevels = boost::none) const;
+
+    /*!
+     * Executes the given function in a task arena with the configured number of threads. The parallel loops below
+     * need to be called from within this function, so that all levels of a search share the same arena.
+     */
+    template<typename Function>
+    void executeInArena(Function const& function) const;
+
+    /*!
+     * Invokes the given function for disjoint ranges of states that together cover all states. Every range starts at
+     * a multiple of 64, so the functions may concurrently set bits of (different) states in the same bit vector.
+     */
+    template<typename Function>
+    void forEachStateRange(Function const& function) const;
+
+    /*!
+     * Invokes the given function for disjoint ranges of indices that together cover the indices below the given size.
+     */
+    template<typename Function>
+    void forEachIndexRange(uint64_t size, Function const& function) const;
+
+    /*!
+     * Retrieves the first row of the given state and the row after its last row, respectively.
+     */
+    uint_fast64_t getFirstRow(uint64_t state) const;
+    uint_fast64_t getEndOfGroup(uint64_t state) const;
+
+    // The transition matrix of the model.
+    storm::storage::SparseMatrix<T> const& transitionMatrix;
+
+    // The row groups of the transition matrix or null if every state has exactly one row.
+    std::vector<uint_fast64_t> const* nondeterministicChoiceIndices;
+
+    // The reversed transition relation of the model.
+    storm::storage::SparseMatrix<T> const& backwardTransitions;
+
+    // The number of states of the model.
+    uint64_t numberOfStates;
+
+    // The number of threads that process the levels of the searches.
+    uint64_t numberOfThreads;
+};
+
+}  // namespace graph
+}  // namespace utility
+}  // namespace storm
@@ -22,7 +22,10 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/models/symbolic/StochasticTwoPlayerGame.h"
 
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/ParallelGraphSearch.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -1090,6 +1093,168 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                             psiStates);
 }
 
+namespace {
+bool isParallelGraphSearchEnabled(Environment const& env) {
+    if (env.modelchecker().getNumberOfGraphThreads() <= 1) {
+        return false;
+    }
+#ifdef STORM_HAVE_INTELTBB
+    return true;
+#else
+    STORM_LOG_WARN("Storm was built without support for Intel TBB. The graph analyses are performed sequentially.");
+    return false;
+#endif
+}
+
+template<typename T>
+ParallelGraphSearch<T> createParallelGraphSearch(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                 storm::storage::SparseMatrix<T> const& backwardTransitions) {
+    return ParallelGraphSearch<T>(transitionMatrix, transitionMatrix.hasTrivialRowGrouping() ? nullptr : &transitionMatrix.getRowGroupIndices(),
+                                  backwardTransitions, env.modelchecker().getNumberOfGraphThreads());
+}
+}  // namespace
+
+template<typename T>
+storm::storage::BitVector performProbGreater0(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                              storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    if (isParallelGraphSearchEnabled(env)) {
+        boost::optional<uint64_t> stepBound = useStepBound ? boost::make_optional<uint64_t>(maximalSteps) : boost::none;
+        return createParallelGraphSearch(env, transitionMatrix, backwardTransitions).performProbGreater0E(phiStates, psiStates, stepBound);
+    }
+    return performProbGreater0(backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+template<typename T>
+storm::storage::BitVector performProb1(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                       storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates) {
+    if (isParallelGraphSearchEnabled(env)) {
+        auto search = createParallelGraphSearch(env, transitionMatrix, backwardTransitions);
+        storm::storage::BitVector statesWithProbability1 = search.performProbGreater0E(~psiStates, ~search.performProbGreater0E(phiStates, psiStates));
+        statesWithProbability1.complement();
+        return statesWithProbability1;
+    }
+    return performProb1(backwardTransitions, phiStates, psiStates);
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                              storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates) {
+    if (isParallelGraphSearchEnabled(env)) {
+        auto search = createParallelGraphSearch(env, transitionMatrix, backwardTransitions);
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+        result.first = search.performProbGreater0E(phiStates, psiStates);
+        result.second = search.performProbGreater0E(~psiStates, ~result.first);
+        result.second.complement();
+        result.first.complement();
+        return result;
+    }
+    return performProb01(backwardTransitions, phiStates, psiStates);
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0E(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+    if (isParallelGraphSearchEnabled(env)) {
+        boost::optional<uint64_t> stepBound = useStepBound ? boost::make_optional<uint64_t>(maximalSteps) : boost::none;
+        ParallelGraphSearch<T> search(transitionMatrix, &nondeterministicChoiceIndices, backwardTransitions, env.modelchecker().getNumberOfGraphThreads());
+        return search.performProbGreater0E(phiStates, psiStates, stepBound);
+    }
+    return performProbGreater0E(backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps);
+}
+
+template<typename T>
+storm::storage::BitVector performProb0A(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbability0 =
+        performProbGreater0E(env, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
+template<typename T>
+storm::storage::BitVector performProb1E(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    if (isParallelGraphSearchEnabled(env)) {
+        ParallelGraphSearch<T> search(transitionMatrix, &nondeterministicChoiceIndices, backwardTransitions, env.modelchecker().getNumberOfGraphThreads());
+        return search.performProb1E(phiStates, psiStates, choiceConstraint);
+    }
+    return performProb1E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, choiceConstraint);
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(Environment const& env,
+                                                                                 storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProb0A(env, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    result.second = performProb1E(env, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    return result;
+}
+
+template<typename T>
+storm::storage::BitVector performProbGreater0A(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    if (!useStepBound && isParallelGraphSearchEnabled(env)) {
+        ParallelGraphSearch<T> search(transitionMatrix, &nondeterministicChoiceIndices, backwardTransitions, env.modelchecker().getNumberOfGraphThreads());
+        return search.performProbGreater0A(phiStates, psiStates, choiceConstraint);
+    }
+    return performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps,
+                                choiceConstraint);
+}
+
+template<typename T>
+storm::storage::BitVector performProb0E(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    storm::storage::BitVector statesWithProbability0 =
+        performProbGreater0A(env, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    statesWithProbability0.complement();
+    return statesWithProbability0;
+}
+
+template<typename T>
+storm::storage::BitVector performProb1A(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates) {
+    if (isParallelGraphSearchEnabled(env)) {
+        ParallelGraphSearch<T> search(transitionMatrix, &nondeterministicChoiceIndices, backwardTransitions, env.modelchecker().getNumberOfGraphThreads());
+        return search.performProb1A(phiStates, psiStates);
+    }
+    return performProb1A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+}
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(Environment const& env,
+                                                                                 storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates) {
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
+    result.first = performProb0E(env, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    // As in the sequential variant, the prob1 states are the states that cannot reach a prob0 state.
+    result.second = performProb0A(env, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, ~psiStates, result.first);
+    return result;
+}
+
 template<storm::dd::DdType Type, typename ValueType>
 storm::dd::Bdd<Type> computeSchedulerProbGreater0E(storm::models::symbolic::NondeterministicModel<Type, ValueType> const& model,
                                                    storm::dd::Bdd<Type> const& transitionMatrix, storm::dd::Bdd<Type> const& phiStates,
@@ -2278,6 +2443,159 @@ template std::vector<uint_fast64_t> getTopologicalSort(storm::storage::SparseMat
                                                        std::vector<uint64_t> const& firstStates);
 #endif
 
+// Instantiations of the variants that take an environment.
+
+template storm::storage::BitVector performProbGreater0(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                       storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+template storm::storage::BitVector performProb1(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(Environment const& env,
+                                                                                       storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                       storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                                                       storm::storage::BitVector const& phiStates,
+                                                                                       storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0E(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
+template storm::storage::BitVector performProb0A(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1E(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(Environment const& env,
+                                                                                          storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                          std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                          storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                                                          storm::storage::BitVector const& phiStates,
+                                                                                          storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0A(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template storm::storage::BitVector performProb0E(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(Environment const& env, storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                 storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(Environment const& env,
+                                                                                          storm::storage::SparseMatrix<double> const& transitionMatrix,
+                                                                                          std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                          storm::storage::SparseMatrix<double> const& backwardTransitions,
+                                                                                          storm::storage::BitVector const& phiStates,
+                                                                                          storm::storage::BitVector const& psiStates);
+
+#ifdef STORM_HAVE_CARL
+template storm::storage::BitVector performProbGreater0(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                       storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+template storm::storage::BitVector performProb1(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0E(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
+template storm::storage::BitVector performProb0A(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1E(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0A(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template storm::storage::BitVector performProb0E(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+template storm::storage::BitVector performProbGreater0(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                       storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       bool useStepBound, uint_fast64_t maximalSteps);
+template storm::storage::BitVector performProb1(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0E(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps);
+template storm::storage::BitVector performProb0A(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1E(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProbGreater0A(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                        storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                        bool useStepBound, uint_fast64_t maximalSteps,
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint);
+template storm::storage::BitVector performProb0E(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template storm::storage::BitVector performProb1A(Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                 storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
+    Environment const& env, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+#endif
+
 // Instantiations for CUDD.
 
 template storm::dd::Bdd<storm::dd::DdType::CUDD> performProbGreater0(storm::models::symbolic::Model<storm::dd::DdType::CUDD, double> const& model,
@@ -18,6 +18,8 @@
 #include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
+class Environment;
+
 namespace storage {
 class BitVector;
 template<typename VT>
@@ -528,6 +530,85 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  storm::storage::BitVector const& phiStates,
                                                                                  storm::storage::BitVector const& psiStates);
 
+/*
+ * The following variants of the qualitative analyses of sparse models compute the same sets of states as the ones
+ * above. If the environment requests more than one graph thread, they are computed by a parallel breadth-first search
+ * (see ParallelGraphSearch), which also needs the (forward) transition matrix. Otherwise, the sequential search is used.
+ */
+
+template<typename T>
+storm::storage::BitVector performProbGreater0(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                              storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                              storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+
+template<typename T>
+storm::storage::BitVector performProb1(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                       storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                       storm::storage::BitVector const& psiStates);
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                              storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                              storm::storage::BitVector const& phiStates,
+                                                                              storm::storage::BitVector const& psiStates);
+
+template<typename T>
+storm::storage::BitVector performProbGreater0E(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+
+template<typename T>
+storm::storage::BitVector performProb0A(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
+
+template<typename T>
+storm::storage::BitVector performProb1E(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates,
+                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(Environment const& env,
+                                                                                 storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
+
+/*!
+ * Note that step-bounded searches are always performed sequentially.
+ */
+template<typename T>
+storm::storage::BitVector performProbGreater0A(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+
+template<typename T>
+storm::storage::BitVector performProb0E(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
+
+template<typename T>
+storm::storage::BitVector performProb1A(Environment const& env, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                        std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                        storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                        storm::storage::BitVector const& psiStates);
+
+template<typename T>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(Environment const& env,
+                                                                                 storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                                                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                                                 storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
+
 /*!
  * Computes the set of states for which there exists a scheduler that achieves a probability greater than
  * zero of satisfying phi until psi.
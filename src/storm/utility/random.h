@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <boost/random.hpp>
 #include <random>
 #include "storm/adapters/RationalNumberAdapter.h"
@@ -41,6 +42,43 @@ class RandomProbabilityGenerator<storm::RationalNumber> {
     std::mt19937 engine;
 };
 
+/*!
+ * A counter-based generator of random numbers. The i-th number of a stream is a function of the seed, the stream and
+ * i only, so that streams can be handed out to arbitrary threads without affecting the generated numbers.
+ */
+class CounterBasedRandomGenerator {
+   public:
+    CounterBasedRandomGenerator(uint64_t seed, uint64_t stream) : key(mix(seed ^ mix(stream + 0x9E3779B97F4A7C15ull))), counter(0) {}
+
+    /*!
+     * Retrieves a number drawn uniformly from [0, 1).
+     */
+    double random() {
+        return (next() >> 11) * 0x1.0p-53;
+    }
+
+    /*!
+     * Retrieves a number drawn uniformly from [min, max]. The (negligible) bias of the reduction is accepted.
+     */
+    uint64_t random_uint(uint64_t min, uint64_t max) {
+        return std::min(max, min + static_cast<uint64_t>(random() * static_cast<double>(max - min + 1)));
+    }
+
+   private:
+    uint64_t next() {
+        return mix(key + (++counter) * 0x9E3779B97F4A7C15ull);
+    }
+
+    static uint64_t mix(uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    uint64_t key;
+    uint64_t counter;
+};
+
 class BernoulliDistributionGenerator {
    public:
     BernoulliDistributionGenerator(double prob);
@@ -1,6 +1,9 @@
 #include "storm/utility/stateelimination.h"
 
+#include <algorithm>
 #include <random>
+#include <set>
+#include <unordered_map>
 
 #include "storm/solver/stateelimination/DynamicStatePriorityQueue.h"
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
@@ -45,7 +48,8 @@ bool eliminationOrderIsPenaltyBased(storm::settings::modules::EliminationSetting
 }
 
 bool eliminationOrderIsStatic(storm::settings::modules::EliminationSettings::EliminationOrder const& order) {
-    return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty;
+    return eliminationOrderNeedsDistances(order) || order == storm::settings::modules::EliminationSettings::EliminationOrder::StaticPenalty ||
+           order == storm::settings::modules::EliminationSettings::EliminationOrder::ApproximateMinimumDegree;
 }
 
 template<typename ValueType>
@@ -100,6 +104,150 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
     return backwardTransitions.getRow(state).size() * transitionMatrix.getRow(state).size();
 }
 
+template<typename ValueType>
+std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                                                     storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                                                     storm::storage::BitVector const& states) {
+    // Number the states to eliminate and their neighbours consecutively, so that the effort only depends on the
+    // part of the matrix that is affected by the elimination. The states to eliminate get the first numbers.
+    std::vector<storm::storage::sparse::state_type> localToState(states.begin(), states.end());
+    uint64_t const numberOfStatesToEliminate = localToState.size();
+    std::unordered_map<storm::storage::sparse::state_type, uint64_t> stateToLocal;
+    for (uint64_t local = 0; local < numberOfStatesToEliminate; ++local) {
+        stateToLocal.emplace(localToState[local], local);
+    }
+
+    // The variables adjacent to each state that is to be eliminated. The transitions are considered undirected.
+    std::vector<std::vector<uint64_t>> adjacentVariables(numberOfStatesToEliminate);
+    std::vector<uint64_t> marks;
+    uint64_t currentMark = 0;
+    for (uint64_t local = 0; local < numberOfStatesToEliminate; ++local) {
+        ++currentMark;
+        auto addNeighbour = [&](storm::storage::sparse::state_type neighbour) {
+            if (neighbour == localToState[local]) {
+                return;
+            }
+            auto insertionResult = stateToLocal.emplace(neighbour, localToState.size());
+            if (insertionResult.second) {
+                localToState.push_back(neighbour);
+            }
+            uint64_t neighbourLocal = insertionResult.first->second;
+            if (marks.size() <= neighbourLocal) {
+                marks.resize(localToState.size(), 0);
+            }
+            if (marks[neighbourLocal] != currentMark) {
+                marks[neighbourLocal] = currentMark;
+                adjacentVariables[local].push_back(neighbourLocal);
+            }
+        };
+        for (auto const& entry : transitionMatrix.getRow(localToState[local])) {
+            addNeighbour(entry.getColumn());
+        }
+        for (auto const& entry : backwardTransitions.getRow(localToState[local])) {
+            addNeighbour(entry.getColumn());
+        }
+    }
+    uint64_t const numberOfNodes = localToState.size();
+    marks.resize(numberOfNodes, 0);
+
+    // The elements adjacent to each node and the variables adjacent to each element. An element is a state that was
+    // eliminated: all of its adjacent variables are pairwise adjacent.
+    std::vector<std::vector<uint64_t>> adjacentElements(numberOfNodes);
+    std::vector<std::vector<uint64_t>> elementVariables(numberOfStatesToEliminate);
+    storm::storage::BitVector eliminated(numberOfNodes);
+    storm::storage::BitVector absorbed(numberOfNodes);
+    std::vector<uint64_t> externalSizes(numberOfNodes, 0);
+    std::vector<uint64_t> externalSizeMarks(numberOfNodes, 0);
+
+    std::vector<uint64_t> degrees(numberOfStatesToEliminate);
+    std::set<std::pair<uint64_t, uint64_t>> queue;
+    for (uint64_t local = 0; local < numberOfStatesToEliminate; ++local) {
+        degrees[local] = adjacentVariables[local].size();
+        queue.emplace(degrees[local], local);
+    }
+
+    std::vector<storm::storage::sparse::state_type> result;
+    result.reserve(numberOfStatesToEliminate);
+    uint64_t numberOfRemainingNodes = numberOfNodes;
+    while (!queue.empty()) {
+        uint64_t pivot = queue.begin()->second;
+        queue.erase(queue.begin());
+        result.push_back(localToState[pivot]);
+        eliminated.set(pivot);
+        --numberOfRemainingNodes;
+
+        // The variables of the new element are the adjacent variables of the pivot and the variables of the elements
+        // adjacent to the pivot. The latter elements are absorbed by the new element.
+        ++currentMark;
+        marks[pivot] = currentMark;
+        std::vector<uint64_t> newElementVariables;
+        for (auto variable : adjacentVariables[pivot]) {
+            if (!eliminated.get(variable) && marks[variable] != currentMark) {
+                marks[variable] = currentMark;
+                newElementVariables.push_back(variable);
+            }
+        }
+        for (auto element : adjacentElements[pivot]) {
+            if (absorbed.get(element)) {
+                continue;
+            }
+            for (auto variable : elementVariables[element]) {
+                if (marks[variable] != currentMark) {
+                    marks[variable] = currentMark;
+                    newElementVariables.push_back(variable);
+                }
+            }
+            absorbed.set(element);
+            std::vector<uint64_t>().swap(elementVariables[element]);
+        }
+        std::vector<uint64_t>().swap(adjacentVariables[pivot]);
+        std::vector<uint64_t>().swap(adjacentElements[pivot]);
+
+        // Determine the number of variables of each element adjacent to the new element that are not contained in it.
+        for (auto variable : newElementVariables) {
+            for (auto element : adjacentElements[variable]) {
+                if (absorbed.get(element)) {
+                    continue;
+                }
+                if (externalSizeMarks[element] != currentMark) {
+                    externalSizeMarks[element] = currentMark;
+                    externalSizes[element] = elementVariables[element].size();
+                }
+                --externalSizes[element];
+            }
+        }
+
+        // Update the adjacencies and the approximate degrees of the variables of the new element.
+        for (auto variable : newElementVariables) {
+            uint64_t externalDegree = 0;
+            auto& elements = adjacentElements[variable];
+            elements.erase(std::remove_if(elements.begin(), elements.end(), [&absorbed](uint64_t element) { return absorbed.get(element); }),
+                           elements.end());
+            for (auto element : elements) {
+                externalDegree += externalSizes[element];
+            }
+            elements.push_back(pivot);
+
+            if (variable < numberOfStatesToEliminate) {
+                // Adjacent variables that are also adjacent through the new element need not be stored separately.
+                auto& variables = adjacentVariables[variable];
+                variables.erase(std::remove_if(variables.begin(), variables.end(),
+                                               [&](uint64_t otherVariable) { return eliminated.get(otherVariable) || marks[otherVariable] == currentMark; }),
+                                variables.end());
+
+                uint64_t degree = variables.size() + newElementVariables.size() - 1 + externalDegree;
+                degree = std::min(degree, degrees[variable] + newElementVariables.size() - 1);
+                degree = std::min(degree, numberOfRemainingNodes - 1);
+                queue.erase(std::make_pair(degrees[variable], variable));
+                degrees[variable] = degree;
+                queue.emplace(degree, variable);
+            }
+        }
+        elementVariables[pivot] = std::move(newElementVariables);
+    }
+    return result;
+}
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
@@ -118,6 +266,8 @@ std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std
         std::mt19937 generator(randomDevice());
         std::shuffle(sortedStates.begin(), sortedStates.end(), generator);
         return std::make_unique<StaticStatePriorityQueue>(sortedStates);
+    } else if (order == storm::settings::modules::EliminationSettings::EliminationOrder::ApproximateMinimumDegree) {
+        return std::make_unique<StaticStatePriorityQueue>(computeApproximateMinimumDegreeOrder(transitionMatrix, backwardTransitions, states));
     } else {
         if (eliminationOrderNeedsDistances(order)) {
             STORM_LOG_THROW(static_cast<bool>(distanceBasedStatePriorities), storm::exceptions::InvalidStateException,
@@ -229,6 +379,9 @@ std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatrix<ValueT
 }
 
 template uint_fast64_t estimateComplexity(double const& value);
+template std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(
+    storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix, storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
+    storm::storage::BitVector const& states);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<double> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<double> const& backwardTransitions,
@@ -252,6 +405,9 @@ template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatr
 
 #ifdef STORM_HAVE_CARL
 template uint_fast64_t estimateComplexity(storm::RationalNumber const& value);
+template std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(
+    storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& states);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -274,6 +430,9 @@ template std::vector<uint_fast64_t> getStateDistances(storm::storage::SparseMatr
                                                       storm::storage::BitVector const& initialStates,
                                                       std::vector<storm::RationalNumber> const& oneStepProbabilities, bool forward);
 
+template std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(
+    storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
+    storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& states);
 template std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& distanceBasedStatePriorities,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                                       storm::storage::FlexibleSparseMatrix<storm::RationalFunction> const& backwardTransitions,
@@ -58,6 +58,22 @@ uint_fast64_t computeStatePenaltyRegularExpression(storm::storage::sparse::state
                                                    storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
                                                    std::vector<ValueType> const& oneStepProbabilities);
 
+/*!
+ * Computes an order in which to eliminate the given states that keeps the fill-in low. The order is computed on the
+ * (symmetrized) structure of the transition matrix only, with the approximate minimum degree heuristic: the states are
+ * eliminated on a quotient graph, in which the eliminated states are kept as elements that represent the fill-in among
+ * their neighbours, and in each step a state with minimal (approximate) number of neighbours is chosen.
+ *
+ * @param transitionMatrix The transition matrix.
+ * @param backwardTransitions The backward transitions.
+ * @param states The states to eliminate.
+ * @return The given states in the order in which they are to be eliminated.
+ */
+template<typename ValueType>
+std::vector<storm::storage::sparse::state_type> computeApproximateMinimumDegreeOrder(storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
+                                                                                     storm::storage::FlexibleSparseMatrix<ValueType> const& backwardTransitions,
+                                                                                     storm::storage::BitVector const& states);
+
 template<typename ValueType>
 std::shared_ptr<StatePriorityQueue> createStatePriorityQueue(boost::optional<std::vector<uint_fast64_t>> const& stateDistances,
                                                              storm::storage::FlexibleSparseMatrix<ValueType> const& transitionMatrix,
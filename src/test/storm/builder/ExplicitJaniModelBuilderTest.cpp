@@ -3,6 +3,7 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/storm.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/generator/JaniNextStateGenerator.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -204,3 +205,41 @@ TEST(ExplicitJaniModelBuilderTest, enumerateInitial) {
     EXPECT_EQ(145ul, model->getNumberOfTransitions());
     EXPECT_EQ(72ul, model->getInitialStates().getNumberOfSetBits());
 }
+
+TEST(ExplicitJaniModelBuilderTest, CloneGenerator) {
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.explorationThreads = 4;
+
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+        auto generator = std::make_shared<storm::generator::JaniNextStateGenerator<double>>(janiModel, generatorOptions);
+        ASSERT_TRUE(generator->isCloneable());
+        auto clonedGenerator = generator->clone();
+        EXPECT_NE(generator.get(), clonedGenerator.get());
+
+        auto model = storm::builder::ExplicitModelBuilder<double>(generator).build();
+        auto clonedModel = storm::builder::ExplicitModelBuilder<double>(clonedGenerator).build();
+        EXPECT_EQ(model->getNumberOfStates(), clonedModel->getNumberOfStates());
+        EXPECT_TRUE(model->getTransitionMatrix() == clonedModel->getTransitionMatrix());
+        EXPECT_TRUE(model->getStateLabeling() == clonedModel->getStateLabeling());
+
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions, parallelOptions).build();
+        EXPECT_TRUE(model->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_TRUE(model->getStateLabeling() == parallelModel->getStateLabeling());
+    }
+
+    // Generators for models with arrays can not be cloned, so the parallel exploration falls back to the sequential one.
+    storm::jani::Model janiModel = storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/dtmc/die_array.jani").first;
+    storm::generator::JaniNextStateGenerator<double> generator(janiModel);
+    EXPECT_FALSE(generator.isCloneable());
+    STORM_SILENT_EXPECT_THROW(generator.clone(), storm::exceptions::NotSupportedException);
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(janiModel, storm::generator::NextStateGeneratorOptions(), parallelOptions).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+    EXPECT_EQ(20ul, model->getNumberOfTransitions());
+}
@@ -175,6 +175,45 @@ TEST(ExplicitPrismModelBuilderTest, ExportExplicitLookup) {
     EXPECT_EQ(1ul, model->getLabelsOfState(lookup.lookup({{svar, manager.integer(7)}, {dvar, manager.integer(2)}})).count("two"));
 }
 
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions;
+    parallelOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    parallelOptions.explorationThreads = 4;
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        auto sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        EXPECT_EQ(sequentialModel->getNumberOfStates(), parallelModel->getNumberOfStates());
+        EXPECT_EQ(sequentialModel->getNumberOfTransitions(), parallelModel->getNumberOfTransitions());
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, CompiledExpressions) {
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.setBuildAllLabels();
+    generatorOptions.setBuildAllRewardModels();
+    storm::generator::NextStateGeneratorOptions compiledGeneratorOptions = generatorOptions;
+    compiledGeneratorOptions.setCompileExpressions();
+
+    for (std::string const& file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm",
+                                    STORM_TEST_RESOURCES_DIR "/dtmc/nand-5-2.pm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm",
+                                    STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ctmc/polling2.sm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+        auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        auto compiledModel = storm::builder::ExplicitModelBuilder<double>(program, compiledGeneratorOptions).build();
+        EXPECT_EQ(model->getNumberOfStates(), compiledModel->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfTransitions(), compiledModel->getNumberOfTransitions());
+        EXPECT_TRUE(model->getTransitionMatrix() == compiledModel->getTransitionMatrix());
+        EXPECT_TRUE(model->getStateLabeling() == compiledModel->getStateLabeling());
+    }
+}
+
 bool trivial_true_mask(storm::expressions::SimpleValuation const&, uint64_t) {
     return true;
 }
@@ -11,6 +11,7 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
@@ -437,6 +438,84 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, BoundedUntilProbabilitiesAtTimePoints) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 3.0);
+    matrixBuilder.addNextValue(0, 2, 0.5);
+    matrixBuilder.addNextValue(1, 0, 2.0);
+    matrixBuilder.addNextValue(1, 3, 1.0);
+    matrixBuilder.addNextValue(2, 0, 4.0);
+    matrixBuilder.addNextValue(3, 1, 1.0);
+    storm::storage::SparseMatrix<double> rateMatrix = matrixBuilder.build();
+    std::vector<double> exitRates = rateMatrix.getRowSumVector();
+
+    storm::storage::BitVector phiStates(4, true);
+    phiStates.set(2, false);
+    storm::storage::BitVector psiStates(4);
+    psiStates.set(3);
+    std::vector<double> timePoints = {0, 0.5, 1, 1, 2.5, 10};
+
+    storm::Environment env;
+    auto curve = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesAtTimePoints(env, rateMatrix, rateMatrix.transpose(),
+                                                                                                                   phiStates, psiStates, exitRates, timePoints);
+    ASSERT_EQ(timePoints.size(), curve.size());
+    for (uint64_t timePointIndex = 0; timePointIndex < timePoints.size(); ++timePointIndex) {
+        std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilities(
+            env, storm::solver::SolveGoal<double>(), rateMatrix, rateMatrix.transpose(), phiStates, psiStates, exitRates, false, 0.0,
+            timePoints[timePointIndex]);
+        ASSERT_EQ(expected.size(), curve[timePointIndex].size());
+        for (uint64_t state = 0; state < expected.size(); ++state) {
+            EXPECT_NEAR(expected[state], curve[timePointIndex][state], 1e-6);
+        }
+    }
+
+    std::vector<double> unsortedTimePoints = {1, 0.5};
+    STORM_SILENT_EXPECT_THROW(storm::modelchecker::helper::SparseCtmcCslHelper::computeBoundedUntilProbabilitiesAtTimePoints(
+                                  env, rateMatrix, rateMatrix.transpose(), phiStates, psiStates, exitRates, unsortedTimePoints),
+                              storm::exceptions::InvalidArgumentException);
+}
+
+TEST(CtmcCslModelCheckerTest, BatchedTransientProbabilities) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 0, 0.25);
+    matrixBuilder.addNextValue(0, 1, 0.75);
+    matrixBuilder.addNextValue(1, 0, 0.5);
+    matrixBuilder.addNextValue(1, 2, 0.25);
+    matrixBuilder.addNextValue(1, 1, 0.25);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    storm::storage::SparseMatrix<double> uniformizedMatrix = matrixBuilder.build();
+
+    std::vector<double> timeBounds = {0.5, 0, 4, 1.5};
+    std::vector<std::vector<double>> values = {{1, 0, 0}, {0.2, 0.3, 0.5}};
+    std::vector<double> addVector = {0.1, 0, 0};
+    double const uniformizationRate = 4;
+    storm::Environment env;
+
+    auto batched = storm::modelchecker::helper::SparseCtmcCslHelper::computeBatchedTransientProbabilities(uniformizedMatrix, &addVector, timeBounds,
+                                                                                                          uniformizationRate, values, 1e-10);
+    auto batchedMixed = storm::modelchecker::helper::SparseCtmcCslHelper::computeBatchedTransientProbabilities<double, true>(
+        uniformizedMatrix, nullptr, timeBounds, uniformizationRate, values, 1e-10);
+    ASSERT_EQ(timeBounds.size(), batched.size());
+    ASSERT_EQ(timeBounds.size(), batchedMixed.size());
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        ASSERT_EQ(values.size(), batched[timeBoundIndex].size());
+        for (uint64_t vectorIndex = 0; vectorIndex < values.size(); ++vectorIndex) {
+            std::vector<double> expected = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(
+                env, uniformizedMatrix, &addVector, timeBounds[timeBoundIndex], uniformizationRate, values[vectorIndex], 1e-10);
+            std::vector<double> expectedMixed = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<double, true>(
+                env, uniformizedMatrix, nullptr, timeBounds[timeBoundIndex], uniformizationRate, values[vectorIndex], 1e-10);
+            for (uint64_t state = 0; state < uniformizedMatrix.getRowCount(); ++state) {
+                EXPECT_NEAR(expected[state], batched[timeBoundIndex][vectorIndex][state], 1e-9);
+                EXPECT_NEAR(expectedMixed[state], batchedMixed[timeBoundIndex][vectorIndex][state], 1e-9);
+            }
+        }
+    }
+
+    STORM_SILENT_EXPECT_THROW((storm::modelchecker::helper::SparseCtmcCslHelper::computeBatchedTransientProbabilities<double, true>(
+                                  uniformizedMatrix, &addVector, timeBounds, uniformizationRate, values, 1e-10)),
+                              storm::exceptions::InvalidArgumentException);
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
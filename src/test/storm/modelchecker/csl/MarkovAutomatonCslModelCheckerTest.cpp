@@ -10,11 +10,13 @@
 #include "storm/api/properties.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
@@ -408,4 +410,51 @@ TYPED_TEST(MarkovAutomatonCslModelCheckerTest, HOASimple) {
         EXPECT_FALSE(checker->canHandle(tasks[0]));
     }
 }
+
+TEST(MarkovAutomatonCslModelCheckerTest, BoundedUntilProbabilitiesAtTimePoints) {
+    // The Markov automaton of simple.ma.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 1.0);
+    matrixBuilder.addNextValue(1, 0, 0.8);
+    matrixBuilder.addNextValue(1, 2, 0.2);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 0.9);
+    matrixBuilder.addNextValue(2, 3, 0.1);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 4, 1.0);
+    matrixBuilder.newRowGroup(4);
+    matrixBuilder.addNextValue(4, 3, 1.0);
+    matrixBuilder.newRowGroup(5);
+    matrixBuilder.addNextValue(5, 4, 1.0);
+    storm::storage::SparseMatrix<double> transitionMatrix = matrixBuilder.build();
+    std::vector<double> exitRates = {0, 10, 12, 1, 1};
+    storm::storage::BitVector markovianStates(5, true);
+    markovianStates.set(0, false);
+    storm::storage::BitVector phiStates(5, true);
+    storm::storage::BitVector psiStates(5);
+    psiStates.set(3);
+    std::vector<double> timePoints = {0, 0.3, 1.3, 1.3, 2};
+
+    storm::Environment env;
+    env.solver().timeBounded().setMaMethod(storm::solver::MaBoundedReachabilityMethod::Imca);
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        auto curve = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesAtTimePoints(
+            env, dir, transitionMatrix, exitRates, markovianStates, phiStates, psiStates, timePoints);
+        ASSERT_EQ(timePoints.size(), curve.size());
+        for (uint64_t timePointIndex = 0; timePointIndex < timePoints.size(); ++timePointIndex) {
+            std::vector<double> expected = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(
+                env, storm::solver::SolveGoal<double>(dir), transitionMatrix, exitRates, markovianStates, phiStates, psiStates,
+                std::make_pair(0.0, timePoints[timePointIndex]));
+            ASSERT_EQ(expected.size(), curve[timePointIndex].size());
+            for (uint64_t state = 0; state < expected.size(); ++state) {
+                EXPECT_NEAR(expected[state], curve[timePointIndex][state], 1e-5);
+            }
+        }
+    }
+    // The value from the simple test above.
+    auto curve = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilitiesAtTimePoints(
+        env, storm::OptimizationDirection::Maximize, transitionMatrix, exitRates, markovianStates, phiStates, psiStates, timePoints);
+    EXPECT_NEAR(0.727468207, curve[2][0], 1e-5);
+}
 }  // namespace
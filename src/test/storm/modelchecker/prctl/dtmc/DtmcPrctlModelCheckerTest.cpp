@@ -8,6 +8,7 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/api/builder.h"
 #include "storm/api/properties.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
@@ -310,6 +311,23 @@ class SparseTopologicalEigenLUEnvironment {
     }
 };
 
+class SparseTopologicalParallelEigenLUEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const DtmcEngine engine = DtmcEngine::PrismSparse;
+    static const bool isExact = true;
+    typedef storm::RationalNumber ValueType;
+    typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().topological().setNumberOfThreads(4);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+};
+
 class HybridSylvanGmmxxGmresEnvironment {
    public:
     static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -557,9 +575,10 @@ typedef ::testing::Types<SparseGmmxxGmresIluEnvironment, JaniSparseGmmxxGmresIlu
                          SparseEigenDGmresEnvironment, SparseEigenDoubleLUEnvironment, SparseEigenRationalLUEnvironment, SparseRationalEliminationEnvironment,
                          SparseNativeJacobiEnvironment, SparseNativeWalkerChaeEnvironment, SparseNativeSorEnvironment, SparseNativePowerEnvironment,
                          SparseNativeSoundValueIterationEnvironment, SparseNativeOptimisticValueIterationEnvironment, SparseNativeIntervalIterationEnvironment,
-                         SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, HybridSylvanGmmxxGmresEnvironment,
-                         HybridCuddNativeJacobiEnvironment, HybridCuddNativeSoundValueIterationEnvironment, HybridSylvanNativeRationalSearchEnvironment,
-                         DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment, DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
+                         SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, SparseTopologicalParallelEigenLUEnvironment,
+                         HybridSylvanGmmxxGmresEnvironment, HybridCuddNativeJacobiEnvironment, HybridCuddNativeSoundValueIterationEnvironment,
+                         HybridSylvanNativeRationalSearchEnvironment, DdSylvanNativePowerEnvironment, JaniDdSylvanNativePowerEnvironment,
+                         DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(DtmcPrctlModelCheckerTest, TestingTypes, );
@@ -640,6 +659,37 @@ TYPED_TEST(DtmcPrctlModelCheckerTest, SynchronousLeader) {
     EXPECT_NEAR(this->parseNumber("25/24"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
 }
 
+TYPED_TEST(DtmcPrctlModelCheckerTest, CrowdsHybridAcyclic) {
+    std::string formulasString = "P=? [F observe0>1]";
+    formulasString += "; P=? [F \"observeIGreater1\"]";
+    formulasString += "; P=? [G !(observe1>1)]";
+
+    auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-4-3.pm", formulasString);
+    auto model = std::move(modelFormulas.first);
+    auto tasks = this->getTasks(modelFormulas.second);
+    auto checker = this->createModelChecker(model);
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+    // Only the hybrid engine makes use of this setting. Few layers are peeled off to make sure that states remain.
+    storm::Environment env = this->env();
+    env.modelchecker().setHybridAcyclicLayers(3);
+
+    result = checker->check(env, tasks[0]);
+    EXPECT_NEAR(this->parseNumber("78686542099694893/1268858272000000000"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+
+    result = checker->check(env, tasks[1]);
+    EXPECT_NEAR(this->parseNumber("40300855878315123/1268858272000000000"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+
+    result = checker->check(env, tasks[2]);
+    EXPECT_NEAR(this->parseNumber("1255424653373894959/1268858272000000000"), this->getQuantitativeResultAtInitialState(model, result),
+                this->precision());
+
+    // With enough layers, the acyclic parts are peeled off completely.
+    env.modelchecker().setHybridAcyclicLayers(1000);
+    result = checker->check(env, tasks[0]);
+    EXPECT_NEAR(this->parseNumber("78686542099694893/1268858272000000000"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+}
+
 TEST(DtmcPrctlModelCheckerTest, AllUntilProbabilities) {
     std::string formulasString = "P=? [F \"one\"]";
     formulasString += "; P=? [F \"two\"]";
@@ -744,6 +794,42 @@ TYPED_TEST(DtmcPrctlModelCheckerTest, LtlProbabilitiesDie) {
 #endif
 }
 
+TYPED_TEST(DtmcPrctlModelCheckerTest, LtlProbabilitiesDieOnTheFly) {
+#ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
+    std::string formulasString = "P=? [(X s>0) U (s=7 & d=2)]";
+    formulasString += "; P=? [ (F (X (s=6 & (XX s=5)))) & (F G (d!=5))]";
+    formulasString += "; P=? [ F s=3 U (\"three\")]";
+    formulasString += "; P=? [ F (s=6) & X \"done\"]";
+
+    auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", formulasString);
+    auto model = std::move(modelFormulas.first);
+    auto tasks = this->getTasks(modelFormulas.second);
+    auto checker = this->createModelChecker(model);
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    storm::Environment env = this->env();
+    env.modelchecker().setLtlOnTheFlyProduct(true);
+
+    // LTL not supported in all engines (Hybrid,  PrismDd, JaniDd)
+    if (TypeParam::engine == DtmcEngine::PrismSparse || TypeParam::engine == DtmcEngine::JaniSparse) {
+        result = checker->check(env, tasks[0]);
+        EXPECT_NEAR(this->parseNumber("1/6"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+
+        result = checker->check(env, tasks[1]);
+        EXPECT_NEAR(this->parseNumber("1/24"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+
+        result = checker->check(env, tasks[2]);
+        EXPECT_NEAR(this->parseNumber("0"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+
+        result = checker->check(env, tasks[3]);
+        EXPECT_NEAR(this->parseNumber("1/6"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+    } else {
+        EXPECT_FALSE(checker->canHandle(tasks[0]));
+    }
+#else
+    GTEST_SKIP();
+#endif
+}
+
 TYPED_TEST(DtmcPrctlModelCheckerTest, LtlProbabilitiesSynchronousLeader) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=? [X (u1=true U \"elected\")]";
@@ -0,0 +1,134 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstring>
+#include <sstream>
+
+#include "storm-parsers/parser/BinaryEncodingParser.h"
+#include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/BinaryEncodingExporter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace {
+std::shared_ptr<storm::models::sparse::Model<double>> exportAndParse(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string& data) {
+    std::stringstream stream;
+    storm::exporter::explicitExportSparseModelBinary(stream, model);
+    data = stream.str();
+    return storm::parser::BinaryEncodingParser<double>::parseModel(data.data(), data.size());
+}
+
+void expectEqualModels(storm::models::sparse::Model<double> const& expected, storm::models::sparse::Model<double> const& actual) {
+    ASSERT_EQ(expected.getType(), actual.getType());
+    EXPECT_TRUE(expected.getTransitionMatrix() == actual.getTransitionMatrix());
+    EXPECT_TRUE(expected.getStateLabeling() == actual.getStateLabeling());
+    ASSERT_EQ(expected.getNumberOfRewardModels(), actual.getNumberOfRewardModels());
+    for (auto const& rewardModel : expected.getRewardModels()) {
+        ASSERT_TRUE(actual.hasRewardModel(rewardModel.first));
+        auto const& actualRewardModel = actual.getRewardModel(rewardModel.first);
+        ASSERT_EQ(rewardModel.second.hasStateRewards(), actualRewardModel.hasStateRewards());
+        if (rewardModel.second.hasStateRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateRewardVector(), actualRewardModel.getStateRewardVector());
+        }
+        ASSERT_EQ(rewardModel.second.hasStateActionRewards(), actualRewardModel.hasStateActionRewards());
+        if (rewardModel.second.hasStateActionRewards()) {
+            EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), actualRewardModel.getStateActionRewardVector());
+        }
+    }
+    ASSERT_EQ(expected.hasChoiceLabeling(), actual.hasChoiceLabeling());
+    if (expected.hasChoiceLabeling()) {
+        EXPECT_TRUE(expected.getChoiceLabeling() == actual.getChoiceLabeling());
+    }
+}
+}  // namespace
+
+TEST(BinaryEncodingParserTest, DtmcRoundTrip) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", options);
+    std::string data;
+    auto parsedModel = exportAndParse(model, data);
+    EXPECT_EQ(8607ul, parsedModel->getNumberOfStates());
+    EXPECT_EQ(15113ul, parsedModel->getNumberOfTransitions());
+    expectEqualModels(*model, *parsedModel);
+}
+
+TEST(BinaryEncodingParserTest, MdpRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string data;
+    auto parsedModel = exportAndParse(model, data);
+    EXPECT_EQ(254ul, parsedModel->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    expectEqualModels(*model, *parsedModel);
+}
+
+TEST(BinaryEncodingParserTest, CtmcRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.drn");
+    std::string data;
+    auto parsedModel = exportAndParse(model, data);
+    expectEqualModels(*model, *parsedModel);
+    EXPECT_EQ(model->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector(),
+              parsedModel->as<storm::models::sparse::Ctmc<double>>()->getExitRateVector());
+}
+
+TEST(BinaryEncodingParserTest, MarkovAutomatonRoundTrip) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/ma/jobscheduler.drn");
+    std::string data;
+    auto parsedModel = exportAndParse(model, data);
+    expectEqualModels(*model, *parsedModel);
+    auto ma = model->as<storm::models::sparse::MarkovAutomaton<double>>();
+    auto parsedMa = parsedModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+    EXPECT_EQ(ma->getExitRates(), parsedMa->getExitRates());
+    EXPECT_EQ(ma->getMarkovianStates(), parsedMa->getMarkovianStates());
+}
+
+TEST(BinaryEncodingParserTest, InvalidData) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string data;
+    exportAndParse(model, data);
+    // Truncated data
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(data.data(), data.size() / 2),
+                              storm::exceptions::WrongFormatException);
+    // Wrong magic
+    data[0] = 'X';
+    STORM_SILENT_EXPECT_THROW(storm::parser::BinaryEncodingParser<double>::parseModel(data.data(), data.size()), storm::exceptions::WrongFormatException);
+}
+
+TEST(BinaryEncodingParserTest, InvalidMatrix) {
+    auto model = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn");
+    std::string validData;
+    exportAndParse(model, validData);
+
+    // Determine the positions of the row indications and the entries of the transition matrix. The matrix follows the header, which
+    // consists of the magic, the version, the byte order mark and the (padded) model type.
+    auto readUint = [&validData](uint64_t offset) {
+        uint64_t value;
+        std::memcpy(&value, validData.data() + offset, sizeof(value));
+        return value;
+    };
+    uint64_t const typeOffset = sizeof(storm::exporter::binaryEncodingMagic) + 16;
+    uint64_t const matrixOffset = typeOffset + 8 + (readUint(typeOffset) + 7) / 8 * 8;
+    uint64_t const columnCount = readUint(matrixOffset);
+    uint64_t const numberOfRowIndications = readUint(matrixOffset + 8);
+    uint64_t const rowIndicationsOffset = matrixOffset + 16;
+    uint64_t const entriesOffset = rowIndicationsOffset + 8 * numberOfRowIndications + 8;
+    ASSERT_EQ(169ul, columnCount);
+    ASSERT_EQ(255ul, numberOfRowIndications);
+    ASSERT_EQ(436ul, readUint(entriesOffset - 8));
+
+    auto parseWithUint = [&validData](uint64_t offset, uint64_t value) {
+        std::string data = validData;
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+        return storm::parser::BinaryEncodingParser<double>::parseModel(data.data(), data.size());
+    };
+    // Decreasing row indications
+    STORM_SILENT_EXPECT_THROW(parseWithUint(rowIndicationsOffset + 8, 436), storm::exceptions::WrongFormatException);
+    // Last row indication does not match the number of entries
+    STORM_SILENT_EXPECT_THROW(parseWithUint(rowIndicationsOffset + 8 * (numberOfRowIndications - 1), 435), storm::exceptions::WrongFormatException);
+    // Column out of range
+    STORM_SILENT_EXPECT_THROW(parseWithUint(entriesOffset, columnCount), storm::exceptions::WrongFormatException);
+    // The unmodified data is valid.
+    EXPECT_EQ(436ul, parseWithUint(entriesOffset - 8, 436)->getNumberOfTransitions());
+}
@@ -87,3 +87,57 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", options);
+    options.numberOfThreads = 4;
+    std::shared_ptr<storm::models::sparse::Model<double>> parallelModel =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", options);
+
+    // Test if both parsers yield the same model.
+    ASSERT_EQ(storm::models::ModelType::Dtmc, parallelModel->getType());
+    ASSERT_EQ(8607ul, parallelModel->getNumberOfStates());
+    ASSERT_EQ(15113ul, parallelModel->getNumberOfTransitions());
+    EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+    EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+    ASSERT_TRUE(parallelModel->hasChoiceLabeling());
+    EXPECT_TRUE(sequentialModel->getChoiceLabeling() == parallelModel->getChoiceLabeling());
+
+    // The number of choices is not declared in this file, so we can not build the choice labeling.
+    options.buildChoiceLabeling = false;
+    std::shared_ptr<storm::models::sparse::Model<double>> mdp =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn", options);
+    ASSERT_EQ(169ul, mdp->getNumberOfStates());
+    ASSERT_EQ(436ul, mdp->getNumberOfTransitions());
+    ASSERT_EQ(254ul, mdp->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    ASSERT_TRUE(mdp->hasRewardModel("coinflips"));
+    ASSERT_TRUE(mdp->getRewardModel("coinflips").hasStateActionRewards());
+}
+
+TEST(DirectEncodingParserTest, UnorderedTransitions) {
+    // Transitions with the same target state are merged and the transitions of each choice are sorted by their target state.
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
+        storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/mdp/unordered_transitions.drn");
+    ASSERT_EQ(storm::models::ModelType::Mdp, modelPtr->getType());
+    ASSERT_EQ(3ul, modelPtr->getNumberOfStates());
+    ASSERT_EQ(4ul, modelPtr->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+    ASSERT_EQ(6ul, modelPtr->getNumberOfTransitions());
+
+    storm::storage::SparseMatrix<double> const& matrix = modelPtr->getTransitionMatrix();
+    EXPECT_EQ(2ul, matrix.getRowGroupSize(0));
+    ASSERT_EQ(2ul, matrix.getRow(0).getNumberOfEntries());
+    EXPECT_EQ(1ul, matrix.getRow(0).begin()->getColumn());
+    EXPECT_EQ(0.5, matrix.getRow(0).begin()->getValue());
+    EXPECT_EQ(2ul, (matrix.getRow(0).begin() + 1)->getColumn());
+    EXPECT_EQ(0.5, (matrix.getRow(0).begin() + 1)->getValue());
+    ASSERT_EQ(1ul, matrix.getRow(1).getNumberOfEntries());
+    EXPECT_EQ(1ul, matrix.getRow(1).begin()->getColumn());
+    EXPECT_EQ(1.0, matrix.getRow(1).begin()->getValue());
+    EXPECT_EQ(2ul, matrix.getRowGroupIndices()[1]);
+    EXPECT_EQ(3ul, matrix.getRowGroupIndices()[2]);
+    EXPECT_EQ(4ul, matrix.getRowGroupIndices()[3]);
+    EXPECT_TRUE(modelPtr->getStates("done").get(1));
+}
@@ -0,0 +1,67 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/properties.h"
+#include "storm/api/simulation.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/simulator/PrismStatisticalModelChecker.h"
+
+TEST(PrismStatisticalModelCheckerTest, KnuthYaoDie) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto labels = program.getLabelToExpressionMapping();
+    storm::expressions::Expression trueExpression = program.getManager().boolean(true);
+
+    storm::simulator::StatisticalModelCheckingOptions options;
+    options.precision = 0.01;
+    options.errorProbability = 0.01;
+    options.seed = 42;
+    storm::simulator::PrismStatisticalModelChecker<double> checker(program, options);
+
+    // After three coin flips, the die has a value with probability 3/4.
+    storm::simulator::StatisticalModelCheckingResult result = checker.computeBoundedUntilProbability(trueExpression, labels.at("done"), 3);
+    EXPECT_EQ(storm::simulator::getNumberOfTracesForChernoffHoeffdingBound(0.01, 0.01), result.numberOfTraces);
+    EXPECT_NEAR(0.75, result.estimate, options.precision);
+
+    // The value 1 can not be obtained with fewer than three coin flips.
+    result = checker.computeBoundedUntilProbability(trueExpression, labels.at("one"), 2);
+    EXPECT_EQ(0ul, result.numberOfSuccessfulTraces);
+
+    // Traces stop as soon as phi is violated, which happens once the die shows any value but 1.
+    result = checker.computeBoundedUntilProbability(!labels.at("done") || labels.at("one"), labels.at("one"), 100);
+    EXPECT_NEAR(1.0 / 6.0, result.estimate, options.precision);
+
+    // The result must not depend on the number of threads.
+    options.numberOfThreads = 4;
+    storm::simulator::PrismStatisticalModelChecker<double> parallelChecker(program, options);
+    storm::simulator::StatisticalModelCheckingResult parallelResult =
+        parallelChecker.computeBoundedUntilProbability(!labels.at("done") || labels.at("one"), labels.at("one"), 100);
+    EXPECT_EQ(result.numberOfTraces, parallelResult.numberOfTraces);
+    EXPECT_EQ(result.numberOfSuccessfulTraces, parallelResult.numberOfSuccessfulTraces);
+}
+
+TEST(PrismStatisticalModelCheckerTest, TwoDiceApi) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [!\"done\" U<=200 \"two\"]; P=? [F \"two\"]", program));
+
+    storm::simulator::StatisticalModelCheckingOptions options;
+    options.precision = 0.02;
+    options.stoppingRule = storm::simulator::StoppingRule::Sequential;
+    options.batchSize = 1000;
+    options.seed = 7;
+
+    // Irrespective of the scheduler, both dice are thrown eventually and the sum two has probability 1/36.
+    storm::simulator::StatisticalModelCheckingResult result = storm::api::estimateWithStatisticalModelChecking<double>(program, formulas[0], options);
+    EXPECT_NEAR(1.0 / 36.0, result.estimate, options.precision);
+
+    STORM_SILENT_EXPECT_THROW(storm::api::estimateWithStatisticalModelChecking<double>(program, formulas[1], options),
+                              storm::exceptions::NotSupportedException);
+}
+
+TEST(PrismStatisticalModelCheckerTest, RejectsContinuousTimePrograms) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/simple2.sm");
+    STORM_SILENT_EXPECT_THROW(storm::simulator::PrismStatisticalModelChecker<double> checker(program), storm::exceptions::InvalidArgumentException);
+}
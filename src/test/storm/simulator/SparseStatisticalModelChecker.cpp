@@ -0,0 +1,143 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cmath>
+
+#include "storm-parsers/api/properties.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/properties.h"
+#include "storm/api/simulation.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/simulator/SparseStatisticalModelChecker.h"
+
+TEST(SparseStatisticalModelCheckerTest, KnuthYaoDieChernoffHoeffding) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    ASSERT_EQ(storm::models::ModelType::Dtmc, model->getType());
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+
+    storm::simulator::StatisticalModelCheckingOptions options;
+    options.precision = 0.01;
+    options.errorProbability = 0.01;
+    options.seed = 42;
+    storm::simulator::SparseStatisticalModelChecker<double> checker(*model, options);
+
+    // After three coin flips, the die has a value with probability 3/4.
+    storm::simulator::StatisticalModelCheckingResult result = checker.computeBoundedUntilProbability(allStates, model->getStates("done"), 3);
+    EXPECT_EQ(storm::simulator::SparseStatisticalModelChecker<double>::getNumberOfTracesForChernoffHoeffdingBound(0.01, 0.01), result.numberOfTraces);
+    EXPECT_NEAR(0.75, result.estimate, options.precision);
+
+    result = checker.computeBoundedUntilProbability(allStates, model->getStates("one"), 100);
+    EXPECT_NEAR(1.0 / 6.0, result.estimate, options.precision);
+
+    // The value 1 can not be obtained with fewer than three coin flips.
+    result = checker.computeBoundedUntilProbability(allStates, model->getStates("one"), 2);
+    EXPECT_EQ(0ul, result.numberOfSuccessfulTraces);
+
+    // The result must not depend on the number of threads.
+    options.numberOfThreads = 4;
+    storm::simulator::SparseStatisticalModelChecker<double> parallelChecker(*model, options);
+    storm::simulator::StatisticalModelCheckingResult parallelResult = parallelChecker.computeBoundedUntilProbability(allStates, model->getStates("one"), 100);
+    result = checker.computeBoundedUntilProbability(allStates, model->getStates("one"), 100);
+    EXPECT_EQ(result.numberOfTraces, parallelResult.numberOfTraces);
+    EXPECT_EQ(result.numberOfSuccessfulTraces, parallelResult.numberOfSuccessfulTraces);
+}
+
+TEST(SparseStatisticalModelCheckerTest, KnuthYaoDieSequential) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+
+    storm::simulator::StatisticalModelCheckingOptions options;
+    options.precision = 0.01;
+    options.errorProbability = 0.01;
+    options.stoppingRule = storm::simulator::StoppingRule::Sequential;
+    options.batchSize = 1000;
+    options.numberOfThreads = 4;
+    options.seed = 42;
+    storm::simulator::SparseStatisticalModelChecker<double> checker(*model, options);
+
+    // The sequential rule exploits the variance being smaller than the worst case assumed by the Chernoff-Hoeffding bound.
+    storm::simulator::StatisticalModelCheckingResult result = checker.computeBoundedUntilProbability(allStates, model->getStates("one"), 100);
+    EXPECT_LT(result.numberOfTraces, storm::simulator::SparseStatisticalModelChecker<double>::getNumberOfTracesForChernoffHoeffdingBound(0.01, 0.01));
+    EXPECT_EQ(0ul, result.numberOfTraces % options.batchSize);
+    EXPECT_NEAR(1.0 / 6.0, result.estimate, options.precision);
+}
+
+TEST(SparseStatisticalModelCheckerTest, KnuthYaoDieSequentialErrorProbability) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+
+    storm::simulator::StatisticalModelCheckingOptions options;
+    options.precision = 0.02;
+    options.errorProbability = 0.1;
+    options.stoppingRule = storm::simulator::StoppingRule::Sequential;
+    options.batchSize = 200;
+
+    // Although the estimate is inspected after every batch, it may only miss the actual value for a fraction of the seeds
+    // that is bounded by the error probability.
+    uint64_t const numberOfSeeds = 100;
+    uint64_t numberOfMisses = 0;
+    for (uint64_t seed = 0; seed < numberOfSeeds; ++seed) {
+        options.seed = seed;
+        storm::simulator::SparseStatisticalModelChecker<double> checker(*model, options);
+        storm::simulator::StatisticalModelCheckingResult result = checker.computeBoundedUntilProbability(allStates, model->getStates("one"), 100);
+        if (std::abs(result.estimate - 1.0 / 6.0) > options.precision) {
+            ++numberOfMisses;
+        }
+    }
+    EXPECT_LE(numberOfMisses, static_cast<uint64_t>(options.errorProbability * numberOfSeeds));
+}
+
+TEST(SparseStatisticalModelCheckerTest, TwoDiceUniformScheduler) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    ASSERT_EQ(storm::models::ModelType::Mdp, model->getType());
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+
+    storm::simulator::StatisticalModelCheckingOptions options;
+    options.precision = 0.01;
+    options.seed = 7;
+    // Sample all successors via alias tables.
+    options.minimalRowLengthForAliasTables = 2;
+    storm::simulator::SparseStatisticalModelChecker<double> checker(*model, options);
+
+    // Irrespective of the scheduler, both dice are thrown eventually and the sum two has probability 1/36.
+    storm::simulator::StatisticalModelCheckingResult result = checker.computeBoundedUntilProbability(allStates, model->getStates("two"), 200);
+    EXPECT_NEAR(1.0 / 36.0, result.estimate, options.precision);
+}
+
+TEST(SparseStatisticalModelCheckerTest, Api) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F<=3 \"done\"]; P=? [F \"done\"]", program));
+
+    storm::simulator::StatisticalModelCheckingOptions options;
+    options.seed = 42;
+    storm::simulator::StatisticalModelCheckingResult result = storm::api::estimateWithStatisticalModelChecking(model, formulas[0], options);
+    EXPECT_NEAR(0.75, result.estimate, options.precision);
+
+    // Unbounded properties can not be estimated from finite traces.
+    STORM_SILENT_EXPECT_THROW(storm::api::estimateWithStatisticalModelChecking(model, formulas[1], options), storm::exceptions::NotSupportedException);
+}
+
+TEST(SparseStatisticalModelCheckerTest, RejectsContinuousTimeModels) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/simple2.sm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    ASSERT_EQ(storm::models::ModelType::Ctmc, model->getType());
+    STORM_SILENT_EXPECT_THROW(storm::simulator::SparseStatisticalModelChecker<double> checker(*model), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(SparseStatisticalModelCheckerTest, RejectsModelsWithoutInitialState) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(1, 1, 1);
+    matrixBuilder.addNextValue(0, 0, 1.0);
+    storm::models::sparse::StateLabeling labeling(1);
+    labeling.addLabel("init");
+    storm::models::sparse::Dtmc<double> model(matrixBuilder.build(), std::move(labeling));
+    STORM_SILENT_EXPECT_THROW(storm::simulator::SparseStatisticalModelChecker<double> checker(model), storm::exceptions::InvalidArgumentException);
+}
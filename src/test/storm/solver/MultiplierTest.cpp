@@ -3,6 +3,7 @@
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/multiplier/SimdMultiplier.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/utility/vector.h"
@@ -30,6 +31,17 @@ class GmmxxEnvironment {
     }
 };
 
+class SimdEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+        return env;
+    }
+};
+
 template<typename TestType>
 class MultiplierTest : public ::testing::Test {
    public:
@@ -49,7 +61,7 @@ class MultiplierTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment> TestingTypes;
+typedef ::testing::Types<NativeEnvironment, GmmxxEnvironment, SimdEnvironment> TestingTypes;
 
 TYPED_TEST_SUITE(MultiplierTest, TestingTypes, );
 
@@ -123,4 +135,72 @@ TYPED_TEST(MultiplierTest, repeatedMultiplyAndReduceTest) {
     EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
 }
 
-}  // namespace
\ No newline at end of file
+TEST(SimdMultiplierTest, KernelsMatchNativeMultiplier) {
+    // Create an MDP-like matrix with row groups and rows of various lengths, such that both vectorized and remaining entries occur.
+    uint64_t const numberOfGroups = 100;
+    storm::storage::SparseMatrixBuilder<double> builder(0, numberOfGroups, 0, false, true);
+    uint64_t row = 0;
+    for (uint64_t group = 0; group < numberOfGroups; ++group) {
+        builder.newRowGroup(row);
+        for (uint64_t choice = 0; choice <= group % 3; ++choice, ++row) {
+            uint64_t const rowLength = 1 + (group * 7 + choice * 3) % 19;
+            for (uint64_t entry = 0; entry < rowLength; ++entry) {
+                builder.addNextValue(row, (group + entry * 5) % numberOfGroups, 1.0 / rowLength);
+            }
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    std::vector<double> x(numberOfGroups);
+    for (uint64_t i = 0; i < numberOfGroups; ++i) {
+        x[i] = static_cast<double>((i * 13) % numberOfGroups) / numberOfGroups;
+    }
+    std::vector<double> b(A.getRowCount(), 0.125);
+
+    storm::Environment env;
+    storm::solver::NativeMultiplier<double> nativeMultiplier(A);
+    storm::solver::SimdMultiplier<double> simdMultiplier(A);
+
+    std::vector<storm::solver::simd::InstructionSet> instructionSets = {storm::solver::simd::InstructionSet::Scalar};
+    if (storm::solver::simd::getSupportedInstructionSet() >= storm::solver::simd::InstructionSet::Avx2) {
+        instructionSets.push_back(storm::solver::simd::InstructionSet::Avx2);
+    }
+    if (storm::solver::simd::getSupportedInstructionSet() >= storm::solver::simd::InstructionSet::Avx512) {
+        instructionSets.push_back(storm::solver::simd::InstructionSet::Avx512);
+    }
+
+    std::vector<double> expected(A.getRowCount());
+    nativeMultiplier.multiply(env, x, &b, expected);
+    std::vector<double> expectedReduced(numberOfGroups);
+    std::vector<uint64_t> expectedChoices(numberOfGroups, 0);
+    nativeMultiplier.multiplyAndReduce(env, storm::OptimizationDirection::Maximize, A.getRowGroupIndices(), x, &b, expectedReduced, &expectedChoices);
+
+    for (auto instructionSet : instructionSets) {
+        simdMultiplier.setInstructionSet(instructionSet);
+        bool const scalar = instructionSet == storm::solver::simd::InstructionSet::Scalar;
+
+        std::vector<double> result(A.getRowCount());
+        simdMultiplier.multiply(env, x, &b, result);
+        for (uint64_t i = 0; i < result.size(); ++i) {
+            if (scalar) {
+                EXPECT_EQ(expected[i], result[i]);
+            } else {
+                EXPECT_NEAR(expected[i], result[i], 1e-14);
+            }
+        }
+
+        std::vector<double> reduced(numberOfGroups);
+        std::vector<uint64_t> choices(numberOfGroups, 0);
+        simdMultiplier.multiplyAndReduce(env, storm::OptimizationDirection::Maximize, A.getRowGroupIndices(), x, &b, reduced, &choices);
+        for (uint64_t i = 0; i < numberOfGroups; ++i) {
+            if (scalar) {
+                EXPECT_EQ(expectedReduced[i], reduced[i]);
+                EXPECT_EQ(expectedChoices[i], choices[i]);
+            } else {
+                EXPECT_NEAR(expectedReduced[i], reduced[i], 1e-14);
+            }
+        }
+    }
+}
+
+}  // namespace
@@ -0,0 +1,78 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/AutoParser.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
+#include "storm/storage/FlexibleSparseMatrix.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/stateelimination.h"
+
+namespace {
+
+class StateEliminationTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::shared_ptr<storm::models::sparse::Model<double>> model =
+            storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/crowds5_5.tra", STORM_TEST_RESOURCES_DIR "/lab/crowds5_5.lab", "", "");
+        ASSERT_EQ(model->getType(), storm::models::ModelType::Dtmc);
+        std::shared_ptr<storm::models::sparse::Dtmc<double>> dtmc = model->as<storm::models::sparse::Dtmc<double>>();
+
+        // Set up the equation system for the probability to reach the target states.
+        storm::storage::BitVector psiStates = dtmc->getStates("observe0Greater1");
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(
+            dtmc->getBackwardTransitions(), storm::storage::BitVector(dtmc->getNumberOfStates(), true), psiStates);
+        storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+        matrix = dtmc->getTransitionMatrix().getSubmatrix(false, maybeStates, maybeStates);
+        b = dtmc->getTransitionMatrix().getConstrainedRowSumVector(maybeStates, statesWithProbability01.second);
+    }
+
+    std::vector<double> eliminate(std::vector<storm::storage::sparse::state_type> const& order, uint64_t numberOfThreads) {
+        storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+        storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+        std::vector<double> x = b;
+        storm::solver::stateelimination::PrioritizedStateEliminator<double> eliminator(flexibleMatrix, flexibleBackwardTransitions, order, x);
+        eliminator.eliminateAll([](storm::storage::sparse::state_type const&) { return false; }, numberOfThreads);
+        return x;
+    }
+
+    storm::storage::SparseMatrix<double> matrix;
+    std::vector<double> b;
+};
+
+TEST_F(StateEliminationTest, ApproximateMinimumDegreeOrder) {
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    storm::storage::BitVector allStates(matrix.getRowCount(), true);
+
+    std::vector<storm::storage::sparse::state_type> order =
+        storm::utility::stateelimination::computeApproximateMinimumDegreeOrder(flexibleMatrix, flexibleBackwardTransitions, allStates);
+    ASSERT_EQ(matrix.getRowCount(), order.size());
+    storm::storage::BitVector orderedStates(matrix.getRowCount());
+    for (auto state : order) {
+        EXPECT_FALSE(orderedStates.get(state));
+        orderedStates.set(state);
+    }
+
+    std::vector<storm::storage::sparse::state_type> naturalOrder(allStates.begin(), allStates.end());
+    std::vector<double> expected = eliminate(naturalOrder, 1);
+    std::vector<double> result = eliminate(order, 1);
+    for (uint64_t state = 0; state < result.size(); ++state) {
+        EXPECT_NEAR(expected[state], result[state], 1e-9);
+    }
+}
+
+TEST_F(StateEliminationTest, EliminateInBatches) {
+    storm::storage::FlexibleSparseMatrix<double> flexibleMatrix(matrix);
+    storm::storage::FlexibleSparseMatrix<double> flexibleBackwardTransitions(matrix.transpose(), true);
+    std::vector<storm::storage::sparse::state_type> order = storm::utility::stateelimination::computeApproximateMinimumDegreeOrder(
+        flexibleMatrix, flexibleBackwardTransitions, storm::storage::BitVector(matrix.getRowCount(), true));
+
+    // Eliminating independent states concurrently must not change the result at all.
+    std::vector<double> expected = eliminate(order, 1);
+    std::vector<double> result = eliminate(order, 4);
+    EXPECT_EQ(expected, result);
+}
+
+}  // namespace
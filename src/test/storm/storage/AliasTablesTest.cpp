@@ -0,0 +1,61 @@
+#include "test/storm_gtest.h"
+
+#include "storm/storage/AliasTables.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+storm::storage::SparseMatrix<double> createMatrix() {
+    // A row with ten distinct probabilities, a row with two entries and a row with twelve equal probabilities.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 12, 24);
+    for (uint64_t column = 0; column < 10; ++column) {
+        matrixBuilder.addNextValue(0, column, static_cast<double>(column + 1) / 55.0);
+    }
+    matrixBuilder.addNextValue(1, 0, 0.3);
+    matrixBuilder.addNextValue(1, 1, 0.7);
+    for (uint64_t column = 0; column < 12; ++column) {
+        matrixBuilder.addNextValue(2, column, 1.0 / 12.0);
+    }
+    return matrixBuilder.build();
+}
+}  // namespace
+
+TEST(AliasTables, Distribution) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    storm::storage::AliasTables<double> aliasTables(matrix, 2);
+    EXPECT_EQ(3ul, aliasTables.getNumberOfTables());
+
+    // Sampling on an equidistant grid must reproduce the probabilities up to the resolution of the grid.
+    uint64_t const numberOfSamples = 100000;
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        ASSERT_TRUE(aliasTables.hasTable(row));
+        std::vector<uint64_t> counts(matrix.getRow(row).getNumberOfEntries(), 0);
+        for (uint64_t sample = 0; sample < numberOfSamples; ++sample) {
+            uint64_t offset = aliasTables.sample(row, (static_cast<double>(sample) + 0.5) / static_cast<double>(numberOfSamples));
+            ASSERT_LT(offset, counts.size());
+            ++counts[offset];
+        }
+        uint64_t offset = 0;
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_NEAR(entry.getValue(), static_cast<double>(counts[offset]) / static_cast<double>(numberOfSamples), 1e-3);
+            ++offset;
+        }
+    }
+}
+
+TEST(AliasTables, MemoryBound) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+
+    // Only long rows get a table.
+    storm::storage::AliasTables<double> longRows(matrix, 8);
+    EXPECT_EQ(2ul, longRows.getNumberOfTables());
+    EXPECT_TRUE(longRows.hasTable(0));
+    EXPECT_FALSE(longRows.hasTable(1));
+    EXPECT_TRUE(longRows.hasTable(2));
+
+    // The longest row is preferred, rows that do not fit any more are skipped.
+    storm::storage::AliasTables<double> boundedTables(matrix, 2, 14);
+    EXPECT_EQ(2ul, boundedTables.getNumberOfTables());
+    EXPECT_FALSE(boundedTables.hasTable(0));
+    EXPECT_TRUE(boundedTables.hasTable(1));
+    EXPECT_TRUE(boundedTables.hasTable(2));
+}
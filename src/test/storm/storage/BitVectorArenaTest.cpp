@@ -0,0 +1,105 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorArena.h"
+
+namespace {
+storm::storage::BitVector createBitVector(uint64_t length, uint64_t seed) {
+    storm::storage::BitVector result(length);
+    for (uint64_t index = seed % 7; index < length; index += 3 + seed % 5) {
+        result.set(index);
+    }
+    return result;
+}
+}  // namespace
+
+TEST(BitVectorArenaTest, AddAndGet) {
+    storm::storage::BitVectorArena arena(100, 4);
+
+    std::vector<uint64_t> offsets;
+    for (uint64_t seed = 0; seed < 10; ++seed) {
+        offsets.push_back(arena.add(createBitVector(100, seed)));
+    }
+    EXPECT_EQ(10ul, arena.size());
+    EXPECT_EQ(10ul, arena.getNumberOfUnreleasedEntries());
+    EXPECT_EQ(3ul, arena.getNumberOfAllocatedSlabs());
+
+    storm::storage::BitVector result(100);
+    for (uint64_t seed = 0; seed < 10; ++seed) {
+        EXPECT_EQ(seed, offsets[seed]);
+        arena.get(offsets[seed], result);
+        EXPECT_EQ(createBitVector(100, seed), result);
+        EXPECT_EQ(createBitVector(100, seed), arena.get(offsets[seed]));
+    }
+
+    // A bit vector of a different length is resized.
+    storm::storage::BitVector other(17, true);
+    arena.get(offsets[3], other);
+    EXPECT_EQ(createBitVector(100, 3), other);
+}
+
+TEST(BitVectorArenaTest, ReuseSlabs) {
+    storm::storage::BitVectorArena arena(128, 4);
+
+    // Use the arena as a queue, which only ever holds a few bit vectors at a time.
+    std::deque<std::pair<uint64_t, uint64_t>> queue;
+    storm::storage::BitVector result(128);
+    for (uint64_t seed = 0; seed < 100; ++seed) {
+        queue.emplace_back(arena.add(createBitVector(128, seed)), seed);
+        if (seed >= 5) {
+            arena.get(queue.front().first, result);
+            EXPECT_EQ(createBitVector(128, queue.front().second), result);
+            arena.release(queue.front().first);
+            queue.pop_front();
+        }
+    }
+    EXPECT_LE(arena.size(), 6ul);
+    EXPECT_EQ(5ul, arena.getNumberOfUnreleasedEntries());
+    EXPECT_LE(arena.getNumberOfAllocatedSlabs(), 2ul);
+
+    // Release the bit vectors in reverse order.
+    while (!queue.empty()) {
+        arena.get(queue.back().first, result);
+        EXPECT_EQ(createBitVector(128, queue.back().second), result);
+        arena.release(queue.back().first);
+        queue.pop_back();
+    }
+    EXPECT_EQ(0ul, arena.getNumberOfUnreleasedEntries());
+
+    // After clearing, the offsets start at zero again and the slabs are reused.
+    uint64_t allocatedSlabs = arena.getNumberOfAllocatedSlabs();
+    arena.clear();
+    EXPECT_EQ(0ul, arena.size());
+    EXPECT_EQ(0ul, arena.add(createBitVector(128, 42)));
+    EXPECT_EQ(createBitVector(128, 42), arena.get(0));
+    EXPECT_EQ(allocatedSlabs, arena.getNumberOfAllocatedSlabs());
+}
+
+TEST(BitVectorArenaTest, ReuseReleasedEntries) {
+    storm::storage::BitVectorArena arena(100, 4);
+
+    // Use the arena as a stack (as in a depth-first search) that never holds more than ten bit vectors. Every slab
+    // keeps some unreleased bit vectors, so the released entries have to be reused within the slabs.
+    std::vector<std::pair<uint64_t, uint64_t>> stack;
+    storm::storage::BitVector result(100);
+    for (uint64_t seed = 0; seed < 1000; ++seed) {
+        if (stack.size() == 10 || (seed % 3 == 2 && !stack.empty())) {
+            arena.get(stack.back().first, result);
+            EXPECT_EQ(createBitVector(100, stack.back().second), result);
+            arena.release(stack.back().first);
+            stack.pop_back();
+        }
+        stack.emplace_back(arena.add(createBitVector(100, seed)), seed);
+        EXPECT_EQ(stack.size(), arena.getNumberOfUnreleasedEntries());
+    }
+    EXPECT_LE(arena.size(), 10ul);
+    EXPECT_LE(arena.getNumberOfAllocatedSlabs(), 3ul);
+    for (auto const& offsetSeedPair : stack) {
+        EXPECT_EQ(createBitVector(100, offsetSeedPair.second), arena.get(offsetSeedPair.first));
+    }
+}
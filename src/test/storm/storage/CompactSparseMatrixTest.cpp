@@ -0,0 +1,124 @@
+#include "test/storm_gtest.h"
+
+#include <limits>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/CompactSparseMatrix.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+storm::storage::SparseMatrix<double> createMatrix() {
+    // Three row groups with 2, 1 and 2 rows, respectively.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9, true, true, 3);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 1, 1.0);
+    matrixBuilder.addNextValue(0, 2, 1.2);
+    matrixBuilder.addNextValue(1, 0, 0.5);
+    matrixBuilder.addNextValue(1, 1, 0.7);
+    matrixBuilder.newRowGroup(2);
+    matrixBuilder.addNextValue(2, 0, 0.5);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 2, 1.1);
+    matrixBuilder.addNextValue(4, 0, 0.1);
+    matrixBuilder.addNextValue(4, 1, 0.2);
+    matrixBuilder.addNextValue(4, 3, 0.3);
+    return matrixBuilder.build();
+}
+}  // namespace
+
+TEST(CompactSparseMatrix, Iteration) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    EXPECT_EQ(matrix.getRowCount(), compactMatrix.getRowCount());
+    EXPECT_EQ(matrix.getColumnCount(), compactMatrix.getColumnCount());
+    EXPECT_EQ(matrix.getEntryCount(), compactMatrix.getEntryCount());
+    EXPECT_EQ(matrix.getRowGroupCount(), compactMatrix.getRowGroupCount());
+    EXPECT_EQ(matrix.getRowGroupIndices(), compactMatrix.getRowGroupIndices());
+    EXPECT_FALSE(compactMatrix.hasTrivialRowGrouping());
+
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto compactRow = compactMatrix.getRow(row);
+        EXPECT_EQ(matrix.getRow(row).getNumberOfEntries(), compactRow.getNumberOfEntries());
+        auto compactIt = compactRow.begin();
+        for (auto const& entry : matrix.getRow(row)) {
+            ASSERT_TRUE(compactIt != compactRow.end());
+            EXPECT_EQ(entry.getColumn(), (*compactIt).getColumn());
+            EXPECT_EQ(entry.getValue(), (*compactIt).getValue());
+            ++compactIt;
+        }
+        EXPECT_TRUE(compactIt == compactRow.end());
+    }
+
+    uint64_t entriesInLastGroup = 0;
+    for (auto const& entry : compactMatrix.getRowGroup(2)) {
+        EXPECT_LT(entry.getColumn(), 4ul);
+        ++entriesInLastGroup;
+    }
+    EXPECT_EQ(4ul, entriesInLastGroup);
+
+    // 32 bit column indices save a third of the memory for the entries.
+    EXPECT_LT(compactMatrix.getSizeInMemory(), storm::storage::CompactSparseMatrix<double, uint64_t>(matrix).getSizeInMemory());
+}
+
+TEST(CompactSparseMatrix, MatrixVectorMultiply) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    std::vector<double> x = {1, 0.3, 1.4, 7.1};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5};
+    std::vector<double> expected(matrix.getRowCount());
+    std::vector<double> result(matrix.getRowCount());
+
+    matrix.multiplyWithVector(x, expected);
+    compactMatrix.multiplyWithVector(x, result);
+    EXPECT_EQ(expected, result);
+
+    matrix.multiplyWithVector(x, expected, &b);
+    compactMatrix.multiplyWithVector(x, result, &b);
+    EXPECT_EQ(expected, result);
+}
+
+TEST(CompactSparseMatrix, MultiplyAndReduce) {
+    storm::storage::SparseMatrix<double> matrix = createMatrix();
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+
+    std::vector<double> x = {1, 0.3, 1.4, 7.1};
+    std::vector<double> b = {0.1, 0.2, 0.3, 0.4, 0.5};
+    for (auto dir : {storm::solver::OptimizationDirection::Minimize, storm::solver::OptimizationDirection::Maximize}) {
+        std::vector<double> expected(matrix.getRowGroupCount());
+        std::vector<double> result(matrix.getRowGroupCount());
+        std::vector<uint64_t> expectedChoices(matrix.getRowGroupCount(), 0);
+        std::vector<uint64_t> choices(matrix.getRowGroupCount(), 0);
+
+        matrix.multiplyAndReduce(dir, matrix.getRowGroupIndices(), x, &b, expected, &expectedChoices);
+        compactMatrix.multiplyAndReduce(dir, compactMatrix.getRowGroupIndices(), x, &b, result, &choices);
+        EXPECT_EQ(expected, result);
+        EXPECT_EQ(expectedChoices, choices);
+    }
+}
+
+TEST(CompactSparseMatrix, ColumnRange) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(1, 300, 1);
+    matrixBuilder.addNextValue(0, 299, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    EXPECT_TRUE((storm::storage::CompactSparseMatrix<double, uint32_t>::canRepresent(matrix)));
+    storm::storage::CompactSparseMatrix<double> compactMatrix(matrix);
+    EXPECT_EQ(299ul, (*compactMatrix.getRow(0).begin()).getColumn());
+
+    storm::storage::SparseMatrix<double> emptyMatrix;
+    EXPECT_TRUE((storm::storage::CompactSparseMatrix<double, uint32_t>::canRepresent(emptyMatrix)));
+
+    // Column indices beyond the 32 bit range require the wide index type.
+    uint64_t const wideColumn = static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) + 1;
+    storm::storage::SparseMatrixBuilder<double> wideMatrixBuilder(1, wideColumn + 1, 1);
+    wideMatrixBuilder.addNextValue(0, wideColumn, 1.0);
+    storm::storage::SparseMatrix<double> wideMatrix = wideMatrixBuilder.build();
+
+    EXPECT_FALSE((storm::storage::CompactSparseMatrix<double, uint32_t>::canRepresent(wideMatrix)));
+    STORM_SILENT_EXPECT_THROW(storm::storage::CompactSparseMatrix<double> narrowMatrix(wideMatrix), storm::exceptions::InvalidArgumentException);
+    EXPECT_TRUE((storm::storage::CompactSparseMatrix<double, uint64_t>::canRepresent(wideMatrix)));
+    storm::storage::CompactSparseMatrix<double, uint64_t> wideCompactMatrix(wideMatrix);
+    EXPECT_EQ(wideColumn, (*wideCompactMatrix.getRow(0).begin()).getColumn());
+}
@@ -0,0 +1,88 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+namespace {
+storm::storage::BitVector createKey(uint64_t number) {
+    storm::storage::BitVector result(128);
+    result.setFromInt(0, 64, number);
+    result.setFromInt(64, 64, number * 31 + 7);
+    return result;
+}
+}  // namespace
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    // Use a small initial size such that the segments have to grow.
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 3, 4);
+    EXPECT_EQ(4ul, map.getNumberOfSegments());
+
+    for (uint64_t number = 0; number < 1000; ++number) {
+        EXPECT_EQ(number, map.findOrAdd(createKey(number), number));
+    }
+    EXPECT_EQ(1000ul, map.size());
+
+    for (uint64_t number = 0; number < 1000; ++number) {
+        EXPECT_EQ(number, map.findOrAdd(createKey(number), 0));
+        EXPECT_TRUE(map.contains(createKey(number)));
+        EXPECT_EQ(number, map.getValue(createKey(number)));
+    }
+    EXPECT_FALSE(map.contains(createKey(1000)));
+    EXPECT_FALSE(map.find(createKey(1001)).first);
+
+    auto flagValuePair = map.findOrAddWith(createKey(1000), []() { return 42ul; });
+    EXPECT_TRUE(flagValuePair.second);
+    EXPECT_EQ(42ul, flagValuePair.first);
+    flagValuePair = map.findOrAddWith(createKey(1000), []() { return 43ul; });
+    EXPECT_FALSE(flagValuePair.second);
+    EXPECT_EQ(42ul, flagValuePair.first);
+
+    auto sequentialMap = map.toBitVectorHashMap();
+    EXPECT_EQ(1001ul, sequentialMap.size());
+    EXPECT_EQ(42ul, sequentialMap.getValue(createKey(1000)));
+    EXPECT_EQ(17ul, sequentialMap.getValue(createKey(17)));
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 10, 8);
+    std::atomic<uint32_t> nextIndex(0);
+    uint64_t const numberOfKeys = 20000;
+    uint64_t const numberOfThreads = 4;
+
+    // All threads insert the same keys (in different orders), so every key has to be inserted exactly once.
+    std::vector<std::vector<uint32_t>> indices(numberOfThreads, std::vector<uint32_t>(numberOfKeys));
+    std::vector<uint64_t> insertions(numberOfThreads, 0);
+    std::vector<std::thread> threads;
+    for (uint64_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex) {
+        threads.emplace_back([&, threadIndex]() {
+            for (uint64_t step = 0; step < numberOfKeys; ++step) {
+                uint64_t number = (threadIndex % 2 == 0) ? step : numberOfKeys - 1 - step;
+                auto indexInsertedPair = map.findOrAddWith(createKey(number), [&nextIndex]() { return nextIndex++; });
+                indices[threadIndex][number] = indexInsertedPair.first;
+                if (indexInsertedPair.second) {
+                    ++insertions[threadIndex];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    EXPECT_EQ(numberOfKeys, nextIndex.load());
+    uint64_t totalInsertions = 0;
+    for (uint64_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex) {
+        totalInsertions += insertions[threadIndex];
+        EXPECT_EQ(indices.front(), indices[threadIndex]);
+    }
+    EXPECT_EQ(numberOfKeys, totalInsertions);
+    for (uint64_t number = 0; number < numberOfKeys; ++number) {
+        EXPECT_EQ(indices.front()[number], map.getValue(createKey(number)));
+    }
+}
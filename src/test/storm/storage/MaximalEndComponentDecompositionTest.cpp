@@ -1,3 +1,5 @@
+#include <random>
+
 #include "storm-config.h"
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm-parsers/parser/PrismParser.h"
@@ -6,6 +8,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "test/storm_gtest.h"
 
@@ -179,3 +182,77 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, RefineSubsystem) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel =
+        storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/tiny1.tra", STORM_TEST_RESOURCES_DIR "/lab/tiny1.lab", "", "");
+
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> markovAutomaton = abstractModel->as<storm::models::sparse::MarkovAutomaton<double>>();
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(*markovAutomaton);
+    ASSERT_EQ(2ul, mecDecomposition.size());
+
+    storm::storage::BitVector removedStates(markovAutomaton->getNumberOfStates(), false);
+    removedStates.set(7, true);
+    storm::storage::BitVector removedChoices(markovAutomaton->getNumberOfChoices(), false);
+    ASSERT_NO_THROW(mecDecomposition.refine(markovAutomaton->getTransitionMatrix(), removedStates, removedChoices));
+
+    ASSERT_EQ(1ul, mecDecomposition.size());
+    EXPECT_TRUE((mecDecomposition[0].getStateSet() == storm::storage::MaximalEndComponent::set_type{3, 8, 9, 10}));
+}
+
+TEST(MaximalEndComponentDecomposition, RefineRandomSystem) {
+    // Build a system whose states are grouped in blocks of ten. The first two choices of each state stay in its
+    // block, the third one leads to a random state.
+    uint64_t const numberOfStates = 5000;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t blockStart = state - state % 10;
+        matrixBuilder.newRowGroup(3 * state);
+        matrixBuilder.addNextValue(3 * state, std::min(numberOfStates - 1, blockStart + (state + 1) % 10), 1.0);
+        std::vector<uint64_t> successors = {state, std::min(numberOfStates - 1, blockStart + generator() % 10)};
+        std::sort(successors.begin(), successors.end());
+        successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+        for (auto successor : successors) {
+            matrixBuilder.addNextValue(3 * state + 1, successor, 1.0 / successors.size());
+        }
+        matrixBuilder.addNextValue(3 * state + 2, generator() % numberOfStates, 1.0);
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    storm::storage::BitVector removedStates(numberOfStates, false);
+    storm::storage::BitVector removedChoices(matrix.getRowCount(), false);
+    for (uint64_t state = 0; state < numberOfStates; state += 13) {
+        removedStates.set(state, true);
+    }
+    for (uint64_t state = 0; state < numberOfStates; state += 4) {
+        removedChoices.set(3 * state + generator() % 2, true);
+    }
+
+    // Retrieves the MECs in a form that does not depend on their order.
+    auto getMecs = [](storm::storage::MaximalEndComponentDecomposition<double> const& decomposition) {
+        std::vector<std::vector<std::pair<uint64_t, std::vector<uint64_t>>>> result;
+        for (auto const& mec : decomposition) {
+            std::vector<std::pair<uint64_t, std::vector<uint64_t>>> stateChoices;
+            for (auto const& entry : mec) {
+                stateChoices.emplace_back(entry.first, std::vector<uint64_t>(entry.second.begin(), entry.second.end()));
+            }
+            std::sort(stateChoices.begin(), stateChoices.end());
+            result.push_back(std::move(stateChoices));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    storm::storage::MaximalEndComponentDecomposition<double> expected(matrix, backwardTransitions, ~removedStates, ~removedChoices);
+    auto expectedMecs = getMecs(expected);
+    EXPECT_LT(0ul, expectedMecs.size());
+
+    for (uint64_t numberOfThreads : {1ul, 4ul}) {
+        storm::storage::MaximalEndComponentDecomposition<double> refined(matrix, backwardTransitions);
+        refined.refine(matrix, removedStates, removedChoices, numberOfThreads);
+        EXPECT_EQ(expectedMecs, getMecs(refined)) << "Refinement with " << numberOfThreads << " thread(s) differs.";
+    }
+}
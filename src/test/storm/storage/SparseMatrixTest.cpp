@@ -712,6 +712,41 @@ TEST(SparseMatrix, MatrixVectorMultiply) {
     }
 }
 
+TEST(SparseMatrix, MatrixMultiVectorMultiply) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 2, 1.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 1, 0.7));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 2, 1.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 0, 0.1));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 1, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(4, 3, 0.3));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    std::vector<std::vector<double>> vectors = {{1, 0.3, 1.4, 7.1}, {0, 2, 0.5, 1}, {3, 0, 0, 0.2}};
+    std::vector<double> summand = {0.1, 0.2, 0.3, 0.4, 0.5};
+    std::vector<double> interleaved;
+    for (uint64_t column = 0; column < matrix.getColumnCount(); ++column) {
+        for (auto const& vector : vectors) {
+            interleaved.push_back(vector[column]);
+        }
+    }
+    std::vector<double> result(matrix.getRowCount() * vectors.size());
+
+    ASSERT_NO_THROW(matrix.multiplyWithVectors(interleaved, result, vectors.size(), &summand));
+
+    std::vector<double> singleResult(matrix.getRowCount());
+    for (uint64_t vectorIndex = 0; vectorIndex < vectors.size(); ++vectorIndex) {
+        matrix.multiplyWithVector(vectors[vectorIndex], singleResult, &summand);
+        for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+            ASSERT_NEAR(singleResult[row], result[row * vectors.size() + vectorIndex], 1e-12);
+        }
+    }
+}
+
 TEST(SparseMatrix, Iteration) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(5, 4, 9);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -0,0 +1,129 @@
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/utility/constants.h"
+
+namespace {
+class StateValuationsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        manager = std::make_shared<storm::expressions::ExpressionManager>();
+        b = manager->declareBooleanVariable("b");
+        x = manager->declareIntegerVariable("x");
+        y = manager->declareIntegerVariable("y");
+        r = manager->declareRationalVariable("r");
+
+        storm::storage::sparse::StateValuationsBuilder builder;
+        builder.addVariable(b);
+        builder.addVariable(x, 0, 7);
+        // The values of y exceed any initial guess of the range, so its column needs to be repacked.
+        builder.addVariable(y);
+        builder.addVariable(r);
+
+        // States are added out of order and state 4 does not get a valuation.
+        builder.addState(0, {true}, {0, -5}, {rational(1, 2)});
+        builder.addState(1, {false}, {3, 100}, {rational(0, 1)});
+        builder.addState(5, {true}, {3, -1000}, {rational(1, 4)});
+        builder.addState(2, {true}, {7, -5}, {rational(3, 1)});
+        builder.addState(3, {false}, {5, 1000000000000}, {rational(0, 1)});
+        valuations = builder.build(6);
+    }
+
+    storm::RationalNumber rational(int64_t numerator, int64_t denominator) const {
+        return storm::utility::convertNumber<storm::RationalNumber>(numerator) / storm::utility::convertNumber<storm::RationalNumber>(denominator);
+    }
+
+    storm::storage::BitVector states(std::vector<uint64_t> const& indices, uint64_t size = 6) const {
+        storm::storage::BitVector result(size, false);
+        for (auto const& index : indices) {
+            result.set(index);
+        }
+        return result;
+    }
+
+    std::shared_ptr<storm::expressions::ExpressionManager> manager;
+    storm::expressions::Variable b, x, y, r;
+    storm::storage::sparse::StateValuations valuations;
+};
+}  // namespace
+
+TEST_F(StateValuationsTest, Access) {
+    ASSERT_EQ(6ul, valuations.getNumberOfStates());
+    EXPECT_TRUE(valuations.isEmpty(4));
+    EXPECT_FALSE(valuations.isEmpty(5));
+
+    std::vector<uint64_t> const validStates = {0, 1, 2, 3, 5};
+    std::vector<bool> const bValues = {true, false, true, false, true};
+    std::vector<int64_t> const xValues = {0, 3, 7, 5, 3};
+    std::vector<int64_t> const yValues = {-5, 100, -5, 1000000000000, -1000};
+    std::vector<storm::RationalNumber> const rValues = {rational(1, 2), rational(0, 1), rational(3, 1), rational(0, 1), rational(1, 4)};
+    for (uint64_t index = 0; index < validStates.size(); ++index) {
+        uint64_t state = validStates[index];
+        EXPECT_EQ(bValues[index], valuations.getBooleanValue(state, b));
+        EXPECT_EQ(xValues[index], valuations.getIntegerValue(state, x));
+        EXPECT_EQ(yValues[index], valuations.getIntegerValue(state, y));
+        EXPECT_EQ(rValues[index], valuations.getRationalValue(state, r));
+    }
+
+    uint64_t numberOfAssignments = 0;
+    auto range = valuations.at(3);
+    for (auto valIt = range.begin(); valIt != range.end(); ++valIt) {
+        if (valIt.getVariable() == y) {
+            EXPECT_EQ(1000000000000, valIt.getIntegerValue());
+        }
+        ++numberOfAssignments;
+    }
+    EXPECT_EQ(4ul, numberOfAssignments);
+    EXPECT_NE(std::string::npos, valuations.toString(0).find("y=-5"));
+}
+
+TEST_F(StateValuationsTest, Select) {
+    storm::storage::sparse::StateValuations selected = valuations.selectStates(states({1, 3, 4}));
+    ASSERT_EQ(3ul, selected.getNumberOfStates());
+    EXPECT_FALSE(selected.isEmpty(0));
+    EXPECT_FALSE(selected.isEmpty(1));
+    EXPECT_TRUE(selected.isEmpty(2));
+    EXPECT_EQ(5, selected.getIntegerValue(1, x));
+    EXPECT_EQ(1000000000000, selected.getIntegerValue(1, y));
+    EXPECT_FALSE(selected.getBooleanValue(0, b));
+
+    // Invalid indices yield empty valuations.
+    selected = valuations.selectStates(std::vector<uint64_t>({5, 10}));
+    ASSERT_EQ(2ul, selected.getNumberOfStates());
+    EXPECT_EQ(-1000, selected.getIntegerValue(0, y));
+    EXPECT_EQ(rational(1, 4), selected.getRationalValue(0, r));
+    EXPECT_TRUE(selected.isEmpty(1));
+
+    storm::storage::sparse::StateValuations blownUp = valuations.blowup({2, 2, 0});
+    ASSERT_EQ(3ul, blownUp.getNumberOfStates());
+    EXPECT_EQ(7, blownUp.getIntegerValue(0, x));
+    EXPECT_EQ(7, blownUp.getIntegerValue(1, x));
+    EXPECT_EQ(-5, blownUp.getIntegerValue(2, y));
+    EXPECT_EQ(rational(3, 1), blownUp.getRationalValue(1, r));
+}
+
+TEST_F(StateValuationsTest, Filter) {
+    // Comparisons with constants are evaluated on the columns.
+    EXPECT_EQ(states({1, 2, 3, 5}), valuations.getStates(x.getExpression() >= 3));
+    EXPECT_EQ(states({2, 3}), valuations.getStates(manager->integer(3) < x.getExpression()));
+    EXPECT_EQ(states({1, 5}), valuations.getStates(x.getExpression() == manager->integer(3)));
+    EXPECT_EQ(states({0, 2, 3}), valuations.getStates(x.getExpression() != manager->integer(3)));
+    EXPECT_EQ(states({}), valuations.getStates(x.getExpression() > 7));
+    EXPECT_EQ(states({0, 2, 5}), valuations.getStates(y.getExpression() < 0));
+    EXPECT_EQ(states({3}), valuations.getStates(y.getExpression() > 100));
+    EXPECT_EQ(states({0, 2, 5}), valuations.getStates(b.getExpression()));
+    EXPECT_EQ(states({1, 3}), valuations.getStates(!b.getExpression() && x.getExpression() > 0));
+    EXPECT_EQ(states({0, 1, 2, 3, 5}), valuations.getStates(manager->boolean(true)));
+
+    // Other expressions are evaluated state by state.
+    EXPECT_EQ(states({1, 3}), valuations.getStates(x.getExpression() + y.getExpression() > 5));
+    EXPECT_EQ(states({0, 2}), valuations.getStates(r.getExpression() > manager->rational(0.25)));
+    EXPECT_EQ(states({0, 1, 2, 3}), valuations.getStates(r.getExpression() > manager->rational(0.25) || y.getExpression() >= -5));
+
+    storm::expressions::Variable z = manager->declareIntegerVariable("z");
+    STORM_SILENT_EXPECT_THROW(valuations.getStates(z.getExpression() > 0), storm::exceptions::InvalidArgumentException);
+    STORM_SILENT_EXPECT_THROW(valuations.getStates(x.getExpression()), storm::exceptions::InvalidArgumentException);
+}
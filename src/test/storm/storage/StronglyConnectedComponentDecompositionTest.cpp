@@ -1,4 +1,8 @@
 #include "storm-config.h"
+
+#include <algorithm>
+#include <random>
+
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -90,3 +94,138 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    // Build a system with two choices per state that consists of chains of small cycles and some random transitions.
+    uint64_t const numberOfStates = 30000;
+    std::mt19937 generator(42);
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        matrixBuilder.newRowGroup(2 * state);
+        uint64_t cycleStart = state - state % 5;
+        std::vector<uint64_t> firstChoice = {std::min(numberOfStates - 1, cycleStart + (state + 1) % 5)};
+        if (generator() % 4 == 0 && cycleStart + 5 < numberOfStates) {
+            firstChoice.push_back(cycleStart + 5);
+        }
+        std::vector<uint64_t> secondChoice = {state, generator() % numberOfStates};
+        for (auto* choice : {&firstChoice, &secondChoice}) {
+            std::sort(choice->begin(), choice->end());
+            choice->erase(std::unique(choice->begin(), choice->end()), choice->end());
+        }
+        for (auto successor : firstChoice) {
+            matrixBuilder.addNextValue(2 * state, successor, 1.0);
+        }
+        for (auto successor : secondChoice) {
+            matrixBuilder.addNextValue(2 * state + 1, successor, 0.5);
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    storm::storage::BitVector choices(matrix.getRowCount(), true);
+    for (uint64_t state = 0; state < numberOfStates; state += 7) {
+        subsystem.set(state, false);
+    }
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        choices.set(2 * state + 1, state % 3 == 0);
+    }
+
+    // Retrieves the SCCs together with their depths in a form that does not depend on the order of the SCCs.
+    auto getSccs = [](storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition) {
+        std::vector<std::pair<std::vector<uint64_t>, uint64_t>> result;
+        for (uint64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+            result.emplace_back(std::vector<uint64_t>(decomposition[sccIndex].begin(), decomposition[sccIndex].end()), decomposition.getSccDepth(sccIndex));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    for (bool restrict : {false, true}) {
+        for (bool dropNaiveSccs : {false, true}) {
+            storm::storage::StronglyConnectedComponentDecompositionOptions options;
+            options.forceTopologicalSort().computeSccDepths().dropNaiveSccs(dropNaiveSccs);
+            if (restrict) {
+                options.subsystem(&subsystem).choices(&choices);
+            }
+            storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options);
+            options.threads(4);
+            storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options);
+            EXPECT_EQ(getSccs(sequentialDecomposition), getSccs(parallelDecomposition));
+
+            // The SCCs need to be sorted topologically.
+            std::vector<uint64_t> stateToScc(numberOfStates, parallelDecomposition.size());
+            for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+                for (auto state : parallelDecomposition[sccIndex]) {
+                    stateToScc[state] = sccIndex;
+                }
+            }
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (stateToScc[state] == parallelDecomposition.size()) {
+                    continue;
+                }
+                for (uint64_t row = matrix.getRowGroupIndices()[state]; row < matrix.getRowGroupIndices()[state + 1]; ++row) {
+                    if (restrict && !choices.get(row)) {
+                        continue;
+                    }
+                    for (auto const& entry : matrix.getRow(row)) {
+                        if (stateToScc[entry.getColumn()] != parallelDecomposition.size()) {
+                            EXPECT_LE(stateToScc[entry.getColumn()], stateToScc[state]);
+                        }
+                    }
+                }
+            }
+
+            options.onlyBottomSccs().threads(1);
+            sequentialDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options);
+            options.threads(4);
+            parallelDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, options);
+            EXPECT_EQ(getSccs(sequentialDecomposition), getSccs(parallelDecomposition));
+        }
+    }
+}
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecompositionDtmc) {
+#ifndef STORM_HAVE_INTELTBB
+    GTEST_SKIP() << "Storm was built without support for Intel TBB.";
+#endif
+    // The row grouping of a DTMC matrix is only created on demand, so the parallel decomposition must be the first to access it.
+    uint64_t const numberOfStates = 30000;
+    auto buildMatrix = [&numberOfStates]() {
+        std::mt19937 generator(42);
+        storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            uint64_t cycleStart = state - state % 5;
+            std::vector<uint64_t> successors = {std::min(numberOfStates - 1, cycleStart + (state + 1) % 5)};
+            if (generator() % 4 == 0) {
+                successors.push_back(generator() % numberOfStates);
+            }
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            for (auto successor : successors) {
+                matrixBuilder.addNextValue(state, successor, 1.0 / successors.size());
+            }
+        }
+        return matrixBuilder.build();
+    };
+
+    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+    options.forceTopologicalSort().threads(4);
+    storm::storage::SparseMatrix<double> parallelMatrix = buildMatrix();
+    storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(parallelMatrix, options);
+    options.threads(1);
+    storm::storage::SparseMatrix<double> sequentialMatrix = buildMatrix();
+    storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(sequentialMatrix, options);
+
+    ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+    std::vector<std::vector<uint64_t>> sequentialSccs, parallelSccs;
+    for (uint64_t sccIndex = 0; sccIndex < sequentialDecomposition.size(); ++sccIndex) {
+        sequentialSccs.emplace_back(sequentialDecomposition[sccIndex].begin(), sequentialDecomposition[sccIndex].end());
+        parallelSccs.emplace_back(parallelDecomposition[sccIndex].begin(), parallelDecomposition[sccIndex].end());
+    }
+    std::sort(sequentialSccs.begin(), sequentialSccs.end());
+    std::sort(parallelSccs.begin(), parallelSccs.end());
+    EXPECT_EQ(sequentialSccs, parallelSccs);
+}
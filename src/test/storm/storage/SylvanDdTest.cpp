@@ -830,6 +830,61 @@ TEST(SylvanDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, AddLargeMatrixTest) {
+    // The matrix has enough entries for the translation to be split into independent ranges of rows (if Intel TBB is available).
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 399);
+    uint64_t const size = 400;
+
+    // The entry in row r and column c is 400 * r + c + 1.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> range =
+        manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd =
+        range * (manager->template getIdentity<double>(x.first) * manager->template getConstant<double>(static_cast<double>(size)) +
+                 manager->template getIdentity<double>(x.second) + manager->template getConstant<double>(1));
+
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+    ASSERT_EQ(size, matrix.getRowCount());
+    ASSERT_EQ(size * size, matrix.getEntryCount());
+    for (uint64_t row = 0; row < size; ++row) {
+        uint64_t column = 0;
+        for (auto const& entry : matrix.getRow(row)) {
+            EXPECT_EQ(column, entry.getColumn());
+            EXPECT_EQ(static_cast<double>(size * row + column + 1), entry.getValue());
+            ++column;
+        }
+        EXPECT_EQ(size, column);
+    }
+
+    // Choice a=1 has all entries shifted by the number of entries of choice a=0.
+    dd = manager->getEncoding(a.first, 0).ite(dd, dd + range * manager->template getConstant<double>(static_cast<double>(size * size)));
+    ASSERT_NO_THROW(matrix = dd.toMatrix({a.first}, rowOdd, columnOdd));
+    ASSERT_EQ(size, matrix.getRowGroupCount());
+    ASSERT_EQ(2 * size, matrix.getRowCount());
+    ASSERT_EQ(2 * size * size, matrix.getEntryCount());
+    for (uint64_t group = 0; group < size; ++group) {
+        ASSERT_EQ(2ul, matrix.getRowGroupSize(group));
+        for (uint64_t row = matrix.getRowGroupIndices()[group]; row < matrix.getRowGroupIndices()[group + 1]; ++row) {
+            auto rowEntries = matrix.getRow(row);
+            ASSERT_EQ(size, rowEntries.getNumberOfEntries());
+            uint64_t choiceOffset = rowEntries.begin()->getValue() > static_cast<double>(size * size) ? size * size : 0;
+            uint64_t column = 0;
+            for (auto const& entry : rowEntries) {
+                EXPECT_EQ(column, entry.getColumn());
+                EXPECT_EQ(static_cast<double>(choiceOffset + size * group + column + 1), entry.getValue());
+                ++column;
+            }
+        }
+        EXPECT_NE(matrix.getRow(matrix.getRowGroupIndices()[group]).begin()->getValue(),
+                  matrix.getRow(matrix.getRowGroupIndices()[group] + 1).begin()->getValue());
+    }
+}
+
 TEST(SylvanDd, AddSharpenTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
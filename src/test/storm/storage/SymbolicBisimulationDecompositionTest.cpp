@@ -28,6 +28,9 @@
 #include "storm/models/symbolic/Mdp.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
 TEST(SymbolicModelBisimulationDecomposition, Die_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
 
@@ -358,6 +361,59 @@ TEST(SymbolicModelBisimulationDecomposition, Crowds_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
 }
 
+TEST(SymbolicModelBisimulationDecomposition, CrowdsGrowingTable_Sylvan) {
+    // Start with a tiny block table, so that it has to be grown (and rehashed) several times during the refinements.
+    storm::settings::mutableBisimulationSettings().setSylvanRefinerTableCapacity(16);
+
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+
+    // Preprocess model to substitute all constants.
+    smd = smd.preprocess();
+
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model =
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram());
+
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition(*model, storm::storage::BisimulationType::Strong);
+    decomposition.compute();
+    std::shared_ptr<storm::models::Model<double>> quotient = decomposition.getQuotient(storm::dd::bisimulation::QuotientFormat::Dd);
+
+    EXPECT_EQ(2007ul, quotient->getNumberOfStates());
+    EXPECT_EQ(3738ul, quotient->getNumberOfTransitions());
+    EXPECT_EQ(storm::models::ModelType::Dtmc, quotient->getType());
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F \"observe0Greater1\"]");
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+    formulas.push_back(formula);
+
+    storm::dd::BisimulationDecomposition<storm::dd::DdType::Sylvan, double> decomposition2(*model, formulas, storm::storage::BisimulationType::Strong);
+    decomposition2.compute();
+    quotient = decomposition2.getQuotient(storm::dd::bisimulation::QuotientFormat::Dd);
+
+    EXPECT_EQ(65ul, quotient->getNumberOfStates());
+    EXPECT_EQ(105ul, quotient->getNumberOfTransitions());
+    EXPECT_EQ(storm::models::ModelType::Dtmc, quotient->getType());
+
+    // The quotient has to preserve the probability of the original model.
+    std::shared_ptr<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>> dtmc =
+        model->as<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>>();
+    storm::modelchecker::SymbolicDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>> checker(*dtmc);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(*formula);
+    result->filter(storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::Sylvan>(dtmc->getReachableStates(), dtmc->getInitialStates()));
+    double originalProbability = result->asQuantitativeCheckResult<double>().sum();
+
+    std::shared_ptr<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>> quotientDtmc =
+        quotient->as<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>>();
+    storm::modelchecker::SymbolicDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan, double>> quotientChecker(*quotientDtmc);
+    result = quotientChecker.check(*formula);
+    result->filter(
+        storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::Sylvan>(quotientDtmc->getReachableStates(), quotientDtmc->getInitialStates()));
+    EXPECT_NEAR(originalProbability, result->asQuantitativeCheckResult<double>().sum(), 1e-6);
+
+    storm::settings::mutableBisimulationSettings().restoreDefaults();
+}
+
 TEST(SymbolicModelBisimulationDecomposition, TwoDice_Cudd) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
 
@@ -4,6 +4,8 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/modelchecker/ModelCheckerEnvironment.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -772,3 +774,72 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitProb01Parallel) {
+    storm::Environment env;
+    env.modelchecker().setNumberOfGraphThreads(4);
+
+    storm::prism::Program program =
+        storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm"))
+            .preprocess()
+            .asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+    storm::storage::SparseMatrix<double> backwardTransitions = model->getBackwardTransitions();
+
+    for (std::string const& label : {"observe0Greater1", "observeIGreater1", "observeOnlyTrueSender"}) {
+        auto sequentialResult = storm::utility::graph::performProb01(backwardTransitions, allStates, model->getStates(label));
+        auto parallelResult = storm::utility::graph::performProb01(env, model->getTransitionMatrix(), backwardTransitions, allStates, model->getStates(label));
+        EXPECT_EQ(sequentialResult.first, parallelResult.first);
+        EXPECT_EQ(sequentialResult.second, parallelResult.second);
+        EXPECT_EQ(storm::utility::graph::performProbGreater0(backwardTransitions, allStates, model->getStates(label), true, 10),
+                  storm::utility::graph::performProbGreater0(env, model->getTransitionMatrix(), backwardTransitions, allStates, model->getStates(label), true,
+                                                             10));
+    }
+
+    for (auto const& fileAndLabel : {std::make_pair("/mdp/coin2-2.nm", "all_coins_equal_0"), std::make_pair("/mdp/coin2-2.nm", "all_coins_equal_1"),
+                                     std::make_pair("/mdp/csma2-2.nm", "collision_max_backoff"), std::make_pair("/mdp/leader3.nm", "elected")}) {
+        program = storm::storage::SymbolicModelDescription(storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + std::string(fileAndLabel.first)))
+                      .preprocess()
+                      .asPrismProgram();
+        model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+        ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+        storm::storage::SparseMatrix<double> const& transitionMatrix = model->getTransitionMatrix();
+        backwardTransitions = model->getBackwardTransitions();
+        allStates = storm::storage::BitVector(model->getNumberOfStates(), true);
+        storm::storage::BitVector psiStates = model->getStates(fileAndLabel.second);
+
+        auto sequentialResult =
+            storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates);
+        auto parallelResult =
+            storm::utility::graph::performProb01Min(env, transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates);
+        EXPECT_EQ(sequentialResult.first, parallelResult.first);
+        EXPECT_EQ(sequentialResult.second, parallelResult.second);
+
+        sequentialResult =
+            storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates);
+        parallelResult =
+            storm::utility::graph::performProb01Max(env, transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates);
+        EXPECT_EQ(sequentialResult.first, parallelResult.first);
+        EXPECT_EQ(sequentialResult.second, parallelResult.second);
+
+        EXPECT_EQ(storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates),
+                  storm::utility::graph::performProb1A(env, transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates,
+                                                       psiStates));
+
+        // Only consider every other choice.
+        storm::storage::BitVector choiceConstraint(transitionMatrix.getRowCount());
+        for (uint64_t row = 0; row < transitionMatrix.getRowCount(); row += 2) {
+            choiceConstraint.set(row);
+        }
+        EXPECT_EQ(storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates,
+                                                       choiceConstraint),
+                  storm::utility::graph::performProb1E(env, transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates, psiStates,
+                                                       choiceConstraint));
+        EXPECT_EQ(storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates,
+                                                              psiStates, false, 0, choiceConstraint),
+                  storm::utility::graph::performProbGreater0A(env, transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, allStates,
+                                                              psiStates, false, 0, choiceConstraint));
+    }
+}